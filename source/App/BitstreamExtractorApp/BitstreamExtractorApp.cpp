@@ -119,7 +119,22 @@ Slice BitstreamExtractorApp::xParseSliceHeader(InputNALUnit &nalu)
   return slice;
 }
 
-bool BitstreamExtractorApp::xCheckSliceSubpicture(Slice &slice, int targetSubPicId)
+void BitstreamExtractorApp::xProbeSliceHeader(InputNALUnit &nalu, SliceHeaderProbe &sliceProbe)
+{
+  if (nalu.getBitstream().peekBits(1))
+  {
+    // sh_picture_header_in_slice_header_flag: the full parse keeps m_picHeader up to date
+    Slice slice = xParseSliceHeader(nalu);
+    sliceProbe.picHeaderInSliceHeader = true;
+    sliceProbe.poc                    = slice.getPOC();
+    sliceProbe.subPicId               = slice.getSliceSubPicId();
+    return;
+  }
+  m_hlSynaxReader.setBitstream(&nalu.getBitstream());
+  m_hlSynaxReader.probeSliceHeader(sliceProbe, nalu.m_nalUnitType, &m_picHeader, &m_parameterSetManager, m_prevTid0Poc);
+}
+
+bool BitstreamExtractorApp::xCheckSliceSubpicture(const SliceHeaderProbe &sliceProbe, int targetSubPicId)
 {
   PPS *pps = m_parameterSetManager.getPPS(m_picHeader.getPPSId());
   CHECK(nullptr == pps, "referenced PPS not found");
@@ -129,8 +144,8 @@ bool BitstreamExtractorApp::xCheckSliceSubpicture(Slice &slice, int targetSubPic
   if (sps->getSubPicInfoPresentFlag())
   {
     // subpic ID is explicitly indicated
-    msg(VERBOSE, "found slice subpic id %d\n", slice.getSliceSubPicId());
-    return (targetSubPicId == slice.getSliceSubPicId());
+    msg(VERBOSE, "found slice subpic id %d\n", sliceProbe.subPicId);
+    return (targetSubPicId == sliceProbe.subPicId);
   }
   else
   {
@@ -853,16 +868,16 @@ uint32_t BitstreamExtractorApp::decode()
         }
       }
 
-      Slice slice;
+      SliceHeaderProbe sliceProbe;
       if (nalu.isSlice())
       {
-         slice = xParseSliceHeader(nalu);
+        xProbeSliceHeader(nalu, sliceProbe);
       }
       if (isMultiSubpicLayer[nalu.m_nuhLayerId] && writeInpuNalUnitToStream)
       {
         if (m_subPicIdx >= 0 && nalu.isSlice())
         {
-          writeInpuNalUnitToStream = xCheckSliceSubpicture(slice, subpicIdTarget[nalu.m_nuhLayerId]);
+          writeInpuNalUnitToStream = xCheckSliceSubpicture(sliceProbe, subpicIdTarget[nalu.m_nuhLayerId]);
           if (!writeInpuNalUnitToStream)
           {
             isVclNalUnitRemoved[nalu.m_nuhLayerId] = true;
@@ -875,7 +890,7 @@ uint32_t BitstreamExtractorApp::decode()
       }
       if (nalu.isSlice() && writeInpuNalUnitToStream)
       {
-        m_prevPicPOC = slice.getPOC();
+        m_prevPicPOC = sliceProbe.poc;
       }
 
       if( writeInpuNalUnitToStream )
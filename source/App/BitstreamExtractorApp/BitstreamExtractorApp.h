@@ -66,7 +66,8 @@ protected:
   bool xCheckSEIFiller(SEIMessages SEIs, int targetSubPicId, bool &rmAllFillerInSubpicExt, bool lastSliceWritten);
 
   Slice xParseSliceHeader(InputNALUnit &nalu);
-  bool  xCheckSliceSubpicture(Slice &slice, int subPicId);
+  void  xProbeSliceHeader(InputNALUnit &nalu, SliceHeaderProbe &sliceProbe);
+  bool  xCheckSliceSubpicture(const SliceHeaderProbe &sliceProbe, int subPicId);
   void xReadPicHeader(InputNALUnit &nalu);
   bool xIsTargetOlsIncludeAllVclLayers();
   bool xCheckSEIsSubPicture(SEIMessages& SEIs, InputNALUnit& nalu, std::ostream& out, int subpicId, VPS *vps);
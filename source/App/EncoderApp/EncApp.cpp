@@ -269,6 +269,7 @@ void EncApp::xInitLibCfg( int layerIdx )
   m_cEncLib.setPrintMSSSIM                                       ( m_printMSSSIM );
   m_cEncLib.setPrintWPSNR                                        ( m_printWPSNR );
   m_cEncLib.setPrintHightPrecEncTime(m_printHighPrecEncTime);
+  m_cEncLib.setBackgroundMetrics                                 ( m_backgroundMetrics );
   m_cEncLib.setCabacZeroWordPaddingEnabled                       ( m_cabacZeroWordPaddingEnabled );
 
   m_cEncLib.setFrameRate(m_frameRate);
@@ -1328,6 +1329,9 @@ void EncApp::xInitLibCfg( int layerIdx )
   m_cEncLib.setNnPostFilterSEIActivationOutputFlag               (m_nnPostFilterSEIActivationOutputFlag);
   m_cEncLib.setEntropyCodingSyncEnabledFlag                      ( m_entropyCodingSyncEnabledFlag );
   m_cEncLib.setEntryPointPresentFlag                             ( m_entryPointPresentFlag );
+#if ENABLE_PARALLEL_TILE_WRITING
+  m_cEncLib.setNumTileWriterThreads                              ( m_numTileWriterThreads );
+#endif
   m_cEncLib.setTMVPModeId                                        ( m_TMVPModeId );
   m_cEncLib.setSliceLevelRpl                                     ( m_sliceLevelRpl  );
   m_cEncLib.setSliceLevelDblk                                    ( m_sliceLevelDblk );
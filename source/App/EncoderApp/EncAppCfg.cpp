@@ -803,6 +803,7 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("PrintMSSSIM",                                     m_printMSSSIM,                                    false, "0 (default) do not print MS-SSIM scores, 1 = print MS-SSIM scores for each frame and for the whole sequence")
   ("PrintWPSNR",                                      m_printWPSNR,                                     false, "0 (default) do not print HDR-PQ based wPSNR, 1 = print HDR-PQ based wPSNR")
   ("PrintHighPrecEncTime",                            m_printHighPrecEncTime,                           false, "0 (default): print integer value of encoding time in seconds, 1: print floating-point value of encoding time")
+  ("BackgroundMetrics",                               m_backgroundMetrics,                              false, "0 (default): compute the PSNR and MS-SSIM of each frame before coding the next one, 1: compute them on a separate thread while the next frame of the GOP is coded")
   ("CabacZeroWordPaddingEnabled",                     m_cabacZeroWordPaddingEnabled,                     true, "0 do not add conforming cabac-zero-words to bit streams, 1 (default) = add cabac-zero-words as required")
   ("ChromaFormatIDC,-cf",                             tmpChromaFormat,                                      0, "ChromaFormatIDC (400|420|422|444 or set 0 (default) for same as InputChromaFormat)")
   ("ConformanceWindowMode",                           m_conformanceWindowMode,                              1, "Window conformance mode (0: no window, 1:automatic padding (default), 2:padding parameters specified, 3:conformance window parameters specified")
@@ -1268,6 +1269,9 @@ bool EncAppCfg::parseCfg( int argc, char* argv[] )
   ("Log2ParallelMergeLevel",                          m_log2ParallelMergeLevel,                            2u, "Parallel merge estimation region")
   ("WaveFrontSynchro",                                m_entropyCodingSyncEnabledFlag,                   false, "0: entropy coding sync disabled; 1 entropy coding sync enabled")
   ("EntryPointsPresent",                              m_entryPointPresentFlag,                           true, "0: entry points is not present; 1 entry points may be present in slice header")
+#if ENABLE_PARALLEL_TILE_WRITING
+  ("NumTileWriterThreads",                            m_numTileWriterThreads,                               1, "Number of threads writing the tile substreams of a slice without WPP in the final entropy coding pass (1: serial)")
+#endif
   ("ScalingList",                                     m_useScalingListId,                    SCALING_LIST_OFF, "0/off: no scaling list, 1/default: default scaling lists, 2/file: scaling lists specified in ScalingListFile")
   ("ScalingListFile",                                 m_scalingListFileName,                       std::string(""), "Scaling list file name. Use an empty string to produce help.")
   ("DisableScalingMatrixForLFNST",                    m_disableScalingMatrixForLfnstBlks,                true, "Disable scaling matrices, when enabled, for LFNST-coded blocks")
@@ -5205,6 +5209,13 @@ bool EncAppCfg::xCheckParameter()
   }
 
   xConfirmPara(m_log2ParallelMergeLevel < 2, "Log2ParallelMergeLevel should be larger than or equal to 2");
+#if ENABLE_PARALLEL_TILE_WRITING
+  xConfirmPara(m_numTileWriterThreads < 1, "NumTileWriterThreads should be larger than or equal to 1");
+#endif
+  xConfirmPara(m_backgroundMetrics && m_isField, "BackgroundMetrics is not supported with field coding");
+#if GREEN_METADATA_SEI_ENABLED
+  xConfirmPara(m_backgroundMetrics && m_greenMetadataType >= 0, "BackgroundMetrics is not supported with the green metadata SEI");
+#endif
   xConfirmPara(m_log2ParallelMergeLevel > m_ctuSize, "Log2ParallelMergeLevel should be less than or equal to CTU size");
   xConfirmPara(m_preferredTransferCharacteristics > 255, "transfer_characteristics_idc should not be greater than 255.");
   xConfirmPara( unsigned(m_ImvMode) > 1, "ImvMode exceeds range (0 to 1)" );
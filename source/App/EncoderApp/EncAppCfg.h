@@ -135,6 +135,7 @@ protected:
   bool      m_printMSSSIM;
   bool      m_printWPSNR;
   bool      m_printHighPrecEncTime = false;
+  bool      m_backgroundMetrics;                              ///< compute the metrics of a frame while the next frame is coded
   bool      m_cabacZeroWordPaddingEnabled;
   bool      m_clipInputVideoToRec709Range;
   bool      m_clipOutputVideoToRec709Range;
@@ -515,6 +516,9 @@ protected:
   bool      m_singleSlicePerSubPicFlag;
   bool      m_entropyCodingSyncEnabledFlag;
   bool      m_entryPointPresentFlag;                          ///< flag for the presence of entry points
+#if ENABLE_PARALLEL_TILE_WRITING
+  int       m_numTileWriterThreads;                           ///< number of threads writing the tile substreams of a slice
+#endif
 
   bool      m_bFastUDIUseMPMEnabled;
   bool      m_bFastMEForGenBLowDelayEnabled;
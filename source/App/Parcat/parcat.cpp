@@ -45,49 +45,6 @@
 
 #define PRINT_NALUS 1
 
-class ParcatHLSyntaxReader : public VLCReader
-{
-  public:
-    void  parsePictureHeaderUpToPoc ( ParameterSetManager *parameterSetManager );
-    bool  parsePictureHeaderInSliceHeaderFlag ( ParameterSetManager *parameterSetManager );
-};
-
-bool ParcatHLSyntaxReader::parsePictureHeaderInSliceHeaderFlag(ParameterSetManager *parameterSetManager) {
-
-
-  uint32_t  uiCode;
-  xReadFlag(uiCode, "sh_picture_header_in_slice_header_flag");
-  return (uiCode==1);
-}
-
-void ParcatHLSyntaxReader::parsePictureHeaderUpToPoc ( ParameterSetManager *parameterSetManager )
-{
-  uint32_t  uiCode;
-
-  PPS *pps = nullptr;
-  SPS *sps = nullptr;
-
-  uint32_t uiTmp;
-  xReadFlag(uiTmp, "ph_gdr_or_irap_pic_flag");
-  xReadFlag(uiCode, "ph_non_ref_pic_flag");
-  if( uiTmp )
-  {
-    xReadFlag( uiCode, "ph_gdr_pic_flag" );
-  }
-  xReadFlag(uiCode, "ph_inter_slice_allowed_flag");
-  if (uiCode)
-  {
-    xReadFlag(uiCode, "ph_intra_slice_allowed_flag");
-  }
-  // parameter sets
-  xReadUvlc(uiCode, "ph_pic_parameter_set_id");
-  pps = parameterSetManager->getPPS(uiCode);
-  CHECK(pps == 0, "Invalid PPS");
-  sps = parameterSetManager->getSPS(pps->getSPSId());
-  CHECK(sps == 0, "Invalid SPS");
-  return;
-}
-
 /**
  Find the beginning and end of a NAL (Network Abstraction Layer) unit in a byte buffer containing H264 bitstream data.
  @param[in]   buf        the buffer
@@ -249,7 +206,6 @@ std::vector<uint8_t> filter_segment(const std::vector<uint8_t> & v, int idx, int
 
     HLSyntaxReader HLSReader;
     static ParameterSetManager parameterSetManager;
-    ParcatHLSyntaxReader parcatHLSReader;
     InputNALUnit inp_nalu;
     std::vector<uint8_t> & nalu_bs = inp_nalu.getBitstream().getFifo();
     nalu_bs = nalu;
@@ -288,21 +244,27 @@ std::vector<uint8_t> filter_segment(const std::vector<uint8_t> & v, int idx, int
     }
     if(inp_nalu.m_nalUnitType == NAL_UNIT_PH || (nalu_type < NAL_UNIT_CODED_SLICE_IDR_W_RADL) || (nalu_type > NAL_UNIT_CODED_SLICE_IDR_N_LP && nalu_type <= NAL_UNIT_RESERVED_IRAP_VCL_11) )
     {
-      parcatHLSReader.setBitstream( &inp_nalu.getBitstream() );
+      HLSReader.setBitstream( &inp_nalu.getBitstream() );
+      PicHeaderProbe phProbe;
       if (inp_nalu.m_nalUnitType == NAL_UNIT_PH)
       {
         change_poc = true;
         first_idr_slice_after_ph_nal = true;
+        HLSReader.probePictureHeader(phProbe, &parameterSetManager);
       }
       else
       {
-        change_poc = parcatHLSReader.parsePictureHeaderInSliceHeaderFlag(&parameterSetManager);
+        SliceHeaderProbe shProbe;
+        HLSReader.probeSliceHeader(shProbe, inp_nalu.m_nalUnitType, nullptr, &parameterSetManager, 0);
+        change_poc = shProbe.picHeaderInSliceHeader;
+        if (change_poc)
+        {
+          phProbe = shProbe.picHeader;
+        }
       }
       if (change_poc)
       {
-        // beginning of picture header parsing
-        parcatHLSReader.parsePictureHeaderUpToPoc(&parameterSetManager);
-        int num_bits_up_to_poc_lsb = parcatHLSReader.getBitstream()->getNumBitsRead();
+        int num_bits_up_to_poc_lsb = phProbe.pocLsbBitPos;
         int offset = num_bits_up_to_poc_lsb;
 
         int      byteOffset = offset / 8;
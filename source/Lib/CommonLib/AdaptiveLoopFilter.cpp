@@ -65,6 +65,7 @@ AdaptiveLoopFilter::AdaptiveLoopFilter()
   m_filterCcAlf = filterBlkCcAlf<CC_ALF>;
   m_filter5x5Blk = filterBlk<ALF_FILTER_5>;
   m_filter7x7Blk = filterBlk<ALF_FILTER_7>;
+  m_accumulateCovariance = accumulateCovariance;
 
 #if ENABLE_SIMD_OPT_ALF
 #ifdef TARGET_SIMD_X86
@@ -73,6 +74,17 @@ AdaptiveLoopFilter::AdaptiveLoopFilter()
 #endif
 }
 
+void AdaptiveLoopFilter::accumulateCovariance(const int *x, int size, int *acc, ptrdiff_t accStride)
+{
+  for (int r = 0; r < size; r++)
+  {
+    for (int c = 0; c <= r; c++)
+    {
+      acc[r * accStride + c] += x[r] * x[c];
+    }
+  }
+}
+
 bool AdaptiveLoopFilter::isCrossedByVirtualBoundaries( const CodingStructure& cs, const int xPos, const int yPos, const int width, const int height, bool& clipTop, bool& clipBottom, bool& clipLeft, bool& clipRight, int& numHorVirBndry, int& numVerVirBndry, int horVirBndryPos[], int verVirBndryPos[], int& rasterSliceAlfPad )
 {
   clipTop = false; clipBottom = false; clipLeft = false; clipRight = false;
@@ -123,6 +123,11 @@ public:
                          const Pel* fClipSet, const ClpRng& clpRng, CodingStructure& cs, const int vbCTUHeight,
                          int vbPos);
 
+  // Adds x[r] * x[c] to acc[r * accStride + c] for all c <= r (encoder statistics). The values of x must fit into
+  // 16 bits and x must be zero-padded to a multiple of 8 entries; columns c > r up to that multiple may be modified.
+  static void accumulateCovariance(const int *x, int size, int *acc, ptrdiff_t accStride);
+  void (*m_accumulateCovariance)(const int *x, int size, int *acc, ptrdiff_t accStride);
+
 #ifdef TARGET_SIMD_X86
   void initAdaptiveLoopFilterX86();
   template <X86_VEXT vext>
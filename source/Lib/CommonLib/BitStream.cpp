@@ -50,6 +50,7 @@
 
 OutputBitstream::OutputBitstream()
 {
+  m_fifo.reserve(FIFO_RESERVE_SIZE);
   clear();
 }
 
@@ -58,13 +59,20 @@ OutputBitstream::~OutputBitstream()
 }
 
 InputBitstream::InputBitstream()
-  : m_fifo(), m_emulationPreventionByteLocation(), m_fifoIdx(0), m_numHeldBits(0), m_heldBits(0), m_numBitsRead(0)
+  : m_fifo()
+  , m_emulationPreventionByteLocation()
+  , m_fifoIdx(0)
+  , m_fifoEndOffset(0)
+  , m_numHeldBits(0)
+  , m_heldBits(0)
+  , m_numBitsRead(0)
 { }
 
 InputBitstream::InputBitstream(const InputBitstream &src)
   : m_fifo(src.m_fifo)
   , m_emulationPreventionByteLocation(src.m_emulationPreventionByteLocation)
   , m_fifoIdx(src.m_fifoIdx)
+  , m_fifoEndOffset(src.m_fifoEndOffset)
   , m_numHeldBits(src.m_numHeldBits)
   , m_heldBits(src.m_heldBits)
   , m_numBitsRead(src.m_numBitsRead)
@@ -76,16 +84,22 @@ InputBitstream::InputBitstream(const InputBitstream &src)
 
 void InputBitstream::resetToStart()
 {
-  m_fifoIdx     = 0;
-  m_numHeldBits = 0;
-  m_heldBits    = 0;
-  m_numBitsRead = 0;
+  m_fifoIdx       = 0;
+  m_fifoEndOffset = 0;
+  m_numHeldBits   = 0;
+  m_heldBits      = 0;
+  m_numBitsRead   = 0;
 }
 
-const uint8_t *OutputBitstream::getByteStream() const { return m_fifo.data(); }
+const uint8_t *OutputBitstream::getByteStream()
+{
+  flushBytes();
+  return m_fifo.data();
+}
 
 uint32_t OutputBitstream::getByteStreamLength()
 {
+  flushBytes();
   return uint32_t(m_fifo.size());
 }
 
@@ -101,47 +115,29 @@ void OutputBitstream::write(uint32_t bits, uint32_t numberOfBits)
   CHECK(numberOfBits > BITS_PER_WORD, "Number of bits is exceeds '32'");
   CHECK(numberOfBits != BITS_PER_WORD && (bits & (~0u << numberOfBits)) != 0, "Unsupported parameters");
 
-  /* any modulo 8 remainder of numTotalBits cannot be written this time,
-   * and will be held until next time. */
-  uint32_t numTotalBits    = numberOfBits + m_numHeldBits;
-  uint32_t nextNumHeldBits = numTotalBits % BITS_PER_BYTE;
-
-  /* form a byte aligned word (writeBits), by concatenating any held bits
-   * with the new bits, discarding the bits that will form the nextHeldBits.
-   * eg: H = held bits, V = n new bits        /---- nextHeldBits
-   * len(H)=7, len(V)=1: ... ---- HHHH HHHV . 0000 0000, nextNumHeldBits=0
-   * len(H)=7, len(V)=2: ... ---- HHHH HHHV . V000 0000, nextNumHeldBits=1
-   * if total_bits < 8, the value of v_ is not used */
-  uint8_t nextHeldBits = bits << (BITS_PER_BYTE - nextNumHeldBits);
+  /* fewer than 32 bits are held before the call, so the new bits always
+   * fit into the 64-bit accumulator. The bits above m_numHeldBits are not
+   * cleared, they are shifted out or cut off when a word is flushed. */
+  m_heldBits = (m_heldBits << numberOfBits) | bits;
+  m_numHeldBits += numberOfBits;
 
-  if (numTotalBits < BITS_PER_BYTE)
+  if (m_numHeldBits >= BITS_PER_WORD)
   {
-    /* insufficient bits accumulated to write out, append new_held_bits to
-     * current held_bits */
-    /* NB, this requires that v only contains 0 in bit positions {31..n} */
-    m_heldBits |= nextHeldBits;
-    m_numHeldBits = nextNumHeldBits;
-    return;
+    m_numHeldBits -= BITS_PER_WORD;
+    const uint32_t word     = uint32_t(m_heldBits >> m_numHeldBits);
+    const uint8_t  bytes[4] = { uint8_t(word >> 3 * BITS_PER_BYTE), uint8_t(word >> 2 * BITS_PER_BYTE),
+                                uint8_t(word >> BITS_PER_BYTE), uint8_t(word) };
+    m_fifo.insert(m_fifo.end(), bytes, bytes + 4);
   }
+}
 
-  /* topword serves to justify held_bits to align with the msb of bits */
-  uint32_t topword   = (numberOfBits - nextNumHeldBits) & ~BITS_PER_BYTE_MASK;
-  uint32_t writeBits = (m_heldBits << topword) | (bits >> nextNumHeldBits);
-
-  switch (numTotalBits >> BITS_PER_BYTE_LOG2)
+void OutputBitstream::flushBytes()
+{
+  while (m_numHeldBits >= BITS_PER_BYTE)
   {
-  case 4:
-    m_fifo.push_back(writeBits >> 3 * BITS_PER_BYTE);
-  case 3:
-    m_fifo.push_back(writeBits >> 2 * BITS_PER_BYTE);
-  case 2:
-    m_fifo.push_back(writeBits >> BITS_PER_BYTE);
-  case 1:
-    m_fifo.push_back(writeBits);
+    m_numHeldBits -= BITS_PER_BYTE;
+    m_fifo.push_back(uint8_t(m_heldBits >> m_numHeldBits));
   }
-
-  m_heldBits    = nextHeldBits;
-  m_numHeldBits = nextNumHeldBits;
 }
 
 void OutputBitstream::writeAlignOne()
@@ -153,13 +149,7 @@ void OutputBitstream::writeAlignOne()
 
 void OutputBitstream::writeAlignZero()
 {
-  if (0 == m_numHeldBits)
-  {
-    return;
-  }
-  m_fifo.push_back(m_heldBits);
-  m_heldBits    = 0;
-  m_numHeldBits = 0;
+  write(0, getNumBitsUntilByteAligned());
 }
 
 /**
@@ -169,19 +159,33 @@ void OutputBitstream::writeAlignZero()
  */
 void   OutputBitstream::addSubstream( OutputBitstream* pcSubstream )
 {
-  uint32_t numBits = pcSubstream->getNumberOfWrittenBits();
-
   const std::vector<uint8_t> &rbsp = pcSubstream->getFifo();
-  for (const uint8_t byte: rbsp)
+  flushBytes();
+  if (m_numHeldBits == 0)
   {
-    write(byte, BITS_PER_BYTE);
+    m_fifo.insert(m_fifo.end(), rbsp.begin(), rbsp.end());
+  }
+  else
+  {
+    // the bytes are shifted into place a word at a time
+    size_t pos = 0;
+    for (; pos + 4 <= rbsp.size(); pos += 4)
+    {
+      write((rbsp[pos] << 3 * BITS_PER_BYTE) | (rbsp[pos + 1] << 2 * BITS_PER_BYTE) | (rbsp[pos + 2] << BITS_PER_BYTE)
+              | rbsp[pos + 3],
+            BITS_PER_WORD);
+    }
+    for (; pos < rbsp.size(); pos++)
+    {
+      write(rbsp[pos], BITS_PER_BYTE);
+    }
   }
 
-  const uint32_t numTrailingBits = numBits & BITS_PER_BYTE_MASK;
+  const uint32_t numTrailingBits = pcSubstream->m_numHeldBits;
 
   if (numTrailingBits != 0)
   {
-    write(pcSubstream->getHeldBits() >> (BITS_PER_BYTE - numTrailingBits), numTrailingBits);
+    write(uint32_t(pcSubstream->m_heldBits) & ((1 << numTrailingBits) - 1), numTrailingBits);
   }
 }
 
@@ -193,31 +197,34 @@ void OutputBitstream::writeByteAlignment()
 
 int OutputBitstream::countStartCodeEmulations()
 {
+  flushBytes();
+  const uint8_t *rbsp = m_fifo.data();
+  const size_t   size = m_fifo.size();
+
+  // find each 00 00 {00,01,02,03}, the zero bytes are located with memchr(), which is vectorised by the C library
   uint32_t cnt = 0;
-  std::vector<uint8_t> &rbsp = getFifo();
-  for (std::vector<uint8_t>::iterator it = rbsp.begin(); it != rbsp.end();)
+  size_t   pos = 0;
+  while (pos + 2 < size)
   {
-    std::vector<uint8_t>::iterator found = it;
-    do
+    const uint8_t *zero = (const uint8_t *) memchr(rbsp + pos, 0, size - 2 - pos);
+    if (zero == nullptr)
     {
-      // find the next emulated 00 00 {00,01,02,03}
-      // NB, end()-1, prevents finding a trailing two byte sequence
-      found = search_n(found, rbsp.end()-1, 2, 0);
-      found++;
-      // if not found, found == end, otherwise found = second zero byte
-      if (found == rbsp.end())
-      {
-        break;
-      }
-      if (*(++found) <= 3)
-      {
-        break;
-      }
-    } while (true);
-    it = found;
-    if (found != rbsp.end())
+      break;
+    }
+    pos = zero - rbsp;
+    if (rbsp[pos + 1] != 0)
     {
+      pos += 2;
+    }
+    else if (rbsp[pos + 2] <= 3)
+    {
+      // the emulation prevention byte restarts the zero count
       cnt++;
+      pos += 2;
+    }
+    else
+    {
+      pos += 3;
     }
   }
   return cnt;
@@ -285,7 +292,7 @@ void InputBitstream::read(uint32_t numberOfBits, uint32_t &ruiBits)
    */
   uint32_t alignedWord       = 0;
   uint32_t num_bytes_to_load = (numberOfBits - 1) >> BITS_PER_BYTE_LOG2;
-  CHECK(m_fifoIdx + num_bytes_to_load >= m_fifo.size(), "Exceeded FIFO size");
+  CHECK(m_fifoIdx + num_bytes_to_load >= getFifoEnd(), "Exceeded FIFO size");
 
   switch (num_bytes_to_load)
   {
@@ -316,11 +323,13 @@ void InputBitstream::read(uint32_t numberOfBits, uint32_t &ruiBits)
  * insert the contents of the bytealigned (and flushed) bitstream src
  * into this at byte position pos.
  */
-void OutputBitstream::insertAt(const OutputBitstream& src, uint32_t pos)
+void OutputBitstream::insertAt(OutputBitstream& src, uint32_t pos)
 {
   CHECK(0 != src.getNumberOfWrittenBits() % BITS_PER_BYTE, "Number of written bits is not a multiple of 8");
 
-  m_fifo.insert(m_fifo.begin() + pos, src.m_fifo.begin(), src.m_fifo.end());
+  const std::vector<uint8_t> &srcFifo = src.getFifo();
+  flushBytes();
+  m_fifo.insert(m_fifo.begin() + pos, srcFifo.begin(), srcFifo.end());
 }
 
 uint32_t InputBitstream::readOutTrailingBits ()
@@ -352,7 +361,7 @@ InputBitstream *InputBitstream::extractSubstream(uint32_t numBits)
   if (m_numHeldBits == 0)
   {
     const size_t   currentOutputBufferSize = buf.size();
-    const uint32_t numBytesToReadFromFifo  = std::min<uint32_t>(numBytes, (uint32_t) m_fifo.size() - m_fifoIdx);
+    const uint32_t numBytesToReadFromFifo  = std::min<uint32_t>(numBytes, getFifoEnd() - m_fifoIdx);
     buf.resize(currentOutputBufferSize + numBytes);
     if (!buf.empty())
     {
@@ -387,6 +396,24 @@ InputBitstream *InputBitstream::extractSubstream(uint32_t numBits)
   return pResult;
 }
 
+/**
+ Restrict reading to a substream of the current bitstream, without copying it.
+
+ The read position is moved to the start of the substream and reading beyond its end is an error, as for a bitstream
+ returned by extractSubstream(). The restriction is lifted by resetToStart().
+
+ \param  byteStart  byte position of the substream in the FIFO
+ \param  numBytes   number of bytes of the substream
+ */
+void InputBitstream::setSubstream(uint32_t byteStart, uint32_t numBytes)
+{
+  CHECK(byteStart + numBytes > m_fifo.size(), "Substream exceeds the FIFO");
+  m_fifoIdx       = byteStart;
+  m_fifoEndOffset = (uint32_t) m_fifo.size() - byteStart - numBytes;
+  m_numHeldBits   = 0;
+  m_heldBits      = 0;
+}
+
 uint32_t InputBitstream::readByteAlignment()
 {
   uint32_t code = 0;
@@ -72,9 +72,15 @@ class OutputBitstream
    */
   std::vector<uint8_t> m_fifo;
 
-  uint32_t m_numHeldBits;   /// number of bits not flushed to bytestream.
-  uint8_t  m_heldBits;      /// the bits held and not flushed to bytestream.
-                            /// this value is always msb-aligned, bigendian.
+  uint32_t m_numHeldBits;   /// number of bits not flushed to bytestream, less than 32 after each write().
+  uint64_t m_heldBits;      /// the bits held and not flushed to bytestream.
+                            /// these are the m_numHeldBits least significant bits, bigendian.
+
+  static constexpr size_t FIFO_RESERVE_SIZE = 1 << 12;   /// initial capacity of the FIFO in bytes
+
+  /** move the whole bytes of the held bits to the FIFO */
+  void flushBytes();
+
 public:
   // create / destroy
   OutputBitstream();
@@ -87,6 +93,19 @@ public:
    */
   void write(uint32_t bits, uint32_t numberOfBits);
 
+  /** append one byte, without any bit shifting when the bitstream is byte-aligned */
+  void writeByte(uint32_t byte)
+  {
+    if (m_numHeldBits == 0)
+    {
+      m_fifo.push_back(uint8_t(byte));
+    }
+    else
+    {
+      write(byte, 8);
+    }
+  }
+
   /** insert one bits until the bitstream is byte-aligned */
   void        writeAlignOne   ();
 
@@ -101,7 +120,7 @@ public:
    * NB, data is arranged such that subsequent bytes in the
    * bytestream are stored in ascending addresses.
    */
-  const uint8_t *getByteStream() const;
+  const uint8_t *getByteStream();
 
   /**
    * Return the number of valid bytes available from  getByteStream()
@@ -124,17 +143,23 @@ public:
    */
   uint32_t getNumberOfWrittenBits() const { return uint32_t(m_fifo.size()) * 8 + m_numHeldBits; }
 
-  void insertAt(const OutputBitstream& src, uint32_t pos);
+  void insertAt(OutputBitstream& src, uint32_t pos);
 
   /**
-   * Return a reference to the internal fifo
+   * Return a reference to the internal fifo, holding all whole bytes written so far
    */
-  std::vector<uint8_t> &getFifo() { return m_fifo; }
-
-  uint8_t getHeldBits() { return m_heldBits; }
+  std::vector<uint8_t> &getFifo()
+  {
+    flushBytes();
+    return m_fifo;
+  }
 
-  /** Return a reference to the internal fifo */
-  const std::vector<uint8_t> &getFifo() const { return m_fifo; }
+  /** return the bits of the last partial byte, msb-aligned */
+  uint8_t getHeldBits()
+  {
+    flushBytes();
+    return uint8_t(m_heldBits << (BITS_PER_BYTE - m_numHeldBits));
+  }
 
   void          addSubstream    ( OutputBitstream* pcSubstream );
   void writeByteAlignment();
@@ -154,6 +179,7 @@ protected:
   std::vector<uint32_t>    m_emulationPreventionByteLocation;
 
   uint32_t m_fifoIdx;   /// Read index into m_fifo
+  uint32_t m_fifoEndOffset;   /// Number of bytes at the end of m_fifo that are outside the current substream
 
   uint32_t  m_numHeldBits;
   uint8_t   m_heldBits;
@@ -174,13 +200,23 @@ public:
   void        read(uint32_t numberOfBits, uint32_t &ruiBits);
   void        readByte        ( uint32_t &ruiBits )
   {
-    CHECK(m_fifoIdx >= m_fifo.size(), "FIFO exceeded");
+    CHECK(m_fifoIdx >= getFifoEnd(), "FIFO exceeded");
     ruiBits = m_fifo[m_fifoIdx++];
 #if ENABLE_TRACING
     m_numBitsRead += 8;
 #endif
   }
 
+  // Skips whole bytes, used after the bytes have been read in place through getFifo()
+  void        skipBytes       ( uint32_t numBytes )
+  {
+    CHECK(m_fifoIdx + numBytes > getFifoEnd(), "FIFO exceeded");
+    m_fifoIdx += numBytes;
+#if ENABLE_TRACING
+    m_numBitsRead += 8 * numBytes;
+#endif
+  }
+
   void        peekPreviousByte( uint32_t &byte )
   {
     CHECK(m_fifoIdx == 0, "FIFO empty");
@@ -204,8 +240,9 @@ public:
   uint32_t read(uint32_t numberOfBits)      { uint32_t tmp; read(numberOfBits, tmp); return tmp; }
   uint32_t readByte()                   { uint32_t tmp; readByte( tmp ); return tmp; }
   uint32_t        getNumBitsUntilByteAligned() { return m_numHeldBits & (0x7); }
-  uint32_t        getNumBitsLeft() { return 8 * ((uint32_t) m_fifo.size() - m_fifoIdx) + m_numHeldBits; }
+  uint32_t        getNumBitsLeft() { return 8 * (getFifoEnd() - m_fifoIdx) + m_numHeldBits; }
   InputBitstream *extractSubstream(uint32_t numBits);   // Read the nominated number of bits, and return as a bitstream.
+  void            setSubstream(uint32_t byteStart, uint32_t numBytes);   // Read the nominated bytes in place as a substream.
   uint32_t  getNumBitsRead()            { return m_numBitsRead; }
   uint32_t  readByteAlignment();
 
@@ -218,6 +255,9 @@ public:
 
   const std::vector<uint8_t> &getFifo() const { return m_fifo; }
         std::vector<uint8_t> &getFifo()       { return m_fifo; }
+
+private:
+  uint32_t getFifoEnd() const { return (uint32_t) m_fifo.size() - m_fifoEndOffset; }
 };
 
 //! \}
@@ -274,6 +274,18 @@ PelBufferOps::PelBufferOps()
 
   copyBuffer = copyBufferCore;
   padding = paddingCore;
+  extendHor  = extendHorCore;
+  applyLut   = applyLutCore;
+  dmvrSads   = dmvrSadsCore;
+  calcSse    = calcSseCore;
+
+  filterScaledHor    = filterScaledHorCore<int>;
+  filterScaledHorPel = filterScaledHorCore<Pel>;
+  filterScaledVer    = filterScaledVerCore;
+
+  unpackSamples = unpackSamplesCore;
+  packSamples   = packSamplesCore;
+  scaleSamples  = scaleSamplesCore;
 #if ENABLE_SIMD_OPT_BCW
   removeWeightHighFreq8 = nullptr;
   removeWeightHighFreq4 = nullptr;
@@ -297,6 +309,115 @@ void copyBufferCore(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dst
   }
 }
 
+void applyLutCore(Pel *ptr, ptrdiff_t stride, int width, int height, const Pel *lut)
+{
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      ptr[x] = lut[ptr[x]];
+    }
+    ptr += stride;
+  }
+}
+
+// SADs of all DMVR_AREA integer offsets in raster order, on every second row. src0 and src1 point to the top-left
+// sample of the search windows, list 0 is displaced by the offset and list 1 by its negation.
+void dmvrSadsCore(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width, int height,
+                  uint32_t *sads)
+{
+  for (int v = -DMVR_RANGE; v <= DMVR_RANGE; v++)
+  {
+    for (int h = -DMVR_RANGE; h <= DMVR_RANGE; h++)
+    {
+      const Pel *p0  = src0 + (DMVR_RANGE + v) * src0Stride + DMVR_RANGE + h;
+      const Pel *p1  = src1 + (DMVR_RANGE - v) * src1Stride + DMVR_RANGE - h;
+      uint32_t   sum = 0;
+
+      for (int y = 0; y < height; y += 2)
+      {
+        for (int x = 0; x < width; x++)
+        {
+          sum += abs(p0[x] - p1[x]);
+        }
+        p0 += 2 * src0Stride;
+        p1 += 2 * src1Stride;
+      }
+
+      *sads++ = sum;
+    }
+  }
+}
+
+// sum of squared differences over a whole plane, as used for the PSNR computation
+uint64_t calcSseCore(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width,
+                     int height)
+{
+  uint64_t sum = 0;
+
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      const Intermediate_Int diff = src0[x] - src1[x];
+      sum += uint64_t(diff * diff);
+    }
+    src0 += src0Stride;
+    src1 += src1Stride;
+  }
+
+  return sum;
+}
+
+// horizontal filter with its own source position and filter phase for each output column, as used for reference
+// picture resampling: srcPos[x] is the position of the first tap and coeff holds numTaps taps for each column
+template<typename T>
+void filterScaledHorCore(const Pel *src, ptrdiff_t srcStride, T *dst, ptrdiff_t dstStride, int width, int height,
+                         const int *srcPos, const TFilterCoeff *coeff, int numTaps, int shift, int offset)
+{
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      const Pel          *s = src + srcPos[x];
+      const TFilterCoeff *c = coeff + x * numTaps;
+
+      int sum = 0;
+      for (int k = 0; k < numTaps; k++)
+      {
+        sum += c[k] * s[k];
+      }
+      dst[x] = T((sum + offset) >> shift);
+    }
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+template void filterScaledHorCore<int>(const Pel *src, ptrdiff_t srcStride, int *dst, ptrdiff_t dstStride, int width,
+                                       int height, const int *srcPos, const TFilterCoeff *coeff, int numTaps,
+                                       int shift, int offset);
+template void filterScaledHorCore<Pel>(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width,
+                                       int height, const int *srcPos, const TFilterCoeff *coeff, int numTaps,
+                                       int shift, int offset);
+
+// vertical filter of one output row over the rows of the horizontally filtered intermediate picture
+void filterScaledVerCore(const int *const *srcRows, int numTaps, const TFilterCoeff *coeff, Pel *dst, int width,
+                         int shift, int maxVal)
+{
+  const int offset = 1 << (shift - 1);
+
+  for (int x = 0; x < width; x++)
+  {
+    int sum = 0;
+    for (int k = 0; k < numTaps; k++)
+    {
+      sum += coeff[k] * srcRows[k][x];
+    }
+    dst[x] = Pel(std::min<int>(std::max(0, (sum + offset) >> shift), maxVal));
+  }
+}
+
 void paddingCore(Pel *ptr, ptrdiff_t stride, int width, int height, int padSize)
 {
   /*left and right padding*/
@@ -321,6 +442,74 @@ void paddingCore(Pel *ptr, ptrdiff_t stride, int width, int height, int padSize)
     memcpy(ptrTemp2 + i * stride, (ptrTemp2), numBytes);
   }
 }
+
+// replicates the first and last sample of each row into the margin samples on the left and right
+void extendHorCore(Pel *ptr, ptrdiff_t stride, int width, int height, int margin)
+{
+  for (int y = 0; y < height; y++)
+  {
+    std::fill_n(ptr - margin, margin, ptr[0]);
+    std::fill_n(ptr + width, margin, ptr[width - 1]);
+    ptr += stride;
+  }
+}
+
+// converts a line of 8-bit or 16-bit little-endian file samples to Pel; a positive scaleX takes every
+// (1 << scaleX)-th file sample, a negative one repeats each file sample (1 << -scaleX) times
+void unpackSamplesCore(const uint8_t *src, bool is16bit, Pel *dst, int width, int scaleX)
+{
+  for (int x = 0; x < width; x++)
+  {
+    const int pos = scaleX >= 0 ? x << scaleX : x >> -scaleX;
+    dst[x]        = is16bit ? Pel(src[2 * pos] | (src[2 * pos + 1] << 8)) : Pel(src[pos]);
+  }
+}
+
+// converts a line of Pel to 8-bit or 16-bit little-endian file samples, keeping the low-order bits
+void packSamplesCore(const Pel *src, uint8_t *dst, bool is16bit, int width)
+{
+  for (int x = 0; x < width; x++)
+  {
+    if (is16bit)
+    {
+      dst[2 * x]     = (src[x] >> 0) & 0xff;
+      dst[2 * x + 1] = (src[x] >> 8) & 0xff;
+    }
+    else
+    {
+      dst[x] = (uint8_t) src[x];
+    }
+  }
+}
+
+// multiplies by (1 << shift) for a positive shift, or divides with rounding by (1 << -shift) and clips for a
+// negative one
+void scaleSamplesCore(Pel *ptr, ptrdiff_t stride, int width, int height, int shift, Pel minVal, Pel maxVal)
+{
+  if (shift > 0)
+  {
+    for (int y = 0; y < height; y++, ptr += stride)
+    {
+      for (int x = 0; x < width; x++)
+      {
+        ptr[x] <<= shift;
+      }
+    }
+  }
+  else if (shift < 0)
+  {
+    const int shiftRight = -shift;
+    const Pel rounding   = 1 << (shiftRight - 1);
+
+    for (int y = 0; y < height; y++, ptr += stride)
+    {
+      for (int x = 0; x < width; x++)
+      {
+        ptr[x] = Clip3(minVal, maxVal, Pel((ptr[x] + rounding) >> shiftRight));
+      }
+    }
+  }
+}
 template<>
 void AreaBuf<Pel>::addWeightedAvg(const AreaBuf<const Pel> &other1, const AreaBuf<const Pel> &other2, const ClpRng& clpRng, const int8_t bcwIdx)
 {
@@ -354,17 +543,7 @@ void AreaBuf<Pel>::addWeightedAvg(const AreaBuf<const Pel> &other1, const AreaBu
 template<>
 void AreaBuf<Pel>::rspSignal(std::vector<Pel>& pLUT)
 {
-  Pel* dst = buf;
-  Pel* src = buf;
-  for (unsigned y = 0; y < height; y++)
-  {
-    for (unsigned x = 0; x < width; x++)
-    {
-      dst[x] = pLUT[src[x]];
-    }
-    dst += stride;
-    src += stride;
-  }
+  g_pelBufOP.applyLut(buf, stride, width, height, pLUT.data());
 }
 
 template<>
@@ -91,6 +91,22 @@ struct PelBufferOps
   void(*calcBlkGradient)(int sx, int sy, int    *arraysGx2, int     *arraysGxGy, int     *arraysGxdI, int     *arraysGy2, int     *arraysGydI, int     &sGx2, int     &sGy2, int     &sGxGy, int     &sGxdI, int     &sGydI, int width, int height, int unitSize);
   void (*copyBuffer)(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height);
   void (*padding)(Pel *dst, ptrdiff_t stride, int width, int height, int padSize);
+  void (*extendHor)(Pel *dst, ptrdiff_t stride, int width, int height, int margin);
+  void (*applyLut)(Pel *ptr, ptrdiff_t stride, int width, int height, const Pel *lut);
+  void (*dmvrSads)(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width, int height,
+                   uint32_t *sads);
+  uint64_t (*calcSse)(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width,
+                      int height);
+  void (*filterScaledHor)(const Pel *src, ptrdiff_t srcStride, int *dst, ptrdiff_t dstStride, int width, int height,
+                          const int *srcPos, const TFilterCoeff *coeff, int numTaps, int shift, int offset);
+  void (*filterScaledHorPel)(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width,
+                             int height, const int *srcPos, const TFilterCoeff *coeff, int numTaps, int shift,
+                             int offset);
+  void (*filterScaledVer)(const int *const *srcRows, int numTaps, const TFilterCoeff *coeff, Pel *dst, int width,
+                          int shift, int maxVal);
+  void (*unpackSamples)(const uint8_t *src, bool is16bit, Pel *dst, int width, int scaleX);
+  void (*packSamples)(const Pel *src, uint8_t *dst, bool is16bit, int width);
+  void (*scaleSamples)(Pel *ptr, ptrdiff_t stride, int width, int height, int shift, Pel minVal, Pel maxVal);
 #if ENABLE_SIMD_OPT_BCW
   void (*removeWeightHighFreq8)(Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width,
                                 int height, int bcwWeight, const Pel minVal, const Pel maxVal);
@@ -112,7 +128,21 @@ struct PelBufferOps
 extern PelBufferOps g_pelBufOP;
 
 void paddingCore(Pel *ptr, ptrdiff_t stride, int width, int height, int padSize);
+void extendHorCore(Pel *ptr, ptrdiff_t stride, int width, int height, int margin);
 void copyBufferCore(const Pel *src, ptrdiff_t srcStride, Pel *Dst, ptrdiff_t dstStride, int width, int height);
+void applyLutCore(Pel *ptr, ptrdiff_t stride, int width, int height, const Pel *lut);
+void dmvrSadsCore(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width, int height,
+                  uint32_t *sads);
+uint64_t calcSseCore(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width,
+                     int height);
+template<typename T>
+void filterScaledHorCore(const Pel *src, ptrdiff_t srcStride, T *dst, ptrdiff_t dstStride, int width, int height,
+                         const int *srcPos, const TFilterCoeff *coeff, int numTaps, int shift, int offset);
+void filterScaledVerCore(const int *const *srcRows, int numTaps, const TFilterCoeff *coeff, Pel *dst, int width,
+                         int shift, int maxVal);
+void unpackSamplesCore(const uint8_t *src, bool is16bit, Pel *dst, int width, int scaleX);
+void packSamplesCore(const Pel *src, uint8_t *dst, bool is16bit, int width);
+void scaleSamplesCore(Pel *ptr, ptrdiff_t stride, int width, int height, int shift, Pel minVal, Pel maxVal);
 
 template<typename T>
 struct AreaBuf : public Size
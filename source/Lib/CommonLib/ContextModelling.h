@@ -88,6 +88,7 @@ public:
   bool            isSigGroup      ()                        const { return m_sigCoeffGroupFlag[ m_subSetPos ]; }
   bool            signHiding      ()                        const { return m_signHiding; }
   bool hideSign(int posFirst, int posLast) const { return (m_signHiding && (posLast - posFirst >= SBH_THRESHOLD)); }
+  const ScanElement *scan() const { return m_scan; }
   unsigned        blockPos(int scanPos) const { return m_scan[scanPos].idx; }
   unsigned        posX(int scanPos) const { return m_scan[scanPos].x; }
   unsigned        posY(int scanPos) const { return m_scan[scanPos].y; }
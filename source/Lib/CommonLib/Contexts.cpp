@@ -887,65 +887,85 @@ const CtxSet ContextSetCfg::ctxPartition = { ContextSetCfg::SplitFlag, ContextSe
                                              ContextSetCfg::SplitHvFlag, ContextSetCfg::Split12Flag,
                                              ContextSetCfg::ModeConsFlag };
 
-template<class BinProbModel> CtxStore<BinProbModel>::CtxStore() : m_ctxBuffer(), m_ctx(nullptr) {}
+template<class BinProbModel>
+CtxStore<BinProbModel>::CtxStore()
+  : m_ctxBuffer(), m_ctx(nullptr), m_dirty(0), m_version(++s_version), m_syncSrc(nullptr), m_syncVersion(0)
+{}
 
 template<class BinProbModel>
-CtxStore<BinProbModel>::CtxStore(bool dummy) : m_ctxBuffer(ContextSetCfg::NumberOfContexts), m_ctx(m_ctxBuffer.data())
+CtxStore<BinProbModel>::CtxStore(bool dummy)
+  : m_ctxBuffer(getBufferSize())
+  , m_ctx(m_ctxBuffer.data())
+  , m_dirty(0)
+  , m_version(++s_version)
+  , m_syncSrc(nullptr)
+  , m_syncVersion(0)
 {}
 
 template<class BinProbModel>
 CtxStore<BinProbModel>::CtxStore(const CtxStore<BinProbModel> &ctxStore)
-  : m_ctxBuffer(ctxStore.m_ctxBuffer), m_ctx(m_ctxBuffer.data())
+  : m_ctxBuffer(ctxStore.m_ctxBuffer)
+  , m_ctx(m_ctxBuffer.data())
+  , m_dirty(0)
+  , m_version(++s_version)
+  , m_syncSrc(nullptr)
+  , m_syncVersion(0)
 {}
 
 template <class BinProbModel>
 void CtxStore<BinProbModel>::init( int qp, int initId )
 {
   const std::vector<uint8_t>& initTable = ContextSetCfg::getInitTable( initId );
-  CHECK(m_ctxBuffer.size() != initTable.size(), "Size of init table (" << initTable.size()
-                                                                       << ") does not match size of context buffer ("
-                                                                       << m_ctxBuffer.size() << ").");
+  CHECK(ContextSetCfg::NumberOfContexts != initTable.size(),
+        "Size of init table (" << initTable.size() << ") does not match number of contexts ("
+                               << ContextSetCfg::NumberOfContexts << ").");
   const std::vector<uint8_t> &rateInitTable = ContextSetCfg::getInitTable(NUMBER_OF_SLICE_TYPES);
-  CHECK(m_ctxBuffer.size() != rateInitTable.size(),
-        "Size of rate init table (" << rateInitTable.size() << ") does not match size of context buffer ("
-                                    << m_ctxBuffer.size() << ").");
+  CHECK(ContextSetCfg::NumberOfContexts != rateInitTable.size(),
+        "Size of rate init table (" << rateInitTable.size() << ") does not match number of contexts ("
+                                    << ContextSetCfg::NumberOfContexts << ").");
+  checkInit();
   int clippedQP = Clip3( 0, MAX_QP, qp );
-  for (std::size_t k = 0; k < m_ctxBuffer.size(); k++)
+  for (std::size_t k = 0; k < ContextSetCfg::NumberOfContexts; k++)
   {
     m_ctxBuffer[k].init(clippedQP, initTable[k]);
     m_ctxBuffer[k].setLog2WindowSize(rateInitTable[k]);
   }
+  invalidate();
 }
 
 template <class BinProbModel>
 void CtxStore<BinProbModel>::setWinSizes( const std::vector<uint8_t>& log2WindowSizes )
 {
-  CHECK(m_ctxBuffer.size() != log2WindowSizes.size(),
-        "Size of window size table (" << log2WindowSizes.size() << ") does not match size of context buffer ("
-                                      << m_ctxBuffer.size() << ").");
-  for (std::size_t k = 0; k < m_ctxBuffer.size(); k++)
+  CHECK(ContextSetCfg::NumberOfContexts != log2WindowSizes.size(),
+        "Size of window size table (" << log2WindowSizes.size() << ") does not match number of contexts ("
+                                      << ContextSetCfg::NumberOfContexts << ").");
+  checkInit();
+  for (std::size_t k = 0; k < ContextSetCfg::NumberOfContexts; k++)
   {
     m_ctxBuffer[k].setLog2WindowSize(log2WindowSizes[k]);
   }
+  invalidate();
 }
 
 template <class BinProbModel>
 void CtxStore<BinProbModel>::loadPStates( const std::vector<uint16_t>& probStates )
 {
-  CHECK(m_ctxBuffer.size() != probStates.size(), "Size of prob states table ("
-                                                   << probStates.size() << ") does not match size of context buffer ("
-                                                   << m_ctxBuffer.size() << ").");
-  for (std::size_t k = 0; k < m_ctxBuffer.size(); k++)
+  CHECK(ContextSetCfg::NumberOfContexts != probStates.size(), "Size of prob states table ("
+                                                   << probStates.size() << ") does not match number of contexts ("
+                                                   << ContextSetCfg::NumberOfContexts << ").");
+  checkInit();
+  for (std::size_t k = 0; k < ContextSetCfg::NumberOfContexts; k++)
   {
     m_ctxBuffer[k].setState(probStates[k]);
   }
+  invalidate();
 }
 
 template <class BinProbModel>
 void CtxStore<BinProbModel>::savePStates( std::vector<uint16_t>& probStates ) const
 {
-  probStates.resize(m_ctxBuffer.size(), uint16_t(0));
-  for (std::size_t k = 0; k < m_ctxBuffer.size(); k++)
+  probStates.resize(ContextSetCfg::NumberOfContexts, uint16_t(0));
+  for (std::size_t k = 0; k < ContextSetCfg::NumberOfContexts; k++)
   {
     probStates[k] = m_ctxBuffer[k].getState();
   }
@@ -41,8 +41,13 @@
 #include "CommonDef.h"
 #include "Slice.h"
 
+#include <atomic>
 #include <vector>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 static constexpr int     PROB_BITS   = 15;   // Nominal number of bits to represent probabilities
 static constexpr int     PROB_BITS_0 = 10;   // Number of bits to represent 1st estimate
 static constexpr int     PROB_BITS_1 = 14;   // Number of bits to represent 2nd estimate
@@ -304,15 +309,41 @@ public:
 public:
   void copyFrom(const CtxStore<BinProbModel> &src)
   {
+    if (&src == this)
+    {
+      return;
+    }
     checkInit();
-    std::copy_n(reinterpret_cast<const char *>(src.m_ctx), sizeof(BinProbModel) * ContextSetCfg::NumberOfContexts,
-                reinterpret_cast<char *>(m_ctx));
+    if (m_syncSrc == &src && m_syncVersion == src.m_version)
+    {
+      // both stores only changed in their dirty chunks since the last copy from src
+      uint64_t dirty = m_dirty | src.m_dirty;
+      while (dirty)
+      {
+        const int      chunk  = ctz64(dirty);
+        const unsigned offset = chunk << CHUNK_LOG2;
+        std::copy_n(src.m_ctx + offset, CHUNK_SIZE, m_ctx + offset);
+        dirty &= dirty - 1;
+      }
+    }
+    else
+    {
+      std::copy_n(reinterpret_cast<const char *>(src.m_ctx), sizeof(BinProbModel) * ContextSetCfg::NumberOfContexts,
+                  reinterpret_cast<char *>(m_ctx));
+    }
+    m_syncSrc     = &src;
+    m_syncVersion = src.m_version;
+    m_dirty       = 0;
+    m_version     = ++s_version;
   }
   void copyFrom(const CtxStore<BinProbModel> &src, const CtxSet &ctxSet)
   {
     checkInit();
     std::copy_n(reinterpret_cast<const char *>(src.m_ctx + ctxSet.Offset), sizeof(BinProbModel) * ctxSet.Size,
                 reinterpret_cast<char *>(m_ctx + ctxSet.Offset));
+    const unsigned first = ctxSet.Offset >> CHUNK_LOG2;
+    const unsigned last  = (ctxSet.Offset + ctxSet.Size - 1) >> CHUNK_LOG2;
+    m_dirty |= (uint64_t(2) << last) - (uint64_t(1) << first);
   }
   void init       ( int qp, int initId );
   void setWinSizes( const std::vector<uint8_t>&   log2WindowSizes );
@@ -320,7 +351,11 @@ public:
   void savePStates( std::vector<uint16_t>&        probStates )  const;
 
   const BinProbModel &operator[](unsigned ctxId) const { return m_ctx[ctxId]; }
-  BinProbModel       &operator[](unsigned ctxId) { return m_ctx[ctxId]; }
+  BinProbModel       &operator[](unsigned ctxId)
+  {
+    m_dirty |= uint64_t(1) << (ctxId >> CHUNK_LOG2);
+    return m_ctx[ctxId];
+  }
   uint32_t            estFracBits(unsigned bin, unsigned ctxId) const { return m_ctx[ctxId].estFracBits(bin); }
 
   BinFracBits getFracBitsArray(unsigned ctxId) const { return m_ctx[ctxId].getFracBitsArray(); }
@@ -332,15 +367,65 @@ private:
     {
       return;
     }
-    m_ctxBuffer.resize(ContextSetCfg::NumberOfContexts);
+    m_ctxBuffer.resize(getBufferSize());
     m_ctx = m_ctxBuffer.data();
   }
 
+  // the buffer is padded to whole chunks
+  static unsigned getBufferSize()
+  {
+    CHECK(ContextSetCfg::NumberOfContexts > 64 * CHUNK_SIZE, "Too many contexts for the partial copies");
+    return (ContextSetCfg::NumberOfContexts + CHUNK_SIZE - 1) & ~(CHUNK_SIZE - 1);
+  }
+
+  // called after all contexts have been changed, the next copies from and to this store copy all of them
+  void invalidate()
+  {
+    m_syncSrc = nullptr;
+    m_version = ++s_version;
+  }
+
+  static int ctz64(uint64_t x)
+  {
+#ifdef __GNUC__
+    return __builtin_ctzll(x);
+#else
+#ifdef _MSC_VER
+    unsigned long r = 0;
+    _BitScanForward64(&r, x);
+    return r;
+#else
+    int result = 0;
+    while (!(x & 1))
+    {
+      x >>= 1;
+      result++;
+    }
+    return result;
+#endif
+#endif
+  }
+
 private:
+  // The contexts are split into 64 chunks for the partial copies. A store knows the store it was last fully copied
+  // from and the chunks written since, the chunks written to the source store are tracked by the source itself.
+  // Any other change gives the store a new version, which forces the next copy to be a full one.
+  static constexpr unsigned CHUNK_LOG2 = 3;
+  static constexpr unsigned CHUNK_SIZE = 1 << CHUNK_LOG2;
+
+  // shared by the stores of all threads, e.g. of the tile substreams written concurrently
+  static std::atomic<uint64_t> s_version;
+
   std::vector<BinProbModel> m_ctxBuffer;
   BinProbModel             *m_ctx;
+  uint64_t                  m_dirty;
+  uint64_t                  m_version;
+  const CtxStore           *m_syncSrc;
+  uint64_t                  m_syncVersion;
 };
 
+template <class BinProbModel> std::atomic<uint64_t> CtxStore<BinProbModel>::s_version{ 0 };
+
 
 
 class Ctx;
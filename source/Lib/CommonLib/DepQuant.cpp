@@ -62,14 +62,6 @@ namespace DQIntern
     uint16_t  num;
     uint16_t  outPos[5];
   };
-  struct CoeffFracBits
-  {
-    int32_t   bits[6];
-  };
-
-
-  enum ScanPosType { SCAN_ISCSBB = 0, SCAN_SOCSBB = 1, SCAN_EOCSBB = 2 };
-
   struct ScanInfo
   {
     ScanInfo() {}
@@ -614,30 +606,6 @@ namespace DQIntern
 
 
 
-  /*================================================================================*/
-  /*=====                                                                      =====*/
-  /*=====   D A T A   S T R U C T U R E S                                      =====*/
-  /*=====                                                                      =====*/
-  /*================================================================================*/
-
-
-  struct PQData
-  {
-    TCoeff  absLevel;
-    int64_t deltaDist;
-  };
-
-
-  struct Decision
-  {
-    int64_t rdCost;
-    TCoeff  absLevel;
-    int     prevId;
-  };
-
-
-
-
   /*================================================================================*/
   /*=====                                                                      =====*/
   /*=====   P R E - Q U A N T I Z E R                                          =====*/
@@ -873,14 +841,7 @@ namespace DQIntern
     uint8_t                     m_memory[ 8 * ( MAX_TB_SIZEY * MAX_TB_SIZEY + MLS_GRP_NUM ) ];
   };
 
-#if JVET_V0106_DEP_QUANT_ENC_OPT
-#define RICEMAX 64
-#define RICE_ORDER_MAX 16
   const int32_t g_goRiceBits[RICE_ORDER_MAX][RICEMAX] =
-#else
-#define RICEMAX 32
-  const int32_t g_goRiceBits[4][RICEMAX] =
-#endif
   {
 #if JVET_V0106_DEP_QUANT_ENC_OPT
     { 32768, 65536, 98304, 131072, 163840, 196608, 262144, 262144, 327680, 327680, 327680, 327680, 393216, 393216, 393216, 393216, 393216, 393216, 393216, 393216, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 458752, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288, 524288 },
@@ -907,11 +868,123 @@ namespace DQIntern
 #endif
   };
 
+  static inline void checkRdCostsState(const StateMem &mem, const int8_t stateId, const ScanPosType spt,
+                                       const int32_t (*goRiceBits)[RICEMAX], const PQData &pqDataA,
+                                       const PQData &pqDataB, Decision &decisionA, Decision &decisionB)
+  {
+    const BinFracBits   &sigFracBits   = mem.sigFracBits[stateId];
+    const BinFracBits   &sbbFracBits   = mem.sbbFracBits[stateId];
+    const CoeffFracBits &coeffFracBits = mem.coeffFracBits[stateId];
+    const int32_t       *goRiceTab     = goRiceBits[mem.goRicePar[stateId]];
+    const int8_t         goRiceZero    = mem.goRiceZero[stateId];
+    int64_t              rdCostA       = mem.rdCost[stateId] + pqDataA.deltaDist;
+    int64_t              rdCostB       = mem.rdCost[stateId] + pqDataB.deltaDist;
+    int64_t              rdCostZ       = mem.rdCost[stateId];
+    if (mem.remRegBins[stateId] >= 4)
+    {
+      if (pqDataA.absLevel < 4)
+      {
+        rdCostA += coeffFracBits.bits[pqDataA.absLevel];
+      }
+      else
+      {
+        const TCoeff value = (pqDataA.absLevel - 4) >> 1;
+        rdCostA +=
+          coeffFracBits.bits[pqDataA.absLevel - (value << 1)] + goRiceTab[value < RICEMAX ? value : RICEMAX - 1];
+      }
+      if (pqDataB.absLevel < 4)
+      {
+        rdCostB += coeffFracBits.bits[pqDataB.absLevel];
+      }
+      else
+      {
+        const TCoeff value = (pqDataB.absLevel - 4) >> 1;
+        rdCostB +=
+          coeffFracBits.bits[pqDataB.absLevel - (value << 1)] + goRiceTab[value < RICEMAX ? value : RICEMAX - 1];
+      }
+      if (spt == SCAN_ISCSBB)
+      {
+        rdCostA += sigFracBits.intBits[1];
+        rdCostB += sigFracBits.intBits[1];
+        rdCostZ += sigFracBits.intBits[0];
+      }
+      else if (spt == SCAN_SOCSBB)
+      {
+        rdCostA += sbbFracBits.intBits[1] + sigFracBits.intBits[1];
+        rdCostB += sbbFracBits.intBits[1] + sigFracBits.intBits[1];
+        rdCostZ += sbbFracBits.intBits[1] + sigFracBits.intBits[0];
+      }
+      else if (mem.numSigSbb[stateId])
+      {
+        rdCostA += sigFracBits.intBits[1];
+        rdCostB += sigFracBits.intBits[1];
+        rdCostZ += sigFracBits.intBits[0];
+      }
+      else
+      {
+        rdCostZ = decisionA.rdCost;
+      }
+    }
+    else
+    {
+      rdCostA +=
+        (1 << SCALE_BITS)
+        + goRiceTab[pqDataA.absLevel <= goRiceZero ? pqDataA.absLevel - 1
+                                                   : (pqDataA.absLevel < RICEMAX ? pqDataA.absLevel : RICEMAX - 1)];
+      rdCostB +=
+        (1 << SCALE_BITS)
+        + goRiceTab[pqDataB.absLevel <= goRiceZero ? pqDataB.absLevel - 1
+                                                   : (pqDataB.absLevel < RICEMAX ? pqDataB.absLevel : RICEMAX - 1)];
+      rdCostZ += goRiceTab[goRiceZero];
+    }
+    if (rdCostA < decisionA.rdCost)
+    {
+      decisionA.rdCost   = rdCostA;
+      decisionA.absLevel = pqDataA.absLevel;
+      decisionA.prevId   = stateId;
+    }
+    if (rdCostZ < decisionA.rdCost)
+    {
+      decisionA.rdCost   = rdCostZ;
+      decisionA.absLevel = 0;
+      decisionA.prevId   = stateId;
+    }
+    if (rdCostB < decisionB.rdCost)
+    {
+      decisionB.rdCost   = rdCostB;
+      decisionB.absLevel = pqDataB.absLevel;
+      decisionB.prevId   = stateId;
+    }
+  }
+
+  static void checkRdCosts(const ScanPosType spt, const PQData *pqData, Decision *decisions,
+                           const StateMem &prevStates, const StateMem &skipStates,
+                           const int32_t (*goRiceBits)[RICEMAX])
+  {
+    checkRdCostsState(prevStates, 0, spt, goRiceBits, pqData[0], pqData[2], decisions[0], decisions[2]);
+    checkRdCostsState(prevStates, 1, spt, goRiceBits, pqData[0], pqData[2], decisions[2], decisions[0]);
+    checkRdCostsState(prevStates, 2, spt, goRiceBits, pqData[3], pqData[1], decisions[1], decisions[3]);
+    checkRdCostsState(prevStates, 3, spt, goRiceBits, pqData[3], pqData[1], decisions[3], decisions[1]);
+    if( spt==SCAN_EOCSBB )
+    {
+      for( int stateId = 0; stateId < 4; stateId++ )
+      {
+        int64_t rdCost = skipStates.rdCost[stateId] + skipStates.sbbFracBits[stateId].intBits[0];
+        if( rdCost < decisions[stateId].rdCost )
+        {
+          decisions[stateId].rdCost   = rdCost;
+          decisions[stateId].absLevel = 0;
+          decisions[stateId].prevId   = 4+stateId;
+        }
+      }
+    }
+  }
+
   class State
   {
     friend class CommonCtx;
   public:
-    State( const RateEstimator& rateEst, CommonCtx& commonCtx, const int stateId );
+    State( const RateEstimator& rateEst, CommonCtx& commonCtx, StateMem& stateMem, const int stateId );
 
     template<uint8_t numIPos>
     inline void updateState(const ScanInfo &scanInfo, const State *prevStates, const Decision &decision, const int baseLevel, const bool extRiceFlag);
@@ -929,88 +1002,8 @@ namespace DQIntern
       m_goRicePar     = 0;
       m_goRiceZero    = 0;
     }
-    void checkRdCosts( const ScanPosType spt, const PQData& pqDataA, const PQData& pqDataB, Decision& decisionA, Decision& decisionB ) const
-    {
-      const int32_t*  goRiceTab = g_goRiceBits[m_goRicePar];
-      int64_t         rdCostA   = m_rdCost + pqDataA.deltaDist;
-      int64_t         rdCostB   = m_rdCost + pqDataB.deltaDist;
-      int64_t         rdCostZ   = m_rdCost;
-      if (m_remRegBins >= 4)
-      {
-        if (pqDataA.absLevel < 4)
-        {
-          rdCostA += m_coeffFracBits.bits[pqDataA.absLevel];
-        }
-        else
-        {
-          const TCoeff value = (pqDataA.absLevel - 4) >> 1;
-          rdCostA +=
-            m_coeffFracBits.bits[pqDataA.absLevel - (value << 1)] + goRiceTab[value < RICEMAX ? value : RICEMAX - 1];
-        }
-        if (pqDataB.absLevel < 4)
-        {
-          rdCostB += m_coeffFracBits.bits[pqDataB.absLevel];
-        }
-        else
-        {
-          const TCoeff value = (pqDataB.absLevel - 4) >> 1;
-          rdCostB +=
-            m_coeffFracBits.bits[pqDataB.absLevel - (value << 1)] + goRiceTab[value < RICEMAX ? value : RICEMAX - 1];
-        }
-        if (spt == SCAN_ISCSBB)
-        {
-          rdCostA += m_sigFracBits.intBits[1];
-          rdCostB += m_sigFracBits.intBits[1];
-          rdCostZ += m_sigFracBits.intBits[0];
-        }
-        else if (spt == SCAN_SOCSBB)
-        {
-          rdCostA += m_sbbFracBits.intBits[1] + m_sigFracBits.intBits[1];
-          rdCostB += m_sbbFracBits.intBits[1] + m_sigFracBits.intBits[1];
-          rdCostZ += m_sbbFracBits.intBits[1] + m_sigFracBits.intBits[0];
-        }
-        else if (m_numSigSbb)
-        {
-          rdCostA += m_sigFracBits.intBits[1];
-          rdCostB += m_sigFracBits.intBits[1];
-          rdCostZ += m_sigFracBits.intBits[0];
-        }
-        else
-        {
-          rdCostZ = decisionA.rdCost;
-        }
-      }
-      else
-      {
-        rdCostA +=
-          (1 << SCALE_BITS)
-          + goRiceTab[pqDataA.absLevel <= m_goRiceZero ? pqDataA.absLevel - 1
-                                                       : (pqDataA.absLevel < RICEMAX ? pqDataA.absLevel : RICEMAX - 1)];
-        rdCostB +=
-          (1 << SCALE_BITS)
-          + goRiceTab[pqDataB.absLevel <= m_goRiceZero ? pqDataB.absLevel - 1
-                                                       : (pqDataB.absLevel < RICEMAX ? pqDataB.absLevel : RICEMAX - 1)];
-        rdCostZ += goRiceTab[m_goRiceZero];
-      }
-      if (rdCostA < decisionA.rdCost)
-      {
-        decisionA.rdCost   = rdCostA;
-        decisionA.absLevel = pqDataA.absLevel;
-        decisionA.prevId   = m_stateId;
-      }
-      if (rdCostZ < decisionA.rdCost)
-      {
-        decisionA.rdCost   = rdCostZ;
-        decisionA.absLevel = 0;
-        decisionA.prevId   = m_stateId;
-      }
-      if (rdCostB < decisionB.rdCost)
-      {
-        decisionB.rdCost   = rdCostB;
-        decisionB.absLevel = pqDataB.absLevel;
-        decisionB.prevId   = m_stateId;
-      }
-    }
+
+    inline const StateMem& getStateMem() const { return m_stateMem; }
 
     inline void checkRdCostStart(int32_t lastOffset, const PQData &pqData, Decision &decision) const
     {
@@ -1032,17 +1025,6 @@ namespace DQIntern
       }
     }
 
-    inline void checkRdCostSkipSbb(Decision &decision) const
-    {
-      int64_t rdCost = m_rdCost + m_sbbFracBits.intBits[0];
-      if( rdCost < decision.rdCost )
-      {
-        decision.rdCost   = rdCost;
-        decision.absLevel = 0;
-        decision.prevId   = 4+m_stateId;
-      }
-    }
-
     inline void checkRdCostSkipSbbZeroOut(Decision &decision) const
     {
       int64_t rdCost = m_rdCost + m_sbbFracBits.intBits[0];
@@ -1052,16 +1034,18 @@ namespace DQIntern
     }
 
   private:
-    int64_t                   m_rdCost;
+    // the rate relevant data is kept in the structure-of-arrays memory shared by the four states of a group
+    StateMem&                 m_stateMem;
+    int64_t&                  m_rdCost;
     uint16_t                  m_absLevelsAndCtxInit[24];  // 16x8bit for abs levels + 16x16bit for ctx init id
-    int8_t                    m_numSigSbb;
-    int                       m_remRegBins;
+    int8_t&                   m_numSigSbb;
+    int&                      m_remRegBins;
     int8_t                    m_refSbbCtxId;
-    BinFracBits               m_sbbFracBits;
-    BinFracBits               m_sigFracBits;
-    CoeffFracBits             m_coeffFracBits;
-    int8_t                    m_goRicePar;
-    int8_t                    m_goRiceZero;
+    BinFracBits&              m_sbbFracBits;
+    BinFracBits&              m_sigFracBits;
+    CoeffFracBits&            m_coeffFracBits;
+    int8_t&                   m_goRicePar;
+    int8_t&                   m_goRiceZero;
     const int8_t              m_stateId;
     const BinFracBits*const   m_sigFracBitsArray;
     const CoeffFracBits*const m_gtxFracBitsArray;
@@ -1071,13 +1055,22 @@ namespace DQIntern
     unsigned                  effHeight;
   };
 
-  State::State( const RateEstimator& rateEst, CommonCtx& commonCtx, const int stateId )
-    : m_sbbFracBits     { { 0, 0 } }
+  State::State( const RateEstimator& rateEst, CommonCtx& commonCtx, StateMem& stateMem, const int stateId )
+    : m_stateMem        ( stateMem )
+    , m_rdCost          ( stateMem.rdCost       [stateId] )
+    , m_numSigSbb       ( stateMem.numSigSbb    [stateId] )
+    , m_remRegBins      ( stateMem.remRegBins   [stateId] )
+    , m_sbbFracBits     ( stateMem.sbbFracBits  [stateId] )
+    , m_sigFracBits     ( stateMem.sigFracBits  [stateId] )
+    , m_coeffFracBits   ( stateMem.coeffFracBits[stateId] )
+    , m_goRicePar       ( stateMem.goRicePar    [stateId] )
+    , m_goRiceZero      ( stateMem.goRiceZero   [stateId] )
     , m_stateId         ( stateId )
     , m_sigFracBitsArray( rateEst.sigFlagBits(stateId) )
     , m_gtxFracBitsArray( rateEst.gtxFracBits(stateId) )
     , m_commonCtx       ( commonCtx )
   {
+    m_sbbFracBits = { { 0, 0 } };
   }
 
   template<uint8_t numIPos>
@@ -1375,7 +1368,7 @@ namespace DQIntern
   class DepQuant : private RateEstimator
   {
   public:
-    DepQuant();
+    DepQuant( CheckRdCostsFunc checkRdCosts );
 
     void    quant   ( TransformUnit& tu, const CCoeffBuf& srcCoeff, const ComponentID compID, const QpParam& cQP, const double lambda, const Ctx& ctx, TCoeff& absSum, bool enableScalingLists, int* quantCoeff );
     void    dequant ( const TransformUnit& tu, CoeffBuf& recCoeff, const ComponentID compID, const QpParam& cQP, bool enableScalingLists, int* quantCoeff );
@@ -1389,6 +1382,7 @@ namespace DQIntern
 
   private:
     CommonCtx   m_commonCtx;
+    StateMem    m_stateMem[ 4 ];  // three groups of four states and the start state
     State       m_allStates[ 12 ];
     State*      m_currStates;
     State*      m_prevStates;
@@ -1396,18 +1390,21 @@ namespace DQIntern
     State       m_startState;
     Quantizer   m_quant;
     Decision    m_trellis[ MAX_TB_SIZEY * MAX_TB_SIZEY ][ 8 ];
+    CheckRdCostsFunc m_checkRdCosts;
   };
 
 
-#define TINIT(x) {*this,m_commonCtx,x}
-  DepQuant::DepQuant()
+#define TINIT(g,x) {*this,m_commonCtx,m_stateMem[g],x}
+  DepQuant::DepQuant( CheckRdCostsFunc checkRdCosts )
     : RateEstimator ()
     , m_commonCtx   ()
-    , m_allStates   {TINIT(0),TINIT(1),TINIT(2),TINIT(3),TINIT(0),TINIT(1),TINIT(2),TINIT(3),TINIT(0),TINIT(1),TINIT(2),TINIT(3)}
+    , m_stateMem    ()
+    , m_allStates   {TINIT(0,0),TINIT(0,1),TINIT(0,2),TINIT(0,3),TINIT(1,0),TINIT(1,1),TINIT(1,2),TINIT(1,3),TINIT(2,0),TINIT(2,1),TINIT(2,2),TINIT(2,3)}
     , m_currStates  (  m_allStates      )
     , m_prevStates  (  m_currStates + 4 )
     , m_skipStates  (  m_prevStates + 4 )
-    , m_startState  TINIT(0)
+    , m_startState  TINIT(3,0)
+    , m_checkRdCosts( checkRdCosts )
   {}
 #undef TINIT
 
@@ -1441,17 +1438,7 @@ namespace DQIntern
 
     PQData  pqData[4];
     m_quant.preQuantCoeff( absCoeff, pqData, quanCoeff );
-    m_prevStates[0].checkRdCosts( spt, pqData[0], pqData[2], decisions[0], decisions[2]);
-    m_prevStates[1].checkRdCosts( spt, pqData[0], pqData[2], decisions[2], decisions[0]);
-    m_prevStates[2].checkRdCosts( spt, pqData[3], pqData[1], decisions[1], decisions[3]);
-    m_prevStates[3].checkRdCosts( spt, pqData[3], pqData[1], decisions[3], decisions[1]);
-    if( spt==SCAN_EOCSBB )
-    {
-      m_skipStates[0].checkRdCostSkipSbb(decisions[0]);
-      m_skipStates[1].checkRdCostSkipSbb(decisions[1]);
-      m_skipStates[2].checkRdCostSkipSbb(decisions[2]);
-      m_skipStates[3].checkRdCostSkipSbb(decisions[3]);
-    }
+    m_checkRdCosts( spt, pqData, decisions, m_prevStates->getStateMem(), m_skipStates->getStateMem(), g_goRiceBits );
 
     m_startState.checkRdCostStart( lastOffset, pqData[0], decisions[0] );
     m_startState.checkRdCostStart( lastOffset, pqData[2], decisions[2] );
@@ -1660,7 +1647,11 @@ DepQuant::DepQuant( const Quant* other, bool enc ) : QuantRDOQ( other )
 {
   const DepQuant* dq = dynamic_cast<const DepQuant*>( other );
   CHECK( other && !dq, "The DepQuant cast must be successfull!" );
-  p = new DQIntern::DepQuant();
+  m_checkRdCosts = DQIntern::checkRdCosts;
+#if ENABLE_SIMD_OPT_DEPQUANT && defined( TARGET_SIMD_X86 )
+  initDepQuantX86();
+#endif
+  p = new DQIntern::DepQuant( m_checkRdCosts );
   if( enc )
   {
     DQIntern::g_Rom.init();
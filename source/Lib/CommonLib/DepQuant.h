@@ -44,8 +44,56 @@
 #include "QuantRDOQ.h"
 
 
+#if JVET_V0106_DEP_QUANT_ENC_OPT
+#define RICEMAX 64
+#define RICE_ORDER_MAX 16
+#else
+#define RICEMAX 32
+#define RICE_ORDER_MAX 4
+#endif
 
 
+namespace DQIntern
+{
+  enum ScanPosType { SCAN_ISCSBB = 0, SCAN_SOCSBB = 1, SCAN_EOCSBB = 2 };
+
+  struct CoeffFracBits
+  {
+    int32_t   bits[6];
+  };
+
+  struct PQData
+  {
+    TCoeff  absLevel;
+    int64_t deltaDist;
+  };
+
+  struct Decision
+  {
+    int64_t rdCost;
+    TCoeff  absLevel;
+    int     prevId;
+  };
+
+  // rate and cost data of a group of four trellis states in structure-of-arrays layout
+  struct StateMem
+  {
+    int64_t       rdCost       [4];
+    BinFracBits   sigFracBits  [4];
+    BinFracBits   sbbFracBits  [4];
+    CoeffFracBits coeffFracBits[4];
+    int           remRegBins   [4];
+    int8_t        numSigSbb    [4];
+    int8_t        goRicePar    [4];
+    int8_t        goRiceZero   [4];
+  };
+
+  // evaluates the transitions from the four previous states (and the skip states) into the four current states
+  using CheckRdCostsFunc = void (*)(const ScanPosType spt, const PQData *pqData, Decision *decisions,
+                                    const StateMem &prevStates, const StateMem &skipStates,
+                                    const int32_t (*goRiceBits)[RICEMAX]);
+}
+
 
 class DepQuant : public QuantRDOQ
 {
@@ -57,7 +105,14 @@ public:
                      const QpParam &cQP, const Ctx &ctx);
   virtual void dequant( const TransformUnit &tu, CoeffBuf &dstCoeff, const ComponentID &compID, const QpParam &cQP );
 
+#ifdef TARGET_SIMD_X86
+  void initDepQuantX86();
+  template <X86_VEXT vext>
+  void _initDepQuantX86();
+#endif
+
 private:
+  DQIntern::CheckRdCostsFunc m_checkRdCosts;
   void* p;
 };
 
@@ -0,0 +1,161 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the FilmGrainAnalysis class
+ */
+
+#include "FilmGrainAnalysis.h"
+#include "TrQuant_EMT.h"
+
+//! \ingroup CommonLib
+//! \{
+
+FilmGrainAnalysis::FilmGrainAnalysis()
+{
+  m_sobel          = xSobel;
+  m_suppressNonMax = xSuppressNonMax;
+  m_morph3x3       = xMorph3x3;
+  m_subsample      = xSubsample;
+  m_squaredDct     = xSquaredDct;
+
+#if ENABLE_SIMD_OPT_FGA
+#ifdef TARGET_SIMD_X86
+  initFilmGrainAnalysisX86();
+#endif
+#endif
+}
+
+void FilmGrainAnalysis::xSobel(const Pel *src, ptrdiff_t srcStride, Pel *mag, ptrdiff_t magStride, Pel *dir,
+                               ptrdiff_t dirStride, int width, int height, int maxValue)
+{
+  for (int y = 0; y < height; y++, src += srcStride, mag += magStride, dir += dirStride)
+  {
+    const Pel *above = src - srcStride;
+    const Pel *below = src + srcStride;
+
+    for (int x = 0; x < width; x++)
+    {
+      const Pel gx = Pel(below[x - 1] + 2 * below[x] + below[x + 1] - above[x - 1] - 2 * above[x] - above[x + 1]);
+      const Pel gy = Pel(above[x + 1] + 2 * src[x + 1] + below[x + 1] - above[x - 1] - 2 * src[x - 1] - below[x - 1]);
+
+      mag[x] = Clip3<Pel>(0, maxValue, Pel((abs(gx) + abs(gy)) / 2));
+      dir[x] = quantizeDirection(gx, gy);
+    }
+  }
+}
+
+void FilmGrainAnalysis::xSuppressNonMax(const Pel *mag, ptrdiff_t magStride, const Pel *dir, ptrdiff_t dirStride,
+                                        Pel *dst, ptrdiff_t dstStride, int width, int height)
+{
+  for (int y = 0; y < height; y++, mag += magStride, dir += dirStride, dst += dstStride)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      ptrdiff_t offset = 0;
+
+      switch (dir[x])
+      {
+      case 0: offset = 1; break;
+      case 45: offset = magStride + 1; break;
+      case 90: offset = magStride; break;
+      case 135: offset = magStride - 1; break;
+      default: THROW("Unsupported gradient direction."); break;
+      }
+
+      const Pel cur = mag[x];
+      dst[x]        = cur < mag[x + offset] || cur < mag[x - offset] ? 0 : cur;
+    }
+  }
+}
+
+void FilmGrainAnalysis::xMorph3x3(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width,
+                                  int height, Pel value)
+{
+  for (int y = 0; y < height; y++, src += srcStride, dst += dstStride)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      bool found = false;
+      for (int dy = -1; dy <= 1; dy++)
+      {
+        for (int dx = -1; dx <= 1; dx++)
+        {
+          found |= src[dy * srcStride + x + dx] == value;
+        }
+      }
+      dst[x] = found ? value : src[x];
+    }
+  }
+}
+
+void FilmGrainAnalysis::xSubsample(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width,
+                                   int height, int factor)
+{
+  for (int y = 0; y < height; y++, src += factor * srcStride, dst += dstStride)
+  {
+    const Pel *below = src + srcStride;
+
+    for (int x = 0; x < width; x++)
+    {
+      dst[x] = (src[factor * x] + below[factor * x] + src[factor * x + 1] + below[factor * x + 1] + 2) >> 2;
+    }
+  }
+}
+
+void FilmGrainAnalysis::xSquaredDct(const Pel *src, ptrdiff_t srcStride, Intermediate_Int *dst, int bitDepth)
+{
+  TCoeff block[DCT_SIZE * DCT_SIZE];
+  TCoeff tmp[DCT_SIZE * DCT_SIZE];
+
+  for (int y = 0; y < DCT_SIZE; y++, src += srcStride)
+  {
+    std::copy_n(src, DCT_SIZE, block + y * DCT_SIZE);
+  }
+
+  // the partial butterflies give the same result as the matrix multiplications, the first pass transforms the rows
+  // and outputs them as columns, the second one does the same for the columns
+  fastForwardDCT2_B64(block, tmp, DCT_SHIFT, DCT_SIZE, 0, 0);
+  fastForwardDCT2_B64(tmp, block, DCT_SHIFT, DCT_SIZE, 0, 0);
+
+  const Intermediate_Int maxValue = (1 << (bitDepth + 6)) - 1;
+
+  for (int i = 0; i < DCT_SIZE * DCT_SIZE; i++)
+  {
+    const Intermediate_Int coeff = Clip3(-maxValue, maxValue, Intermediate_Int(block[i]));
+    dst[i]                       = coeff * coeff;
+  }
+}
+
+//! \}
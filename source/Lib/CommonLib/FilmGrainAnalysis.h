@@ -0,0 +1,119 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Declaration of the FilmGrainAnalysis class, the picture and block kernels of the film grain analysis
+ */
+
+#ifndef __FILMGRAINANALYSIS__
+#define __FILMGRAINANALYSIS__
+
+#include "CommonDef.h"
+
+//! \ingroup CommonLib
+//! \{
+
+class FilmGrainAnalysis
+{
+public:
+  static constexpr int DCT_SIZE  = 64;   // size of the blocks transformed for the cut-off frequency estimation
+  static constexpr int DCT_SHIFT = 9;    // rounding shift after each stage of the block transform
+
+  // Sobel gradients gx (vertical derivative) and gy (horizontal derivative) of a picture with a one sample border.
+  // mag receives (|gx| + |gy|) / 2 clipped to maxValue, dir the direction of atan2(gx, gy) quantized to 0, 45, 90 or
+  // 135 degrees.
+  void (*m_sobel)(const Pel *src, ptrdiff_t srcStride, Pel *mag, ptrdiff_t magStride, Pel *dir, ptrdiff_t dirStride,
+                  int width, int height, int maxValue);
+
+  // Non-maximum suppression of the gradient magnitude along the quantized direction. mag needs a one sample border,
+  // dst may be the same buffer as dir.
+  void (*m_suppressNonMax)(const Pel *mag, ptrdiff_t magStride, const Pel *dir, ptrdiff_t dirStride, Pel *dst,
+                           ptrdiff_t dstStride, int width, int height);
+
+  // 3x3 morphological operation: dst is set to value where any sample of the 3x3 neighbourhood of src equals value,
+  // and to the centre sample otherwise. src needs a one sample border.
+  void (*m_morph3x3)(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                     Pel value);
+
+  // Subsampling by factor, each output sample is the rounded average of the top-left 2x2 samples of its block.
+  // width and height are the dimensions of the output.
+  void (*m_subsample)(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                      int factor);
+
+  // Squared forward DCT-II of a DCT_SIZE x DCT_SIZE block of samples with a magnitude below 1 << bitDepth. The
+  // coefficients are clipped to bitDepth + 6 bits before squaring and written in raster order, one row per vertical
+  // frequency.
+  void (*m_squaredDct)(const Pel *src, ptrdiff_t srcStride, Intermediate_Int *dst, int bitDepth);
+
+  static void xSobel(const Pel *src, ptrdiff_t srcStride, Pel *mag, ptrdiff_t magStride, Pel *dir, ptrdiff_t dirStride,
+                     int width, int height, int maxValue);
+  static void xSuppressNonMax(const Pel *mag, ptrdiff_t magStride, const Pel *dir, ptrdiff_t dirStride, Pel *dst,
+                              ptrdiff_t dstStride, int width, int height);
+  static void xMorph3x3(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                        Pel value);
+  static void xSubsample(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                         int factor);
+  static void xSquaredDct(const Pel *src, ptrdiff_t srcStride, Intermediate_Int *dst, int bitDepth);
+
+  // Quantizes the direction of atan2(gx, gy) to 0, 45, 90 or 135 degrees with integer arithmetic only. The
+  // boundaries at odd multiples of 22.5 degrees are tested as (|gx| + |gy|)^2 against 2 * gy^2 and 2 * gx^2, which is
+  // exact because tan(22.5) = sqrt(2) - 1 is irrational.
+  static Pel quantizeDirection(int gx, int gy)
+  {
+    const int64_t sum2 = int64_t(abs(gx) + abs(gy)) * (abs(gx) + abs(gy));
+
+    if (sum2 <= 2 * int64_t(gy) * gy)
+    {
+      return 0;
+    }
+    if (sum2 <= 2 * int64_t(gx) * gx)
+    {
+      return 90;
+    }
+    return (gx ^ gy) < 0 ? 135 : 45;
+  }
+
+  FilmGrainAnalysis();
+  ~FilmGrainAnalysis() {}
+
+#ifdef TARGET_SIMD_X86
+  void initFilmGrainAnalysisX86();
+  template <X86_VEXT vext>
+  void _initFilmGrainAnalysisX86();
+#endif
+};
+
+//! \}
+
+#endif
@@ -45,61 +45,81 @@
  // Constructor / destructor / create / destroy
  // ====================================================================================================================
 
-CrcCalculatorLight Hash::m_crcCalculator1(24, 0x5D6DCB);
-CrcCalculatorLight Hash::m_crcCalculator2(24, 0x864CFB);
-
-CrcCalculatorLight::CrcCalculatorLight(uint32_t bits, uint32_t truncPoly)
+// CRC-32C (Castagnoli), reflected polynomial 0x82F63B78, as computed by the SSE4.2 crc32 instruction
+static constexpr std::array<uint32_t, 256> crc32cTable = []()
 {
-  m_remainder = 0;
-  m_bits = bits;
-  m_truncPoly = truncPoly;
-  m_finalResultMask = (1 << bits) - 1;
+  std::array<uint32_t, 256> table{};
+  for (uint32_t value = 0; value < 256; value++)
+  {
+    uint32_t remainder = value;
+    for (int bit = 0; bit < 8; bit++)
+    {
+      remainder = (remainder >> 1) ^ ((remainder & 1) ? 0x82F63B78 : 0);
+    }
+    table[value] = remainder;
+  }
+  return table;
+}();
 
-  xInitTable();
+static inline uint32_t crc32cWord(uint32_t crc, uint32_t word)
+{
+  crc ^= word;
+  for (int i = 0; i < 4; i++)
+  {
+    crc = crc32cTable[crc & 0xff] ^ (crc >> 8);
+  }
+  return crc;
 }
 
-CrcCalculatorLight::~CrcCalculatorLight() {}
-
-void CrcCalculatorLight::xInitTable()
+static uint32_t hashWordsCore(const uint32_t *words, int numWords, bool mix)
 {
-  const uint32_t highBit = 1 << (m_bits - 1);
-  const uint32_t byteHighBit = 1 << (8 - 1);
+  uint32_t crc = 0xffffffff;
+  for (int i = 0; i < numWords; i++)
+  {
+    crc = crc32cWord(crc, mix ? words[i] * HashOps::HASH_MIX : words[i]);
+  }
+  return crc;
+}
 
-  for (uint32_t value = 0; value < 256; value++)
+static void hash2x2Core(const Pel *src, ptrdiff_t stride, int count, int shift, uint32_t *hash1, uint32_t *hash2,
+                        bool *rowSame, bool *colSame)
+{
+  for (int x = 0; x < count; x++)
   {
-    uint32_t remainder = 0;
-    for (uint8_t mask = byteHighBit; mask != 0; mask >>= 1)
-    {
-      if (value & mask)
-      {
-        remainder ^= highBit;
-      }
+    const uint32_t p0 = uint8_t(src[x] >> shift);
+    const uint32_t p1 = uint8_t(src[x + 1] >> shift);
+    const uint32_t p2 = uint8_t(src[x + stride] >> shift);
+    const uint32_t p3 = uint8_t(src[x + stride + 1] >> shift);
 
-      if (remainder & highBit)
-      {
-        remainder <<= 1;
-        remainder ^= m_truncPoly;
-      }
-      else
-      {
-        remainder <<= 1;
-      }
-    }
+    rowSame[x] = p0 == p1 && p2 == p3;
+    colSame[x] = p0 == p2 && p1 == p3;
+
+    const uint32_t word = p0 | (p1 << 8) | (p2 << 16) | (p3 << 24);
 
-    m_table[value] = remainder;
+    hash1[x] = hashWordsCore(&word, 1, false);
+    hash2[x] = hashWordsCore(&word, 1, true);
   }
 }
 
-void CrcCalculatorLight::processData(const uint8_t *curData, const size_t dataLength)
+static void hashQuadCore(const uint32_t *src, ptrdiff_t offsetX, ptrdiff_t offsetY, int count, uint32_t *dst, bool mix)
 {
-  for (size_t i = 0; i < dataLength; i++)
+  for (int x = 0; x < count; x++)
   {
-    uint8_t index = (m_remainder >> (m_bits - 8)) ^ curData[i];
-    m_remainder <<= 8;
-    m_remainder ^= m_table[index];
+    const uint32_t words[4] = { src[x], src[x + offsetX], src[x + offsetY], src[x + offsetX + offsetY] };
+
+    dst[x] = hashWordsCore(words, 4, mix);
   }
 }
 
+HashOps::HashOps()
+{
+  hashWords = hashWordsCore;
+  hash2x2   = hash2x2Core;
+  hashQuad  = hashQuadCore;
+}
+
+HashOps g_hashOps = HashOps();
+
 Hash::Hash()
 {
   m_lookupTable   = nullptr;
@@ -233,13 +253,21 @@ void Hash::generateBlock2x2HashValue(const PelUnitBuf &curPicBuf, int picWidth,
   int xEnd = picWidth - width + 1;
   int yEnd = picHeight - height + 1;
 
-  int length = width * 2;
-  bool includeChroma = false;
-  if ((curPicBuf).chromaFormat == ChromaFormat::_444)
+  if ((curPicBuf).chromaFormat != ChromaFormat::_444)
   {
-    length *= 3;
-    includeChroma = true;
+    const CPelBuf   lumaBuf = curPicBuf.get(COMPONENT_Y);
+    const int       shift   = bitDepths[ChannelType::LUMA] - 8;
+    const Pel      *src     = lumaBuf.buf;
+
+    for (int yPos = 0, pos = 0; yPos < yEnd; yPos++, pos += picWidth, src += lumaBuf.stride)
+    {
+      g_hashOps.hash2x2(src, lumaBuf.stride, xEnd, shift, &picBlockHash[0][pos], &picBlockHash[1][pos],
+                        &picBlockSameInfo[0][pos], &picBlockSameInfo[1][pos]);
+    }
+    return;
   }
+
+  const int length = width * 2 * 3;
   unsigned char* p = new unsigned char[length];
 
   int pos = 0;
@@ -247,9 +275,9 @@ void Hash::generateBlock2x2HashValue(const PelUnitBuf &curPicBuf, int picWidth,
   {
     for (int xPos = 0; xPos < xEnd; xPos++)
     {
-      Hash::getPixelsIn1DCharArrayByBlock2x2(curPicBuf, p, xPos, yPos, bitDepths, includeChroma);
-      picBlockSameInfo[0][pos] = isBlock2x2RowSameValue(p, includeChroma);
-      picBlockSameInfo[1][pos] = isBlock2x2ColSameValue(p, includeChroma);
+      Hash::getPixelsIn1DCharArrayByBlock2x2(curPicBuf, p, xPos, yPos, bitDepths, true);
+      picBlockSameInfo[0][pos] = isBlock2x2RowSameValue(p, true);
+      picBlockSameInfo[1][pos] = isBlock2x2ColSameValue(p, true);
 
       picBlockHash[0][pos] = Hash::getCRCValue1(p, length * sizeof(unsigned char));
       picBlockHash[1][pos] = Hash::getCRCValue2(p, length * sizeof(unsigned char));
@@ -274,26 +302,14 @@ void Hash::generateBlockHashValue(int picWidth, int picHeight, int width, int he
   int srcHeight = height >> 1;
   int quadHeight = height >> 2;
 
-  int length = 4 * sizeof(uint32_t);
-
-  uint32_t p[4];
   int pos = 0;
   for (int yPos = 0; yPos < yEnd; yPos++)
   {
+    g_hashOps.hashQuad(&srcPicBlockHash[0][pos], srcWidth, srcHeight * picWidth, xEnd, &dstPicBlockHash[0][pos], false);
+    g_hashOps.hashQuad(&srcPicBlockHash[1][pos], srcWidth, srcHeight * picWidth, xEnd, &dstPicBlockHash[1][pos], true);
+
     for (int xPos = 0; xPos < xEnd; xPos++)
     {
-      p[0] = srcPicBlockHash[0][pos];
-      p[1] = srcPicBlockHash[0][pos + srcWidth];
-      p[2] = srcPicBlockHash[0][pos + srcHeight * picWidth];
-      p[3] = srcPicBlockHash[0][pos + srcHeight * picWidth + srcWidth];
-      dstPicBlockHash[0][pos] = Hash::getCRCValue1((unsigned char *) p, length);
-
-      p[0] = srcPicBlockHash[1][pos];
-      p[1] = srcPicBlockHash[1][pos + srcWidth];
-      p[2] = srcPicBlockHash[1][pos + srcHeight * picWidth];
-      p[3] = srcPicBlockHash[1][pos + srcHeight * picWidth + srcWidth];
-      dstPicBlockHash[1][pos] = Hash::getCRCValue2((unsigned char *) p, length);
-
       dstPicBlockSameInfo[0][pos] = srcPicBlockSameInfo[0][pos] && srcPicBlockSameInfo[0][pos + quadWidth] && srcPicBlockSameInfo[0][pos + srcWidth]
         && srcPicBlockSameInfo[0][pos + srcHeight * picWidth] && srcPicBlockSameInfo[0][pos + srcHeight * picWidth + quadWidth] && srcPicBlockSameInfo[0][pos + srcHeight * picWidth + srcWidth];
 
@@ -662,15 +678,17 @@ bool Hash::getBlockHashValue(const PelUnitBuf &curPicBuf, int width, int height,
 
 uint32_t Hash::getCRCValue1(const uint8_t *p, size_t length)
 {
-  m_crcCalculator1.reset();
-  m_crcCalculator1.processData(p, length);
-  return m_crcCalculator1.getCRC();
+  uint32_t words[4];
+  CHECK(length > sizeof(words) || length % sizeof(uint32_t) != 0, "unsupported hash input length");
+  memcpy(words, p, length);
+  return g_hashOps.hashWords(words, int(length / sizeof(uint32_t)), false);
 }
 
 uint32_t Hash::getCRCValue2(const uint8_t *p, size_t length)
 {
-  m_crcCalculator2.reset();
-  m_crcCalculator2.processData(p, length);
-  return m_crcCalculator2.getCRC();
+  uint32_t words[4];
+  CHECK(length > sizeof(words) || length % sizeof(uint32_t) != 0, "unsupported hash input length");
+  memcpy(words, p, length);
+  return g_hashOps.hashWords(words, int(length / sizeof(uint32_t)), true);
 }
 //! \}
@@ -62,28 +62,32 @@ typedef std::vector<BlockHash>::iterator MapIterator;
 // Class definitions
 // ====================================================================================================================
 
-struct CrcCalculatorLight
+// Block hash kernels. The hashes are CRC-32C of the data taken as little-endian 32-bit words; for the second hash
+// every word is first multiplied by HASH_MIX, so that the two hashes of a block are independent of each other.
+struct HashOps
 {
-public:
-  CrcCalculatorLight(uint32_t bits, uint32_t truncPoly);
-  ~CrcCalculatorLight();
+  static constexpr uint32_t HASH_MIX = 0x9e3779b1;
 
-public:
-  void     processData(const uint8_t *curData, size_t dataLength);
-  void     reset() { m_remainder = 0; }
-  uint32_t getCRC() { return m_remainder & m_finalResultMask; }
+  HashOps();
 
-private:
-  void xInitTable();
+#if ENABLE_SIMD_OPT_HASH && defined(TARGET_SIMD_X86)
+  void initHashOpsX86();
+  template<X86_VEXT vext> void _initHashOpsX86();
+#endif
 
-private:
-  uint32_t m_remainder;
-  uint32_t m_truncPoly;
-  uint32_t m_bits;
-  uint32_t m_table[256];
-  uint32_t m_finalResultMask;
+  uint32_t (*hashWords)(const uint32_t *words, int numWords, bool mix);
+
+  // hashes of the 2x2 luma blocks at count consecutive positions, the samples are reduced to 8 bits by shift
+  void (*hash2x2)(const Pel *src, ptrdiff_t stride, int count, int shift, uint32_t *hash1, uint32_t *hash2,
+                  bool *rowSame, bool *colSame);
+
+  // hashes of the 4 sub-block hashes at src, src + offsetX, src + offsetY and src + offsetX + offsetY for count
+  // consecutive positions
+  void (*hashQuad)(const uint32_t *src, ptrdiff_t offsetX, ptrdiff_t offsetY, int count, uint32_t *dst, bool mix);
 };
 
+extern HashOps g_hashOps;
+
 struct Hash
 {
   static constexpr int MIN_LOG_BLK_SIZE  = 2;
@@ -138,9 +142,6 @@ private:
     }
     return w == 4 ? 4 : floorLog2(w) - 3;
   }
-
-  static CrcCalculatorLight m_crcCalculator1;
-  static CrcCalculatorLight m_crcCalculator2;
 };
 
 #endif // __HASH__
@@ -1643,13 +1643,21 @@ constexpr InterPrediction::DmvrDist InterPrediction::UNDEFINED_DMVR_DIST;
 void InterPrediction::xDmvrIntegerRefine(int bd, DmvrDist &minCost, Mv &deltaMv, DmvrDist *sadPtr, int width,
                                          int height)
 {
+  // all search positions are evaluated in a single pass over the initial predictions
+  std::array<uint32_t, DMVR_AREA> rawSads;
+  g_pelBufOP.dmvrSads(m_dmvrInitialPred[REF_PIC_LIST_0].buf, m_dmvrInitialPred[REF_PIC_LIST_0].stride,
+                      m_dmvrInitialPred[REF_PIC_LIST_1].buf, m_dmvrInitialPred[REF_PIC_LIST_1].stride, width, height,
+                      rawSads.data());
+
   for (const auto &mvd: m_dmvrSearchOffsets)
   {
     const int32_t sadOffset = mvd.ver * DMVR_SPAN + mvd.hor;
 
     if (sadPtr[sadOffset] == UNDEFINED_DMVR_DIST)
     {
-      sadPtr[sadOffset] = xDmvrCost(bd, mvd, width, height);
+      // same scaling as xDmvrCost(): SAD on every second row, rescaled to the full block
+      const Distortion dist = Distortion(rawSads[DMVR_AREA / 2 + sadOffset]) << 1;
+      sadPtr[sadOffset]     = DmvrDist((dist >> DISTORTION_PRECISION_ADJUSTMENT(bd)) >> 1);
     }
     if (sadPtr[sadOffset] < minCost)
     {
@@ -2317,6 +2325,13 @@ bool InterPrediction::xPredInterBlkRPR(const ScalingRatio scalingRatio, const PP
     int tmpStride = width;
     int xInt = 0, yInt = 0;
 
+    // the horizontal pass filters all columns at once with a source position and filter phase per column
+    const int    hFilterSize = isLuma(compID) ? NTAPS_LUMA : NTAPS_CHROMA;
+    int          srcPos[MAX_CU_SIZE];
+    TFilterCoeff coeff[MAX_CU_SIZE * NTAPS_LUMA];
+
+    CHECK(width > MAX_CU_SIZE, "Block is too wide");
+
     for( col = 0; col < width; col++ )
     {
       int posX = (int32_t)x0Int + col * stepX;
@@ -2326,14 +2341,21 @@ bool InterPrediction::xPredInterBlkRPR(const ScalingRatio scalingRatio, const PP
 
       CHECK( xInt0 > xInt, "Wrong horizontal starting point" );
 
-      Position offset = Position( xInt, yInt0 );
-      refBuf = refPic->getRecoBuf( CompArea( compID, chFmt, offset, Size( 1, refHeight ) ), wrapRef );
+      srcPos[col] = xInt - xInt0 - ((hFilterSize >> 1) - 1);
+      InterpolationFilter::getFilterCoeff(compID, xFrac, xFilter, coeff + col * hFilterSize);
+    }
 
-      Pel *const tempBuf = m_filteredBlockTmpRPR + col;
+    refBuf = refPic->getRecoBuf(CompArea(compID, chFmt, Position(xInt0, yInt0), Size(1, refHeight)), wrapRef);
 
-      m_if.filterHor(compID, (Pel *) refBuf.buf - ((vFilterSize >> 1) - 1) * refBuf.stride, refBuf.stride, tempBuf,
-                     tmpStride, 1, refHeight + vFilterSize - 1 + extSize, xFrac, false, clpRng, xFilter);
-    }
+    const int headRoom = IF_INTERNAL_FRAC_BITS(clpRng.bd);
+    const int shift    = IF_FILTER_PREC - headRoom;
+    const int offset   = -IF_INTERNAL_OFFS * (1 << shift);
+
+    CHECK(shift < 0, "Negative shift");
+
+    g_pelBufOP.filterScaledHorPel(refBuf.buf - ((vFilterSize >> 1) - 1) * refBuf.stride, refBuf.stride,
+                                  m_filteredBlockTmpRPR, tmpStride, width, refHeight + vFilterSize - 1 + extSize,
+                                  srcPos, coeff, hFilterSize, shift, offset);
 
     for( row = 0; row < height; row++ )
     {
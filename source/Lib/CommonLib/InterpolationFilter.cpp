@@ -781,6 +781,74 @@ void InterpolationFilter::filterVer(const ComponentID compID, Pel const *src, co
   }
 }
 
+// Taps applied by filterHor() and filterVer() for a filter index and fractional position. Luma taps are returned as
+// NTAPS_LUMA taps starting at -(NTAPS_LUMA / 2 - 1), with the 6-tap affine filters padded by a zero tap on either
+// side; chroma taps are returned as NTAPS_CHROMA taps.
+void InterpolationFilter::getFilterCoeff(const ComponentID compID, const int frac, const Filter nFilterIdx,
+                                         TFilterCoeff *coeff)
+{
+  CHECK(nFilterIdx == Filter::DMVR, "The bilinear DMVR filter is not supported");
+
+  if (isLuma(compID))
+  {
+    CHECK(frac < 0 || frac >= LUMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS, "Invalid fraction");
+
+    const TFilterCoeff *affineCoeff = nullptr;
+    if (nFilterIdx == Filter::AFFINE)
+    {
+      affineCoeff = m_affineLumaFilter[frac];
+    }
+    else if (nFilterIdx == Filter::AFFINE_RPR1)
+    {
+      affineCoeff = m_affineLumaFilterRPR1[frac];
+    }
+    else if (nFilterIdx == Filter::AFFINE_RPR2)
+    {
+      affineCoeff = m_affineLumaFilterRPR2[frac];
+    }
+
+    if (affineCoeff != nullptr)
+    {
+      coeff[0] = 0;
+      std::copy_n(affineCoeff, NTAPS_LUMA_AFFINE, coeff + 1);
+      coeff[NTAPS_LUMA - 1] = 0;
+    }
+    else if (nFilterIdx == Filter::RPR1)
+    {
+      std::copy_n(m_lumaFilterRPR1[frac], NTAPS_LUMA, coeff);
+    }
+    else if (nFilterIdx == Filter::RPR2)
+    {
+      std::copy_n(m_lumaFilterRPR2[frac], NTAPS_LUMA, coeff);
+    }
+    else if (frac == LUMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS / 2 && nFilterIdx == Filter::HALFPEL_ALT)
+    {
+      std::copy_n(m_lumaAltHpelIFilter, NTAPS_LUMA, coeff);
+    }
+    else
+    {
+      std::copy_n(m_lumaFilter[frac], NTAPS_LUMA, coeff);
+    }
+  }
+  else
+  {
+    CHECK(frac < 0 || frac >= CHROMA_INTERPOLATION_FILTER_SUB_SAMPLE_POSITIONS, "Invalid fraction");
+
+    if (nFilterIdx == Filter::RPR1)
+    {
+      std::copy_n(m_chromaFilterRPR1[frac], NTAPS_CHROMA, coeff);
+    }
+    else if (nFilterIdx == Filter::RPR2)
+    {
+      std::copy_n(m_chromaFilterRPR2[frac], NTAPS_CHROMA, coeff);
+    }
+    else
+    {
+      std::copy_n(m_chromaFilter[frac], NTAPS_CHROMA, coeff);
+    }
+  }
+}
+
 void InterpolationFilter::weightedGeoBlk(const PredictionUnit &pu, const uint32_t width, const uint32_t height, const ComponentID compIdx, const uint8_t splitDir, PelUnitBuf& predDst, PelUnitBuf& predSrc0, PelUnitBuf& predSrc1)
 {
   m_weightedGeoBlk(pu, width, height, compIdx, splitDir, predDst, predSrc0, predSrc1);
@@ -0,0 +1,119 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the MCTF class
+ */
+
+#include "MCTF.h"
+
+//! \ingroup CommonLib
+//! \{
+
+MCTF::MCTF()
+{
+  m_motionError = xMotionError;
+  m_applyMotion = xApplyMotion;
+
+#if ENABLE_SIMD_OPT_MCTF
+#ifdef TARGET_SIMD_X86
+  initMCTFX86();
+#endif
+#endif
+}
+
+int MCTF::xMotionError(const Pel *org, ptrdiff_t orgStride, const Pel *buf, ptrdiff_t bufStride, int width,
+                       int height, int bestError)
+{
+  int error = 0;
+
+  for (int y = 0; y < height; y++, org += orgStride, buf += bufStride)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      const int diff = org[x] - buf[x];
+      error += diff * diff;
+    }
+    if (error > bestError)
+    {
+      return error;
+    }
+  }
+
+  return error;
+}
+
+void MCTF::xApplyMotion(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                        const int *xFilter, const int *yFilter, int maxValue)
+{
+  static constexpr int MAX_SIZE = 64;
+  static constexpr int NUM_ROWS = MAX_SIZE + 5;
+
+  CHECK(width > MAX_SIZE || height > MAX_SIZE, "block too large");
+
+  int tmp[NUM_ROWS][MAX_SIZE];
+
+  src -= 2 * srcStride + 2;
+
+  for (int y = 0; y < height + 5; y++, src += srcStride)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      int sum = 0;
+      for (int k = 0; k < 6; k++)
+      {
+        sum += xFilter[k + 1] * src[x + k];
+      }
+      tmp[y][x] = sum;
+    }
+  }
+
+  const int shift  = 2 * FILTER_PREC;
+  const int offset = 1 << (shift - 1);
+
+  for (int y = 0; y < height; y++, dst += dstStride)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      int sum = 0;
+      for (int k = 0; k < 6; k++)
+      {
+        sum += yFilter[k + 1] * tmp[y + k][x];
+      }
+      dst[x] = Clip3(0, maxValue, (sum + offset) >> shift);
+    }
+  }
+}
+
+//! \}
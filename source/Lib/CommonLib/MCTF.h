@@ -0,0 +1,79 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Declaration of the MCTF class, the block kernels of the motion compensated temporal pre-filter
+ */
+
+#ifndef __MCTF__
+#define __MCTF__
+
+#include "CommonDef.h"
+
+//! \ingroup CommonLib
+//! \{
+
+class MCTF
+{
+public:
+  static constexpr int FILTER_PREC = 6;   // precision of the 6-tap interpolation filter coefficients
+
+  // Sum of squared differences between two blocks. Returns as soon as the partial sum of the rows checked so far
+  // exceeds bestError, in which case the returned value is only guaranteed to be larger than bestError.
+  int (*m_motionError)(const Pel *org, ptrdiff_t orgStride, const Pel *buf, ptrdiff_t bufStride, int width, int height,
+                       int bestError);
+
+  // Separable 6-tap interpolation of a block. src points to the integer sample position, the taps 1 to 6 of the
+  // 8-entry filters cover the samples at -2 to +3. The result is rounded and clipped to [0, maxValue].
+  void (*m_applyMotion)(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                        const int *xFilter, const int *yFilter, int maxValue);
+
+  static int  xMotionError(const Pel *org, ptrdiff_t orgStride, const Pel *buf, ptrdiff_t bufStride, int width,
+                           int height, int bestError);
+  static void xApplyMotion(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                           const int *xFilter, const int *yFilter, int maxValue);
+
+  MCTF();
+  ~MCTF() {}
+
+#ifdef TARGET_SIMD_X86
+  void initMCTFX86();
+  template <X86_VEXT vext>
+  void _initMCTFX86();
+#endif
+};
+
+//! \}
+
+#endif
@@ -35,90 +35,120 @@
 #include "SEI.h"
 #include "libmd5/MD5.h"
 
+#include <array>
+#include <vector>
+#if ENABLE_CONCURRENT_PICTURE_HASH
+#include <future>
+#endif
+
 //! \ingroup CommonLib
 //! \{
 
 /**
- * Update md5 using n samples from plane, each sample is adjusted to
- * OUTBIT_BITDEPTH_DIV8.
+ * Pack one row of samples into bytes in little-endian order, using
+ * BYTES_PER_SAMPLE bytes per sample. NB, for 8bit data, data is truncated
+ * to 8bits. The loops are kept free of dependencies so that they vectorise.
  */
-template<uint32_t OUTPUT_BITDEPTH_DIV8>
-static void md5_block(MD5& md5, const Pel* plane, uint32_t n)
+template<uint32_t BYTES_PER_SAMPLE>
+static void packRow(const Pel* src, uint32_t width, uint8_t* dst)
 {
-  /* create a 64 byte buffer for packing Pel's into */
-  uint8_t buf[64/OUTPUT_BITDEPTH_DIV8][OUTPUT_BITDEPTH_DIV8];
-  for (uint32_t i = 0; i < n; i++)
+  if (BYTES_PER_SAMPLE == 1)
+  {
+    for (uint32_t x = 0; x < width; x++)
+    {
+      dst[x] = uint8_t(src[x]);
+    }
+  }
+  else
   {
-    Pel pel = plane[i];
-    /* perform bitdepth and endian conversion */
-    for (uint32_t d = 0; d < OUTPUT_BITDEPTH_DIV8; d++)
+    for (uint32_t x = 0; x < width; x++)
     {
-      buf[i][d] = pel >> (d*8);
+      dst[2 * x]     = uint8_t(src[x]);
+      dst[2 * x + 1] = uint8_t(src[x] >> 8);
     }
   }
-  md5.update((uint8_t*)buf, n * OUTPUT_BITDEPTH_DIV8);
 }
 
 /**
  * Update md5 with all samples in plane in raster order, each sample
- * is adjusted to OUTBIT_BITDEPTH_DIV8.
+ * is adjusted to BYTES_PER_SAMPLE. Each row is packed and hashed in one update.
  */
-template<uint32_t OUTPUT_BITDEPTH_DIV8>
+template<uint32_t BYTES_PER_SAMPLE>
 static void md5_plane(MD5& md5, const Pel* plane, uint32_t width, uint32_t height, ptrdiff_t stride)
 {
-  /* N is the number of samples to process per md5 update.
-   * All N samples must fit in buf */
-  uint32_t N = 32;
-  uint32_t width_modN = width % N;
-  uint32_t width_less_modN = width - width_modN;
+  std::vector<uint8_t> row(width * BYTES_PER_SAMPLE);
 
   for (uint32_t y = 0; y < height; y++)
   {
-    /* convert pels into unsigned chars in little endian byte order.
-     * NB, for 8bit data, data is truncated to 8bits. */
-    for (uint32_t x = 0; x < width_less_modN; x += N)
+    packRow<BYTES_PER_SAMPLE>(plane + y * stride, width, row.data());
+    md5.update(row.data(), (uint32_t) row.size());
+  }
+}
+
+/**
+ * Slice-by-8 tables for the CRC-16 with polynomial 0x1021 (MSB first).
+ * crcTables[0] is the usual byte-wise table, crcTables[k] advances a byte
+ * through k further zero bytes.
+ */
+static constexpr std::array<std::array<uint16_t, 256>, 8> crcTables = []()
+{
+  std::array<std::array<uint16_t, 256>, 8> tables{};
+  for (uint32_t i = 0; i < 256; i++)
+  {
+    uint32_t remainder = i << 8;
+    for (int bit = 0; bit < 8; bit++)
     {
-      md5_block<OUTPUT_BITDEPTH_DIV8>(md5, &plane[y*stride + x], N);
+      remainder = (remainder & 0x8000) ? ((remainder << 1) ^ 0x1021) : (remainder << 1);
     }
+    tables[0][i] = uint16_t(remainder);
+  }
+  for (int k = 1; k < 8; k++)
+  {
+    for (uint32_t i = 0; i < 256; i++)
+    {
+      tables[k][i] = uint16_t((tables[k - 1][i] << 8) ^ tables[0][tables[k - 1][i] >> 8]);
+    }
+  }
+  return tables;
+}();
 
-    /* mop up any of the remaining line */
-    md5_block<OUTPUT_BITDEPTH_DIV8>(md5, &plane[y*stride + width_less_modN], width_modN);
+static uint32_t crcUpdate(uint32_t crcVal, const uint8_t *data, size_t size)
+{
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8)
+  {
+    const uint8_t *p = data + i;
+    crcVal = crcTables[7][(crcVal >> 8) ^ p[0]] ^ crcTables[6][(crcVal & 0xff) ^ p[1]] ^ crcTables[5][p[2]]
+             ^ crcTables[4][p[3]] ^ crcTables[3][p[4]] ^ crcTables[2][p[5]] ^ crcTables[1][p[6]] ^ crcTables[0][p[7]];
   }
+  for (; i < size; i++)
+  {
+    crcVal = ((crcVal << 8) & 0xffff) ^ crcTables[0][(crcVal >> 8) ^ data[i]];
+  }
+  return crcVal;
 }
 
 uint32_t compCRC(int bitdepth, const Pel *plane, uint32_t width, uint32_t height, ptrdiff_t stride, PictureHash &digest)
 {
-  uint32_t crcMsb;
-  uint32_t bitVal;
-  uint32_t crcVal = 0xffff;
-  uint32_t bitIdx;
+  // The CRC is specified bitwise with initial value 0xffff and 16 zero bits appended to the message. Starting from
+  // 0xffff advanced by 16 zero bits (0x1d0f) and shifting whole bytes through the table gives the same result.
+  uint32_t crcVal = 0x1d0f;
+
+  // the first byte of each sample is its low byte, followed by the high byte if bit depth is greater than 8-bits
+  const uint32_t       bytesPerSample = bitdepth > 8 ? 2 : 1;
+  std::vector<uint8_t> row(width * bytesPerSample);
+
   for (uint32_t y = 0; y < height; y++)
   {
-    for (uint32_t x = 0; x < width; x++)
+    if (bytesPerSample == 1)
     {
-      // take CRC of first pictureData byte
-      for(bitIdx=0; bitIdx<8; bitIdx++)
-      {
-        crcMsb = (crcVal >> 15) & 1;
-        bitVal = (plane[y*stride+x] >> (7 - bitIdx)) & 1;
-        crcVal = (((crcVal << 1) + bitVal) & 0xffff) ^ (crcMsb * 0x1021);
-      }
-      // take CRC of second pictureData byte if bit depth is greater than 8-bits
-      if(bitdepth > 8)
-      {
-        for(bitIdx=0; bitIdx<8; bitIdx++)
-        {
-          crcMsb = (crcVal >> 15) & 1;
-          bitVal = (plane[y*stride+x] >> (15 - bitIdx)) & 1;
-          crcVal = (((crcVal << 1) + bitVal) & 0xffff) ^ (crcMsb * 0x1021);
-        }
-      }
+      packRow<1>(plane + y * stride, width, row.data());
     }
-  }
-  for(bitIdx=0; bitIdx<16; bitIdx++)
-  {
-    crcMsb = (crcVal >> 15) & 1;
-    crcVal = ((crcVal << 1) & 0xffff) ^ (crcMsb * 0x1021);
+    else
+    {
+      packRow<2>(plane + y * stride, width, row.data());
+    }
+    crcVal = crcUpdate(crcVal, row.data(), row.size());
   }
 
   digest.hash.push_back((crcVal>>8)  & 0xff);
@@ -126,38 +156,92 @@ uint32_t compCRC(int bitdepth, const Pel *plane, uint32_t width, uint32_t height
   return 2;
 }
 
-uint32_t calcCRC(const CPelUnitBuf& pic, PictureHash &digest, const BitDepths &bitDepths)
+/**
+ * Hash all planes of pic with hashPlane(compID, planeDigest), which returns the
+ * digest length, and append the plane digests to digest in component order.
+ * Each plane has its own hash state, so the chroma planes of larger pictures
+ * are hashed on separate threads while the luma plane is hashed on the
+ * calling thread.
+ */
+template<typename HashPlaneFunc>
+static uint32_t hashPlanes(const CPelUnitBuf &pic, PictureHash &digest, HashPlaneFunc hashPlane)
 {
-  uint32_t digestLen=0;
+  static constexpr uint32_t MIN_CONCURRENT_AREA = 1 << 16;   // luma samples
+
+  const uint32_t numComp = (uint32_t) pic.bufs.size();
+  uint32_t       digestLen[MAX_NUM_COMPONENT] = { 0 };
+  PictureHash    planeDigest[MAX_NUM_COMPONENT];
+
+#if ENABLE_CONCURRENT_PICTURE_HASH
+  if (numComp > 1 && pic.get(COMPONENT_Y).area() >= MIN_CONCURRENT_AREA)
+  {
+    std::future<uint32_t> chromaHash[MAX_NUM_COMPONENT];
+    for (uint32_t chan = 1; chan < numComp; chan++)
+    {
+      chromaHash[chan] =
+        std::async(std::launch::async, [&, chan]() { return hashPlane(ComponentID(chan), planeDigest[chan]); });
+    }
+    digestLen[COMPONENT_Y] = hashPlane(COMPONENT_Y, planeDigest[COMPONENT_Y]);
+    for (uint32_t chan = 1; chan < numComp; chan++)
+    {
+      digestLen[chan] = chromaHash[chan].get();
+    }
+  }
+  else
+#endif
+  {
+    for (uint32_t chan = 0; chan < numComp; chan++)
+    {
+      digestLen[chan] = hashPlane(ComponentID(chan), planeDigest[chan]);
+    }
+  }
+
   digest.hash.clear();
-  for (uint32_t chan = 0; chan< (uint32_t)pic.bufs.size(); chan++)
+  for (uint32_t chan = 0; chan < numComp; chan++)
   {
-    const ComponentID compID = ComponentID(chan);
-    const CPelBuf area = pic.get(compID);
-    digestLen =
-      compCRC(bitDepths[toChannelType(compID)], area.bufAt(0, 0), area.width, area.height, area.stride, digest);
+    digest.hash.insert(digest.hash.end(), planeDigest[chan].hash.begin(), planeDigest[chan].hash.end());
   }
-  return digestLen;
+  return numComp > 0 ? digestLen[numComp - 1] : 0;
+}
+
+uint32_t calcCRC(const CPelUnitBuf& pic, PictureHash &digest, const BitDepths &bitDepths)
+{
+  return hashPlanes(pic, digest, [&](const ComponentID compID, PictureHash &planeDigest)
+  {
+    const CPelBuf area = pic.get(compID);
+    return compCRC(bitDepths[toChannelType(compID)], area.bufAt(0, 0), area.width, area.height, area.stride,
+                   planeDigest);
+  });
 }
 
 uint32_t compChecksum(int bitdepth, const Pel *plane, uint32_t width, uint32_t height, ptrdiff_t stride,
                       PictureHash &digest, const BitDepths & /*bitDepths*/)
 {
   uint32_t checksum = 0;
-  uint8_t xor_mask;
 
   for (uint32_t y = 0; y < height; y++)
   {
-    for (uint32_t x = 0; x < width; x++)
-    {
-      xor_mask = (x & 0xff) ^ (y & 0xff) ^ (x >> 8) ^ (y >> 8);
-      checksum = (checksum + ((plane[y*stride+x] & 0xff) ^ xor_mask)) & 0xffffffff;
+    const Pel     *src    = plane + y * stride;
+    const uint32_t yMask  = (y & 0xff) ^ ((y >> 8) & 0xff);
+    uint32_t       rowSum = 0;
 
-      if(bitdepth > 8)
+    if (bitdepth > 8)
+    {
+      for (uint32_t x = 0; x < width; x++)
+      {
+        const uint32_t xorMask = ((x & 0xff) ^ ((x >> 8) & 0xff)) ^ yMask;
+        rowSum += ((src[x] & 0xff) ^ xorMask) + ((src[x] >> 8) ^ xorMask);
+      }
+    }
+    else
+    {
+      for (uint32_t x = 0; x < width; x++)
       {
-        checksum = (checksum + ((plane[y*stride+x]>>8) ^ xor_mask)) & 0xffffffff;
+        const uint32_t xorMask = ((x & 0xff) ^ ((x >> 8) & 0xff)) ^ yMask;
+        rowSum += (src[x] & 0xff) ^ xorMask;
       }
     }
+    checksum += rowSum;
   }
 
   digest.hash.push_back((checksum>>24) & 0xff);
@@ -169,16 +253,12 @@ uint32_t compChecksum(int bitdepth, const Pel *plane, uint32_t width, uint32_t h
 
 uint32_t calcChecksum(const CPelUnitBuf& pic, PictureHash &digest, const BitDepths &bitDepths)
 {
-  uint32_t digestLen=0;
-  digest.hash.clear();
-  for(uint32_t chan=0; chan< (uint32_t)pic.bufs.size(); chan++)
+  return hashPlanes(pic, digest, [&](const ComponentID compID, PictureHash &planeDigest)
   {
-    const ComponentID compID=ComponentID(chan);
     const CPelBuf area = pic.get(compID);
-    digestLen = compChecksum(bitDepths[toChannelType(compID)], area.bufAt(0, 0), area.width, area.height, area.stride,
-                             digest, bitDepths);
-  }
-  return digestLen;
+    return compChecksum(bitDepths[toChannelType(compID)], area.bufAt(0, 0), area.width, area.height, area.stride,
+                        planeDigest, bitDepths);
+  });
 }
 /**
  * Calculate the MD5sum of pic, storing the result in digest.
@@ -197,15 +277,10 @@ uint32_t calcMD5WithCropping(const CPelUnitBuf &pic, PictureHash &digest, const
 {
   /* choose an md5_plane packing function based on the system bitdepth */
   typedef void (*MD5PlaneFunc)(MD5 &, const Pel *, uint32_t, uint32_t, ptrdiff_t);
-  MD5PlaneFunc md5_plane_func;
-
-  MD5 md5[MAX_NUM_COMPONENT];
-
-  digest.hash.clear();
 
-  for (uint32_t chan = 0; chan< (uint32_t)pic.bufs.size(); chan++)
+  return hashPlanes(pic, digest, [&](const ComponentID compID, PictureHash &planeDigest)
   {
-    const ComponentID compID           = ComponentID(chan);
+    MD5               md5;
     const CPelBuf     area             = pic.get(compID);
     const int         chromaScaleX     = getComponentScaleX(compID, pic.chromaFormat);
     const int         chromaScaleY     = getComponentScaleY(compID, pic.chromaFormat);
@@ -213,19 +288,16 @@ uint32_t calcMD5WithCropping(const CPelUnitBuf &pic, PictureHash &digest, const
     const int         compRightOffset  = rightOffset >> chromaScaleX;
     const int         compTopOffset    = topOffset >> chromaScaleY;
     const int         compBottomOffset = bottomOffset >> chromaScaleY;
-    md5_plane_func = bitDepths[toChannelType(compID)] <= 8 ? (MD5PlaneFunc) md5_plane<1> : (MD5PlaneFunc) md5_plane<2>;
+    const MD5PlaneFunc md5_plane_func =
+      bitDepths[toChannelType(compID)] <= 8 ? (MD5PlaneFunc) md5_plane<1> : (MD5PlaneFunc) md5_plane<2>;
     uint8_t tmp_digest[MD5_DIGEST_STRING_LENGTH];
-    md5_plane_func(md5[compID], area.bufAt(compLeftOffset, compTopOffset),
+    md5_plane_func(md5, area.bufAt(compLeftOffset, compTopOffset),
                    area.width - compRightOffset - compLeftOffset, area.height - compTopOffset - compBottomOffset,
                    area.stride);
-    md5[compID].finalize(tmp_digest);
-    for (uint32_t i = 0; i < MD5_DIGEST_STRING_LENGTH; i++)
-    {
-      digest.hash.push_back(tmp_digest[i]);
-    }
-  }
-
-  return 16;
+    md5.finalize(tmp_digest);
+    planeDigest.hash.insert(planeDigest.hash.end(), tmp_digest, tmp_digest + MD5_DIGEST_STRING_LENGTH);
+    return MD5_DIGEST_STRING_LENGTH;
+  });
 }
 
 std::string hashToString(const PictureHash &digest, int numChar)
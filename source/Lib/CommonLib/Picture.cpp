@@ -114,6 +114,7 @@ void Picture::destroy()
   {
     M_BUFS(jId, t).destroy();
   }
+  destroySubPicBorderBuffers();
   m_hashMap.clearAll();
   if (cs)
   {
@@ -753,23 +754,53 @@ void Picture::sampleRateConv(const ScalingRatio scalingRatio, const int scaleX,
 
   CHECK( bitDepth > 17, "Overflow may happen!" );
 
+  // the horizontal pass uses a source position and filter phase per output column; the filters are padded with zero
+  // taps to the 4, 8 or 16 taps of the kernels
+  const int paddedLength = filterLength <= 4 ? 4 : (filterLength <= 8 ? 8 : 16);
+
+  std::vector<int>          srcPos(scaledWidth);
+  std::vector<TFilterCoeff> coeffHor(scaledWidth * paddedLength, 0);
+
+  // columns in [innerBegin, innerEnd) read all padded taps inside the picture
+  int innerBegin = scaledWidth;
+  int innerEnd   = scaledWidth;
+
   for( int i = 0; i < scaledWidth; i++ )
   {
-    const Pel* org = orgSrc;
-
     int  refPos  = (((i << scaleX) - afterScaleLeftOffset) * scalingRatio.x + addX) >> posShiftX;
     int integer = refPos >> numFracShift;
     int frac = refPos & numFracPositions;
+
+    srcPos[i] = integer - filterLength / 2 + 1;
+    std::copy_n(filterHor + frac * filterLength, filterLength, &coeffHor[i * paddedLength]);
+
+    if (srcPos[i] >= 0 && srcPos[i] + paddedLength <= orgWidth)
+    {
+      innerBegin = std::min(innerBegin, i);
+      innerEnd   = i + 1;
+    }
+  }
+
+  // columns close to the left and right picture boundaries clamp each tap to the picture
+  for (int i = 0; i < scaledWidth; i++)
+  {
+    if (i == innerBegin)
+    {
+      i = innerEnd - 1;
+      continue;
+    }
+
+    const Pel* org = orgSrc;
+    const TFilterCoeff* f = &coeffHor[i * paddedLength];
     int* tmp = buf + i;
 
     for( int j = 0; j < orgHeight; j++ )
     {
       int sum = 0;
-      const TFilterCoeff* f = filterHor + frac * filterLength;
 
       for( int k = 0; k < filterLength; k++ )
       {
-        int xInt = std::min<int>( std::max( 0, integer + k - filterLength / 2 + 1 ), orgWidth - 1 );
+        int xInt = std::min<int>( std::max( 0, srcPos[i] + k ), orgWidth - 1 );
         sum += f[k] * org[xInt]; // postpone horizontal filtering gain removal after vertical filtering
       }
 
@@ -780,7 +811,14 @@ void Picture::sampleRateConv(const ScalingRatio scalingRatio, const int scaleX,
     }
   }
 
+  if (innerBegin < innerEnd)
+  {
+    g_pelBufOP.filterScaledHor(orgSrc, orgStride, buf + innerBegin, scaledWidth, innerEnd - innerBegin, orgHeight,
+                               &srcPos[innerBegin], &coeffHor[innerBegin * paddedLength], paddedLength, 0, 0);
+  }
+
   Pel* dst = scaledSrc;
+  const int* srcRows[16];
 
   for( int j = 0; j < scaledHeight; j++ )
   {
@@ -788,21 +826,15 @@ void Picture::sampleRateConv(const ScalingRatio scalingRatio, const int scaleX,
     int integer = refPos >> numFracShift;
     int frac = refPos & numFracPositions;
 
-    for( int i = 0; i < scaledWidth; i++ )
+    for( int k = 0; k < filterLength; k++ )
     {
-      int sum = 0;
-      int* tmp = buf + i;
-      const TFilterCoeff* f = filterVer + frac * filterLength;
-
-      for( int k = 0; k < filterLength; k++ )
-      {
-        int yInt = std::min<int>( std::max( 0, integer + k - filterLength / 2 + 1 ), orgHeight - 1 );
-        sum += f[k] * tmp[yInt*scaledWidth];
-      }
-
-      dst[i] = std::min<int>( std::max( 0, ( sum + ( 1 << ( log2Norm - 1 ) ) ) >> log2Norm ), maxVal );
+      int yInt = std::min<int>( std::max( 0, integer + k - filterLength / 2 + 1 ), orgHeight - 1 );
+      srcRows[k] = buf + yInt * scaledWidth;
     }
 
+    g_pelBufOP.filterScaledVer(srcRows, filterLength, filterVer + frac * filterLength, dst, scaledWidth, log2Norm,
+                               maxVal);
+
     dst += scaledStride;
   }
 
@@ -846,13 +878,19 @@ void Picture::saveSubPicBorder(int POC, int subPicX0, int subPicY0, int subPicWi
   UnitArea unitAreaAboveBelow(cs->area.chromaFormat, areaAboveBelow);
   UnitArea unitAreaLeftRight(cs->area.chromaFormat, areaLeftRight);
 
-  // 1.3 create back up memory
-  m_bufSubPicAbove.create(unitAreaAboveBelow);
-  m_bufSubPicBelow.create(unitAreaAboveBelow);
-  m_bufSubPicLeft.create(unitAreaLeftRight);
-  m_bufSubPicRight.create(unitAreaLeftRight);
-  m_bufWrapSubPicAbove.create(unitAreaAboveBelow);
-  m_bufWrapSubPicBelow.create(unitAreaAboveBelow);
+  // 1.3 create back up memory, which is kept for the following slices as long as the subpicture size is the same
+  if (m_bufSubPicAbove.bufs.empty() || m_bufSubPicAbove.Y() != areaAboveBelow.size()
+      || m_bufSubPicLeft.Y() != areaLeftRight.size())
+  {
+    destroySubPicBorderBuffers();
+
+    m_bufSubPicAbove.create(unitAreaAboveBelow);
+    m_bufSubPicBelow.create(unitAreaAboveBelow);
+    m_bufSubPicLeft.create(unitAreaLeftRight);
+    m_bufSubPicRight.create(unitAreaLeftRight);
+    m_bufWrapSubPicAbove.create(unitAreaAboveBelow);
+    m_bufWrapSubPicBelow.create(unitAreaAboveBelow);
+  }
 
   for (int comp = 0; comp < getNumberValidComponents(cs->area.chromaFormat); comp++)
   {
@@ -960,25 +998,7 @@ void Picture::extendSubPicBorder(int POC, int subPicX0, int subPicY0, int subPic
     Pel *src = s.bufAt(left, top);
 
     // 4.1 apply padding for left and right
-    {
-      Pel *dstLeft  = src - xmargin;
-      Pel *dstRight = src + width;
-      Pel *srcLeft  = src + 0;
-      Pel *srcRight = src + width - 1;
-
-      for (int y = 0; y < height; y++)
-      {
-        for (int x = 0; x < xmargin; x++)
-        {
-          dstLeft[x]  = *srcLeft;
-          dstRight[x] = *srcRight;
-        }
-        dstLeft += s.stride;
-        dstRight += s.stride;
-        srcLeft += s.stride;
-        srcRight += s.stride;
-      }
-    }
+    g_pelBufOP.extendHor(src, s.stride, width, height, xmargin);
 
     // 4.2 apply padding on bottom
     Pel *srcBottom = src + s.stride * (height - 1) - xmargin;
@@ -1116,8 +1136,10 @@ void Picture::restoreSubPicBorder(int POC, int subPicX0, int subPicY0, int subPi
       }
     }
   }
+}
 
-  // 5.0 destroy the back up memory
+void Picture::destroySubPicBorderBuffers()
+{
   m_bufSubPicAbove.destroy();
   m_bufSubPicBelow.destroy();
   m_bufSubPicLeft.destroy();
@@ -1147,15 +1169,8 @@ void Picture::extendPicBorder( const PPS *pps )
 
     Pel*  pi = piTxt;
     // do left and right margins
-    for (int y = 0; y < p.height; y++)
-    {
-      for (int x = 0; x < xmargin; x++)
-      {
-        pi[-xmargin + x] = pi[0];
-        pi[p.width + x]  = pi[p.width - 1];
-      }
-      pi += p.stride;
-    }
+    g_pelBufOP.extendHor(pi, p.stride, p.width, p.height, xmargin);
+    pi += p.height * p.stride;
 
     // pi is now the (0,height) (bottom left of image within bigger picture
     pi -= (p.stride + xmargin);
@@ -1200,21 +1215,14 @@ void Picture::extendWrapBorder( const PPS *pps )
     int ymargin = margin >> getComponentScaleY( compID, cs->area.chromaFormat );
     Pel*  pi = piTxt;
     int xoffset = pps->getWrapAroundOffset() >> getComponentScaleX( compID, cs->area.chromaFormat );
+    // the margin samples closer than the wrap-around offset are copied from the opposite side of the picture, the
+    // remaining ones repeat the boundary samples
+    const int wrapMargin = std::min(xmargin, xoffset);
+    g_pelBufOP.extendHor(pi, p.stride, p.width, p.height, xmargin);
     for (int y = 0; y < p.height; y++)
     {
-      for (int x = 0; x < xmargin; x++ )
-      {
-        if( x < xoffset )
-        {
-          pi[ -x - 1 ] = pi[ -x - 1 + xoffset ];
-          pi[  p.width + x ] = pi[ p.width + x - xoffset ];
-        }
-        else
-        {
-          pi[ -x - 1 ] = pi[ 0 ];
-          pi[  p.width + x ] = pi[ p.width - 1 ];
-        }
-      }
+      ::memcpy(pi - wrapMargin, pi + xoffset - wrapMargin, sizeof(Pel) * wrapMargin);
+      ::memcpy(pi + p.width, pi + p.width - xoffset, sizeof(Pel) * wrapMargin);
       pi += p.stride;
     }
     pi -= (p.stride + xmargin);
@@ -211,6 +211,7 @@ public:
   void    saveSubPicBorder(int POC, int subPicX0, int subPicY0, int subPicWidth, int subPicHeight);
   void  extendSubPicBorder(int POC, int subPicX0, int subPicY0, int subPicWidth, int subPicHeight);
   void restoreSubPicBorder(int POC, int subPicX0, int subPicY0, int subPicWidth, int subPicHeight);
+  void destroySubPicBorderBuffers();
 #if GREEN_METADATA_SEI_ENABLED
   void setFeatureCounter (FeatureCounterStruct b ) { m_featureCounter = b;}
   FeatureCounterStruct getFeatureCounter (){return m_featureCounter;}
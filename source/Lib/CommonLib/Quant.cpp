@@ -125,6 +125,85 @@ QpParam::QpParam(const TransformUnit& tu, const ComponentID &compIDX, const int
 }
 
 
+// ====================================================================================================================
+// Block kernels
+// ====================================================================================================================
+
+static void dequantCoeffsCore(const TCoeff *src, TCoeff *dst, const int numCoeff, const int *scales, const int scale,
+                              const int rightShift, const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum,
+                              const TCoeff outputMinimum, const TCoeff outputMaximum)
+{
+  if (rightShift > 0)
+  {
+    const Intermediate_Int add = (Intermediate_Int) 1 << (rightShift - 1);
+
+    for (int n = 0; n < numCoeff; n++)
+    {
+      const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, src[n]));
+      const Intermediate_Int coeffQ    = (Intermediate_Int(clipQCoef) * (scales ? scales[n] : scale) + add) >> rightShift;
+
+      dst[n] = TCoeff(Clip3<Intermediate_Int>(outputMinimum, outputMaximum, coeffQ));
+    }
+  }
+  else
+  {
+    const int leftShift = -rightShift;
+
+    for (int n = 0; n < numCoeff; n++)
+    {
+      const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, src[n]));
+      const Intermediate_Int coeffQ    = (Intermediate_Int(clipQCoef) * (scales ? scales[n] : scale)) * (1 << leftShift);
+
+      dst[n] = TCoeff(Clip3<Intermediate_Int>(outputMinimum, outputMaximum, coeffQ));
+    }
+  }
+}
+
+static TCoeff quantCoeffsCore(const TCoeff *src, TCoeff *dst, TCoeff *deltaU, const int numCoeff, const int *scales,
+                              const int scale, const int64_t add, const int qBits, const TCoeff entropyCodingMinimum,
+                              const TCoeff entropyCodingMaximum)
+{
+  const int qBits8 = qBits - 8;
+  TCoeff    absSum = 0;
+
+  for (int n = 0; n < numCoeff; n++)
+  {
+    const TCoeff  level    = src[n];
+    const int64_t tmpLevel = (int64_t) abs(level) * (scales ? scales[n] : scale);
+
+    const TCoeff quantisedMagnitude = TCoeff((tmpLevel + add) >> qBits);
+    deltaU[n]                       = (TCoeff) ((tmpLevel - ((int64_t) quantisedMagnitude << qBits)) >> qBits8);
+
+    absSum += quantisedMagnitude;
+    const TCoeff quantisedCoefficient = level < 0 ? -quantisedMagnitude : quantisedMagnitude;
+
+    dst[n] = Clip3<TCoeff>(entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient);
+  }
+
+  return absSum;
+}
+
+static void rdoqLevelsCore(const TCoeff *src, const ScanElement *scan, const int numCoeff, const int *scales,
+                           const int scale, const double *errScales, const double errScale, const int qBits,
+                           const TCoeff maxLevel, Intermediate_Int *levelDouble, TCoeff *maxAbsLevel, double *costCoeff0)
+{
+  const Intermediate_Int half     = Intermediate_Int(1) << (qBits - 1);
+  const int64_t          maxValue = std::numeric_limits<Intermediate_Int>::max() - half;
+
+  for (int n = 0; n < numCoeff; n++)
+  {
+    const uint32_t blkPos   = scan[n].idx;
+    const int64_t  tmpLevel = int64_t(abs(src[blkPos])) * (scales ? scales[blkPos] : scale);
+
+    levelDouble[n] = (Intermediate_Int) std::min<int64_t>(tmpLevel, maxValue);
+    maxAbsLevel[n] = std::min<uint32_t>(uint32_t(maxLevel), uint32_t((levelDouble[n] + half) >> qBits));
+
+    const double err = double(levelDouble[n]);
+    costCoeff0[n]    = err * err * (errScales ? errScales[blkPos] : errScale);
+  }
+}
+
+
 // ====================================================================================================================
 // Quant class member functions
 // ====================================================================================================================
@@ -132,6 +211,14 @@ QpParam::QpParam(const TransformUnit& tu, const ComponentID &compIDX, const int
 Quant::Quant( const Quant* other )
 {
   xInitScalingList( other );
+
+  m_dequantCoeffs = dequantCoeffsCore;
+  m_quantCoeffs   = quantCoeffsCore;
+  m_rdoqLevels    = rdoqLevelsCore;
+
+#if ENABLE_SIMD_OPT_QUANT && defined( TARGET_SIMD_X86 )
+  initQuantX86();
+#endif
 }
 
 Quant::~Quant()
@@ -421,30 +508,8 @@ void Quant::dequant(const TransformUnit &tu,
     const uint32_t uiLog2TrHeight = floorLog2(uiHeight);
     int           *piDequantCoef  = getDequantCoeff(scalingListType, qpRem, uiLog2TrWidth, uiLog2TrHeight);
 
-    if(rightShift > 0)
-    {
-      const Intermediate_Int iAdd = (Intermediate_Int) 1 << (rightShift - 1);
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = ((Intermediate_Int(clipQCoef) * piDequantCoef[n]) + iAdd ) >> rightShift;
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
-    else
-    {
-      const int leftShift = -rightShift;
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * piDequantCoef[n]) << leftShift;
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
+    m_dequantCoeffs(piQCoef, piCoef, numSamplesInBlock, piDequantCoef, 0, rightShift, inputMinimum, inputMaximum,
+                    transformMinimum, transformMaximum);
   }
   else
   {
@@ -458,30 +523,8 @@ void Quant::dequant(const TransformUnit &tu,
     const Intermediate_Int inputMinimum        = -(1 << (targetInputBitDepth - 1));
     const Intermediate_Int inputMaximum        =  (1 << (targetInputBitDepth - 1)) - 1;
 
-    if (rightShift > 0)
-    {
-      const Intermediate_Int iAdd = (Intermediate_Int) 1 << (rightShift - 1);
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * scale + iAdd) >> rightShift;
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
-    else
-    {
-      const int leftShift = -rightShift;
-
-      for( int n = 0; n < numSamplesInBlock; n++ )
-      {
-        const TCoeff           clipQCoef = TCoeff(Clip3<Intermediate_Int>(inputMinimum, inputMaximum, piQCoef[n]));
-        const Intermediate_Int iCoeffQ   = (Intermediate_Int(clipQCoef) * scale) * (1 << leftShift);
-
-        piCoef[n] = TCoeff(Clip3<Intermediate_Int>(transformMinimum,transformMaximum,iCoeffQ));
-      }
-    }
+    m_dequantCoeffs(piQCoef, piCoef, numSamplesInBlock, nullptr, scale, rightShift, inputMinimum, inputMaximum,
+                    transformMinimum, transformMaximum);
   }
 }
 
@@ -991,25 +1034,35 @@ void Quant::quant(TransformUnit &tu, const ComponentID &compID, const CCoeffBuf
       lfnstIdx > 0 ? (((uiWidth == 4 && uiHeight == 4) || (uiWidth == 8 && uiHeight == 8)) ? 8 : 16) : piQCoef.area();
     memset(piQCoef.buf, 0, sizeof(TCoeff) * piQCoef.area());
 
-    const ScanElement* scan = g_scanOrder[SCAN_GROUPED_4x4][CoeffScanType::DIAG][gp_sizeIdxInfo->idxFrom(uiWidth)][gp_sizeIdxInfo->idxFrom(uiHeight)];
-
-    for (int uiScanPos = 0; uiScanPos < maxNumberOfCoeffs; uiScanPos++)
+    if (maxNumberOfCoeffs == piQCoef.area())
     {
-      const int    uiBlockPos = scan[uiScanPos].idx;
-      const TCoeff iLevel     = piCoef.buf[uiBlockPos];
-      const TCoeff iSign      = (iLevel < 0 ? -1 : 1);
+      // all coefficients are quantised, so the scan order is irrelevant and the block is processed in raster order
+      absSum += m_quantCoeffs(piCoef.buf, piQCoef.buf, deltaU, maxNumberOfCoeffs,
+                              enableScalingLists ? piQuantCoeff : nullptr, defaultQuantisationCoefficient, iAdd, iQBits,
+                              entropyCodingMinimum, entropyCodingMaximum);
+    }
+    else
+    {
+      const ScanElement* scan = g_scanOrder[SCAN_GROUPED_4x4][CoeffScanType::DIAG][gp_sizeIdxInfo->idxFrom(uiWidth)][gp_sizeIdxInfo->idxFrom(uiHeight)];
+
+      for (int uiScanPos = 0; uiScanPos < maxNumberOfCoeffs; uiScanPos++)
+      {
+        const int    uiBlockPos = scan[uiScanPos].idx;
+        const TCoeff iLevel     = piCoef.buf[uiBlockPos];
+        const TCoeff iSign      = (iLevel < 0 ? -1 : 1);
 
-      const int64_t tmpLevel =
-        (int64_t) abs(iLevel) * (enableScalingLists ? piQuantCoeff[uiBlockPos] : defaultQuantisationCoefficient);
+        const int64_t tmpLevel =
+          (int64_t) abs(iLevel) * (enableScalingLists ? piQuantCoeff[uiBlockPos] : defaultQuantisationCoefficient);
 
-      const TCoeff quantisedMagnitude = TCoeff((tmpLevel + iAdd) >> iQBits);
-      deltaU[uiBlockPos]              = (TCoeff) ((tmpLevel - ((int64_t) quantisedMagnitude << iQBits)) >> qBits8);
+        const TCoeff quantisedMagnitude = TCoeff((tmpLevel + iAdd) >> iQBits);
+        deltaU[uiBlockPos]              = (TCoeff) ((tmpLevel - ((int64_t) quantisedMagnitude << iQBits)) >> qBits8);
 
-      absSum += quantisedMagnitude;
-      const TCoeff quantisedCoefficient = quantisedMagnitude * iSign;
+        absSum += quantisedMagnitude;
+        const TCoeff quantisedCoefficient = quantisedMagnitude * iSign;
 
-      piQCoef.buf[uiBlockPos] = Clip3<TCoeff>(entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient);
-    } // for n
+        piQCoef.buf[uiBlockPos] = Clip3<TCoeff>(entropyCodingMinimum, entropyCodingMaximum, quantisedCoefficient);
+      } // for n
+    }
     if (cctx.bdpcm() != BdpcmMode::NONE)
     {
       fwdResDPCM(tu, compID);
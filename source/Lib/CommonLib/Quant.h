@@ -139,8 +139,24 @@ public:
   // de-quantization
   virtual void dequant           ( const TransformUnit &tu, CoeffBuf &dstCoeff, const ComponentID &compID, const QpParam &cQP );
 
+#ifdef TARGET_SIMD_X86
+  void initQuantX86();
+  template <X86_VEXT vext>
+  void _initQuantX86();
+#endif
+
 protected:
 
+  // scaling of a block of coefficients, scales == nullptr selects the flat scale
+  void   ( *m_dequantCoeffs )( const TCoeff *src, TCoeff *dst, const int numCoeff, const int *scales, const int scale, const int rightShift,
+                               const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum, const TCoeff outputMinimum, const TCoeff outputMaximum );
+  // scalar quantization of a block of coefficients in raster order, returns the sum of the absolute levels
+  TCoeff ( *m_quantCoeffs )  ( const TCoeff *src, TCoeff *dst, TCoeff *deltaU, const int numCoeff, const int *scales, const int scale, const int64_t add,
+                               const int qBits, const TCoeff entropyCodingMinimum, const TCoeff entropyCodingMaximum );
+  // RDOQ first pass: candidate level and uncoded distortion for the coefficients of one coefficient group in scan order
+  void   ( *m_rdoqLevels )   ( const TCoeff *src, const ScanElement *scan, const int numCoeff, const int *scales, const int scale, const double *errScales,
+                               const double errScale, const int qBits, const TCoeff maxLevel, Intermediate_Int *levelDouble, TCoeff *maxAbsLevel, double *costCoeff0 );
+
   bool xNeedRDOQ                 ( TransformUnit &tu, const ComponentID &compID, const CCoeffBuf &pSrc, const QpParam &cQP );
 
   double   m_dLambda;
@@ -698,6 +698,13 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
       uint32_t    blkPos = cctx.blockPos( iScanPos );
       piDstCoeff[ blkPos ] = 0;
     }
+    // candidate levels and uncoded distortion of the whole coefficient group
+    Intermediate_Int levelDouble[1 << MLS_CG_SIZE];
+    TCoeff           maxAbsLevel[1 << MLS_CG_SIZE];
+
+    m_rdoqLevels( plSrcCoeff, cctx.scan() + cctx.minSubPos(), maxNonZeroPosInCG + 1, enableScalingLists ? piQCoef : nullptr, defaultQuantisationCoefficient,
+                  enableScalingLists ? pdErrScale : nullptr, defaultErrorScale, iQBits, entropyCodingMaximum, levelDouble, maxAbsLevel, pdCostCoeff0 + cctx.minSubPos() );
+
     for( int iScanPosinCG = maxNonZeroPosInCG; iScanPosinCG >= 0; iScanPosinCG-- )
     {
       iScanPos = cctx.minSubPos() + iScanPosinCG;
@@ -705,16 +712,12 @@ void QuantRDOQ::xRateDistOptQuant(TransformUnit &tu, const ComponentID &compID,
       uint32_t    uiBlkPos          = cctx.blockPos(iScanPos);
 
       // set coeff
-      const int    quantisationCoefficient = (enableScalingLists) ? piQCoef   [uiBlkPos]               : defaultQuantisationCoefficient;
       const double errorScale              = (enableScalingLists) ? pdErrScale[uiBlkPos]               : defaultErrorScale;
-      const int64_t  tmpLevel                = int64_t(abs(plSrcCoeff[ uiBlkPos ])) * quantisationCoefficient;
 
-      const Intermediate_Int lLevelDouble  = (Intermediate_Int)std::min<int64_t>(tmpLevel, std::numeric_limits<Intermediate_Int>::max() - (Intermediate_Int(1) << (iQBits - 1)));
+      const Intermediate_Int lLevelDouble  = levelDouble[iScanPosinCG];
 
-      uint32_t uiMaxAbsLevel        = std::min<uint32_t>(uint32_t(entropyCodingMaximum), uint32_t((lLevelDouble + (Intermediate_Int(1) << (iQBits - 1))) >> iQBits));
+      uint32_t uiMaxAbsLevel        = uint32_t( maxAbsLevel[iScanPosinCG] );
 
-      const double dErr         = double( lLevelDouble );
-      pdCostCoeff0[ iScanPos ]  = dErr * dErr * errorScale;
       d64BlockUncodedCost      += pdCostCoeff0[ iScanPos ];
       piDstCoeff[ uiBlkPos ]    = uiMaxAbsLevel;
 
@@ -51,8 +51,8 @@ Reshape::Reshape()
   , m_recReshaped(false)
   , m_reshape(true)
   , m_chromaScale(1 << CSCALE_FP_PREC)
-  , m_vpduX(-1)
-  , m_vpduY(-1)
+  , m_vpduLog2Size(0)
+  , m_vpduStride(0)
 {
 }
 
@@ -132,13 +132,20 @@ int  Reshape::calculateChromaAdjVpduNei(TransformUnit &tu, const CompArea &areaY
     yPos = yPos / ctuSize * ctuSize;
   }
 
-  if (isVPDUprocessed(xPos, yPos) && !cs.pcv->isEncoder)
+  // the decoder derives the scale once per VPDU, the encoder changes the neighbouring reconstruction and the
+  // partitioning between RD candidates and thus always derives it
+  int *cachedScale = nullptr;
+  if (!cs.pcv->isEncoder && !m_vpduChromaScale.empty())
   {
-    return getChromaScale();
+    cachedScale = &m_vpduChromaScale[(yPos >> m_vpduLog2Size) * m_vpduStride + (xPos >> m_vpduLog2Size)];
+  }
+
+  if (cachedScale && *cachedScale >= 0)
+  {
+    return *cachedScale;
   }
   else
   {
-    setVPDULoc(xPos, yPos);
     Position topLeft(xPos, yPos);
     CodingUnit *topLeftLuma;
     const CodingUnit *cuAbove, *cuLeft;
@@ -203,9 +210,23 @@ int  Reshape::calculateChromaAdjVpduNei(TransformUnit &tu, const CompArea &areaY
     }
     chromaScale = calculateChromaAdj(lumaValue);
     setChromaScale(chromaScale);
+    if (cachedScale)
+    {
+      *cachedScale = chromaScale;
+    }
     return(chromaScale);
   }
 }
+/** invalidate the chroma residual scales of all VPDUs
+* \param picture width, picture height and CTU size in luma samples
+*/
+void Reshape::resetVpduChromaScale(int picWidth, int picHeight, int ctuSize)
+{
+  m_vpduLog2Size = floorLog2(std::min(64, ctuSize));
+  m_vpduStride   = (picWidth + (1 << m_vpduLog2Size) - 1) >> m_vpduLog2Size;
+  m_vpduChromaScale.assign(m_vpduStride * ((picHeight + (1 << m_vpduLog2Size) - 1) >> m_vpduLog2Size), -1);
+}
+
 /** find inx of PWL for inverse mapping
 * \param average luma pred of TU
 * \return idx of PWL for inverse mapping
@@ -68,8 +68,9 @@ protected:
   int                     m_lumaBD;
   int                     m_reshapeLUTSize;
   int                     m_chromaScale;
-  int                     m_vpduX;
-  int                     m_vpduY;
+  std::vector<int>        m_vpduChromaScale;   ///< chroma residual scale per VPDU of the current slice, -1 if not derived yet
+  int                     m_vpduLog2Size;
+  int                     m_vpduStride;
 public:
   Reshape();
   ~Reshape();
@@ -95,8 +96,7 @@ public:
   bool getReshapeFlag() { return m_reshape; }
   void setReshapeFlag(bool b) { m_reshape = b; }
   int  calculateChromaAdjVpduNei(TransformUnit &tu, const CompArea &areaY);
-  void setVPDULoc(int x, int y) { m_vpduX = x, m_vpduY = y; }
-  bool isVPDUprocessed(int x, int y) { return ((x == m_vpduX) && (y == m_vpduY)); }
+  void resetVpduChromaScale(int picWidth, int picHeight, int ctuSize);
   void setChromaScale (int chromaScale) { m_chromaScale = chromaScale; }
   int  getChromaScale() { return m_chromaScale; }
 };// END CLASS DEFINITION Reshape
@@ -111,6 +111,48 @@ const SAOBlkParam& SAOBlkParam::operator= (const SAOBlkParam& src)
 SampleAdaptiveOffset::SampleAdaptiveOffset()
 {
   m_numberOfComponents = 0;
+
+  m_calcEdgeStats = calcEdgeStats;
+  m_calcBandStats = calcBandStats;
+
+#if ENABLE_SIMD_OPT_SAO
+#ifdef TARGET_SIMD_X86
+  initSampleAdaptiveOffsetX86();
+#endif
+#endif
+}
+
+void SampleAdaptiveOffset::calcEdgeStats(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride,
+                                         int width, int height, ptrdiff_t offsetA, ptrdiff_t offsetB, int64_t *diff,
+                                         int64_t *count)
+{
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      const int edgeType = sgn(src[x] - src[x + offsetA]) + sgn(src[x] - src[x + offsetB]);
+      diff[edgeType] += org[x] - src[x];
+      count[edgeType]++;
+    }
+    src += srcStride;
+    org += orgStride;
+  }
+}
+
+void SampleAdaptiveOffset::calcBandStats(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride,
+                                         int width, int height, int shift, int64_t *diff, int64_t *count)
+{
+  for (int y = 0; y < height; y++)
+  {
+    for (int x = 0; x < width; x++)
+    {
+      const int bandIdx = src[x] >> shift;
+      diff[bandIdx] += org[x] - src[x];
+      count[bandIdx]++;
+    }
+    src += srcStride;
+    org += orgStride;
+  }
 }
 
 SampleAdaptiveOffset::~SampleAdaptiveOffset()
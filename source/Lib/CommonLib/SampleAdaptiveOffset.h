@@ -72,6 +72,26 @@ public:
     return (1 << (std::min<int>(channelBitDepth, MAX_SAO_TRUNCATED_BITDEPTH) - 5)) - 1;
   }   // Table 9-32, inclusive
 
+  // Edge offset statistics of a block (encoder). For every sample the edge class sgn(s - s[offsetA]) +
+  // sgn(s - s[offsetB]) is derived, and org - s and one sample are added to diff and count of that class. diff and
+  // count point to the entries of class 0, i.e. they are indexed from -2 to 2.
+  void (*m_calcEdgeStats)(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride, int width,
+                          int height, ptrdiff_t offsetA, ptrdiff_t offsetB, int64_t *diff, int64_t *count);
+  // Band offset statistics of a block (encoder), the band of a sample s is s >> shift
+  void (*m_calcBandStats)(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride, int width,
+                          int height, int shift, int64_t *diff, int64_t *count);
+
+  static void calcEdgeStats(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride, int width,
+                            int height, ptrdiff_t offsetA, ptrdiff_t offsetB, int64_t *diff, int64_t *count);
+  static void calcBandStats(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride, int width,
+                            int height, int shift, int64_t *diff, int64_t *count);
+
+#ifdef TARGET_SIMD_X86
+  void initSampleAdaptiveOffsetX86();
+  template <X86_VEXT vext>
+  void _initSampleAdaptiveOffsetX86();
+#endif
+
 protected:
   using MergeBlkParams = EnumArray<SAOBlkParam *, SAOModeMergeTypes>;
 
@@ -202,6 +202,45 @@ void TrQuant::xDeQuant(const TransformUnit &tu,
   m_quant->dequant( tu, dstCoeff, compID, cQP );
 }
 
+static void fwdLfnstCore( const TCoeff* src, TCoeff* dst, const int8_t* trMat, int trSize, int zeroOutSize )
+{
+  TCoeff  coef;
+  TCoeff* out = dst;
+
+  for( int j = 0; j < zeroOutSize; j++ )
+  {
+    const TCoeff* srcPtr   = src;
+    const int8_t* trMatTmp = trMat;
+    coef = 0;
+    for( int i = 0; i < trSize; i++ )
+    {
+      coef += *srcPtr++ * *trMatTmp++;
+    }
+    *out++ = ( coef + 64 ) >> 7;
+    trMat += trSize;
+  }
+}
+
+static void invLfnstCore( const TCoeff* src, TCoeff* dst, const int8_t* trMat, int trSize, int zeroOutSize, const TCoeff outputMinimum, const TCoeff outputMaximum )
+{
+  TCoeff  resi;
+  TCoeff* out = dst;
+
+  for( int j = 0; j < trSize; j++ )
+  {
+    resi = 0;
+    const int8_t* trMatTmp = trMat;
+    const TCoeff* srcPtr   = src;
+    for( int i = 0; i < zeroOutSize; i++ )
+    {
+      resi += *srcPtr++ * *trMatTmp;
+      trMatTmp += trSize;
+    }
+    *out++ = Clip3<TCoeff>( outputMinimum, outputMaximum, ( resi + 64 ) >> 7 );
+    trMat++;
+  }
+}
+
 void TrQuant::init( const Quant* otherQuant,
                     const uint32_t uiMaxTrSize,
                     const bool bUseRDOQ,
@@ -262,6 +301,9 @@ void TrQuant::init( const Quant* otherQuant,
   m_invTx[TransType::DST7][4] = fastInverseDST7_B32;
   m_invTx[TransType::DST7][5] = nullptr;
 
+  m_fwdLfnst = fwdLfnstCore;
+  m_invLfnst = invLfnstCore;
+
 #ifdef TARGET_SIMD_X86
   initX86();
 #endif
@@ -271,24 +313,11 @@ void TrQuant::fwdLfnstNxN( TCoeff* src, TCoeff* dst, const uint32_t mode, const
 {
   const int8_t* trMat  = ( size > 4 ) ? g_lfnst8x8[ mode ][ index ][ 0 ] : g_lfnst4x4[ mode ][ index ][ 0 ];
   const int     trSize = ( size > 4 ) ? 48 : 16;
-  TCoeff           coef;
-  TCoeff*          out    = dst;
   assert( index < 3 );
 
-  for( int j = 0; j < zeroOutSize; j++ )
-  {
-    TCoeff*          srcPtr   = src;
-    const int8_t* trMatTmp = trMat;
-    coef = 0;
-    for( int i = 0; i < trSize; i++ )
-    {
-      coef += *srcPtr++ * *trMatTmp++;
-    }
-    *out++ = ( coef + 64 ) >> 7;
-    trMat += trSize;
-  }
+  m_fwdLfnst( src, dst, trMat, trSize, zeroOutSize );
 
-  std::fill_n( out, trSize - zeroOutSize, 0 );
+  std::fill_n( dst + zeroOutSize, trSize - zeroOutSize, 0 );
 }
 
 void TrQuant::invLfnstNxN( TCoeff* src, TCoeff* dst, const uint32_t mode, const uint32_t index, const uint32_t size, int zeroOutSize, const int maxLog2TrDynamicRange )
@@ -297,23 +326,9 @@ void TrQuant::invLfnstNxN( TCoeff* src, TCoeff* dst, const uint32_t mode, const
   const TCoeff    outputMaximum         =  ( 1 << maxLog2TrDynamicRange ) - 1;
   const int8_t*   trMat                 =  ( size > 4 ) ? g_lfnst8x8[ mode ][ index ][ 0 ] : g_lfnst4x4[ mode ][ index ][ 0 ];
   const int       trSize                =  ( size > 4 ) ? 48 : 16;
-  TCoeff          resi;
-  TCoeff*         out                   =  dst;
   assert( index < 3 );
 
-  for( int j = 0; j < trSize; j++ )
-  {
-    resi = 0;
-    const int8_t* trMatTmp = trMat;
-    TCoeff*       srcPtr   = src;
-    for( int i = 0; i < zeroOutSize; i++ )
-    {
-      resi += *srcPtr++ * *trMatTmp;
-      trMatTmp += trSize;
-    }
-    *out++ = Clip3<TCoeff>( outputMinimum, outputMaximum, ( resi + 64 ) >> 7 );
-    trMat++;
-  }
+  m_invLfnst( src, dst, trMat, trSize, zeroOutSize, outputMinimum, outputMaximum );
 }
 
 uint32_t TrQuant::getLFNSTIntraMode( int wideAngPredMode )
@@ -53,6 +53,8 @@
 
 typedef void FwdTrans(const TCoeff*, TCoeff*, int, int, int, int);
 typedef void InvTrans(const TCoeff*, TCoeff*, int, int, int, int, const TCoeff, const TCoeff);
+typedef void FwdLfnst(const TCoeff*, TCoeff*, const int8_t*, int, int);
+typedef void InvLfnst(const TCoeff*, TCoeff*, const int8_t*, int, int, const TCoeff, const TCoeff);
 
 // ====================================================================================================================
 // Class definition
@@ -94,6 +96,9 @@ protected:
   EnumArray<std::array<FwdTrans*, NUM_TRANSFORM_MATRIX_SIZES>, TransType> m_fwdTx;
   EnumArray<std::array<InvTrans*, NUM_TRANSFORM_MATRIX_SIZES>, TransType> m_invTx;
 
+  FwdLfnst* m_fwdLfnst;
+  InvLfnst* m_invLfnst;
+
   void xFwdLfnst( const TransformUnit &tu, const ComponentID compID, const bool loadTr = false );
   void xInvLfnst( const TransformUnit &tu, const ComponentID compID );
 
@@ -193,12 +193,21 @@
 #define ENABLE_SIMD_OPT_DIST                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the distortion calculations(SAD,SSE,HADAMARD), no impact on RD performance
 #define ENABLE_SIMD_OPT_AFFINE_ME                       ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for affine ME, no impact on RD performance
 #define ENABLE_SIMD_OPT_ALF                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for ALF
+#define ENABLE_SIMD_OPT_DEPQUANT                        ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the dependent quantization trellis, no impact on RD performance
+#define ENABLE_SIMD_OPT_QUANT                           ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for scalar quantization, dequantization and RDOQ level estimation, no impact on RD performance
+#define ENABLE_SIMD_OPT_MCTF                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the motion compensated temporal pre-filter, no impact on RD performance
+#define ENABLE_SIMD_OPT_HASH                            ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization (SSE4.2 crc32c) for the block hashes of hash-based motion estimation, no impact on RD performance
+#define ENABLE_SIMD_OPT_SAO                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the SAO statistics of the encoder, no impact on RD performance
+#define ENABLE_SIMD_OPT_FGA                             ( 1 && ENABLE_SIMD_OPT )                            ///< SIMD optimization for the film grain analysis of the encoder, no impact on RD performance
 #if ENABLE_SIMD_OPT_BUFFER
 #define ENABLE_SIMD_OPT_BCW                               1                                                 ///< SIMD optimization for Bcw
 #endif
 
 // End of SIMD optimizations
 
+#define ENABLE_PARALLEL_TILE_WRITING                    ( 1 && !ENABLE_TRACING )                            ///< Allow writing the tile substreams of a slice concurrently in the final entropy coding pass (NumTileWriterThreads), no impact on the bitstream
+#define ENABLE_CONCURRENT_PICTURE_HASH                    1                                                   ///< Hash the colour planes of larger pictures concurrently for the decoded picture hash SEI
+
 
 #define RDOQ_CHROMA_LAMBDA                                1 ///< F386: weighting of chroma for RDOQ
 
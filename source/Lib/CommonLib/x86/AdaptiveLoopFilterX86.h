@@ -1676,6 +1676,41 @@ template<X86_VEXT vext> static void simdFilter7x7Blk(AlfClassifier** classifier,
   }
 }
 #endif
+
+// The products are formed with madd on 16-bit halves: the upper half of the broadcast factor is zero, hence only the
+// low halves of x, which hold the values themselves, contribute.
+template<X86_VEXT vext>
+static void simdAccumulateCovariance(const int *x, int size, int *acc, ptrdiff_t accStride)
+{
+  for (int r = 0; r < size; r++)
+  {
+    int *dst = acc + r * accStride;
+
+#ifdef USE_AVX2
+    if (vext >= AVX2)
+    {
+      const __m256i xr = _mm256_set1_epi32(x[r] & 0xffff);
+
+      for (int c = 0; c <= r; c += 8)
+      {
+        const __m256i prod = _mm256_madd_epi16(xr, _mm256_loadu_si256((const __m256i *) &x[c]));
+        _mm256_storeu_si256((__m256i *) &dst[c], _mm256_add_epi32(_mm256_loadu_si256((const __m256i *) &dst[c]), prod));
+      }
+    }
+    else
+#endif
+    {
+      const __m128i xr = _mm_set1_epi32(x[r] & 0xffff);
+
+      for (int c = 0; c <= r; c += 4)
+      {
+        const __m128i prod = _mm_madd_epi16(xr, _mm_loadu_si128((const __m128i *) &x[c]));
+        _mm_storeu_si128((__m128i *) &dst[c], _mm_add_epi32(_mm_loadu_si128((const __m128i *) &dst[c]), prod));
+      }
+    }
+  }
+}
+
 template <X86_VEXT vext>
 void AdaptiveLoopFilter::_initAdaptiveLoopFilterX86()
 {
@@ -1698,6 +1733,7 @@ void AdaptiveLoopFilter::_initAdaptiveLoopFilterX86()
   m_filter5x5Blk = simdFilter5x5Blk<vext>;
   m_filter7x7Blk = simdFilter7x7Blk<vext>;
 #endif
+  m_accumulateCovariance = simdAccumulateCovariance<vext>;
 }
 
 template void AdaptiveLoopFilter::_initAdaptiveLoopFilterX86<SIMDX86>();
@@ -155,6 +155,359 @@ void copyBufferSimd(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dst
   }
 }
 
+#if USE_AVX2
+// Look up 8 samples: the 32-bit gather loads each entry together with its predecessor, so that the highest entry
+// is never read past. The predecessor of entry 0 is excluded by the mask and substituted.
+static inline __m256i applyLutGather(const Pel *lut, const __m256i idx, const __m256i lut0)
+{
+  const __m256i mask = _mm256_cmpgt_epi32(idx, _mm256_setzero_si256());
+  return _mm256_srli_epi32(
+    _mm256_mask_i32gather_epi32(lut0, (const int *) lut, _mm256_sub_epi32(idx, _mm256_set1_epi32(1)), mask, sizeof(Pel)),
+    16);
+}
+
+template<X86_VEXT vext> void applyLut_AVX2(Pel *ptr, ptrdiff_t stride, int width, int height, const Pel *lut)
+{
+  const __m256i lut0 = _mm256_set1_epi32(lut[0] << 16);
+
+  for (int y = 0; y < height; y++)
+  {
+    int x = 0;
+
+    for (; x + 16 <= width; x += 16)
+    {
+      const __m256i src = _mm256_loadu_si256((const __m256i *) &ptr[x]);
+      const __m256i lo  = applyLutGather(lut, _mm256_cvtepu16_epi32(_mm256_castsi256_si128(src)), lut0);
+      const __m256i hi  = applyLutGather(lut, _mm256_cvtepu16_epi32(_mm256_extracti128_si256(src, 1)), lut0);
+
+      _mm256_storeu_si256((__m256i *) &ptr[x], _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8));
+    }
+
+    for (; x + 8 <= width; x += 8)
+    {
+      const __m256i val = applyLutGather(lut, _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *) &ptr[x])), lut0);
+
+      _mm_storeu_si128((__m128i *) &ptr[x],
+                       _mm_packus_epi32(_mm256_castsi256_si128(val), _mm256_extracti128_si256(val, 1)));
+    }
+
+    for (; x < width; x++)
+    {
+      ptr[x] = lut[ptr[x]];
+    }
+
+    ptr += stride;
+  }
+}
+#endif
+
+// DMVR samples are bilinear predictions at intermediate precision, hence the differences fit into 16 bits
+template<X86_VEXT vext>
+void dmvrSadsSimd(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width, int height,
+                  uint32_t *sads)
+{
+  CHECK(width & 7, "width must be a multiple of 8");
+
+  const __m128i ones = _mm_set1_epi16(1);
+#if USE_AVX2
+  const __m256i ones256 = _mm256_set1_epi16(1);
+#endif
+
+  for (int v = -DMVR_RANGE; v <= DMVR_RANGE; v++)
+  {
+    for (int h = -DMVR_RANGE; h <= DMVR_RANGE; h++)
+    {
+      const Pel *p0 = src0 + (DMVR_RANGE + v) * src0Stride + DMVR_RANGE + h;
+      const Pel *p1 = src1 + (DMVR_RANGE - v) * src1Stride + DMVR_RANGE - h;
+
+      __m128i acc = _mm_setzero_si128();
+
+#if USE_AVX2
+      if (vext >= AVX2 && width == 16)
+      {
+        __m256i acc256 = _mm256_setzero_si256();
+
+        for (int y = 0; y < height; y += 2)
+        {
+          const __m256i a = _mm256_loadu_si256((const __m256i *) p0);
+          const __m256i b = _mm256_loadu_si256((const __m256i *) p1);
+
+          acc256 = _mm256_add_epi32(acc256, _mm256_madd_epi16(_mm256_abs_epi16(_mm256_sub_epi16(a, b)), ones256));
+
+          p0 += 2 * src0Stride;
+          p1 += 2 * src1Stride;
+        }
+
+        acc = _mm_add_epi32(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+      }
+      else
+#endif
+      {
+        for (int y = 0; y < height; y += 2)
+        {
+          for (int x = 0; x < width; x += 8)
+          {
+            const __m128i a = _mm_loadu_si128((const __m128i *) &p0[x]);
+            const __m128i b = _mm_loadu_si128((const __m128i *) &p1[x]);
+
+            acc = _mm_add_epi32(acc, _mm_madd_epi16(_mm_abs_epi16(_mm_sub_epi16(a, b)), ones));
+          }
+
+          p0 += 2 * src0Stride;
+          p1 += 2 * src1Stride;
+        }
+      }
+
+      acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4e));
+      acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xb1));
+
+      *sads++ = _mm_cvtsi128_si32(acc);
+    }
+  }
+}
+
+// squared differences are accumulated pairwise in 32 bits by madd, which cannot overflow for 16-bit samples, and
+// widened to 64 bits before they are summed up over the plane
+template<X86_VEXT vext>
+uint64_t calcSseSimd(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, int width,
+                     int height)
+{
+  const int widthSimd = width & ~7;
+
+  __m128i  acc = _mm_setzero_si128();
+  uint64_t sum = 0;
+
+#if USE_AVX2
+  if (vext >= AVX2 && width >= 16)
+  {
+    const int widthAvx2 = width & ~15;
+
+    __m256i acc256 = _mm256_setzero_si256();
+
+    for (int y = 0; y < height; y++)
+    {
+      int x = 0;
+      for (; x < widthAvx2; x += 16)
+      {
+        const __m256i a    = _mm256_loadu_si256((const __m256i *) &src0[x]);
+        const __m256i b    = _mm256_loadu_si256((const __m256i *) &src1[x]);
+        const __m256i diff = _mm256_sub_epi16(a, b);
+        const __m256i sq   = _mm256_madd_epi16(diff, diff);
+
+        acc256 = _mm256_add_epi64(acc256, _mm256_unpacklo_epi32(sq, _mm256_setzero_si256()));
+        acc256 = _mm256_add_epi64(acc256, _mm256_unpackhi_epi32(sq, _mm256_setzero_si256()));
+      }
+      for (; x < width; x++)
+      {
+        const int diff = src0[x] - src1[x];
+        sum += uint64_t(diff * diff);
+      }
+
+      src0 += src0Stride;
+      src1 += src1Stride;
+    }
+
+    acc = _mm_add_epi64(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1));
+  }
+  else
+#endif
+  {
+    for (int y = 0; y < height; y++)
+    {
+      int x = 0;
+      for (; x < widthSimd; x += 8)
+      {
+        const __m128i a    = _mm_loadu_si128((const __m128i *) &src0[x]);
+        const __m128i b    = _mm_loadu_si128((const __m128i *) &src1[x]);
+        const __m128i diff = _mm_sub_epi16(a, b);
+        const __m128i sq   = _mm_madd_epi16(diff, diff);
+
+        acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(sq, _mm_setzero_si128()));
+        acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(sq, _mm_setzero_si128()));
+      }
+      for (; x < width; x++)
+      {
+        const int diff = src0[x] - src1[x];
+        sum += uint64_t(diff * diff);
+      }
+
+      src0 += src0Stride;
+      src1 += src1Stride;
+    }
+  }
+
+  acc = _mm_add_epi64(acc, _mm_shuffle_epi32(acc, 0x4e));
+
+  return sum + _mm_cvtsi128_si64(acc);
+}
+
+// Filters with a source position and filter phase per output column, for reference picture resampling. numTaps is
+// 4, 8 or 16; the madd results of four columns are reduced together by two horizontal additions.
+template<X86_VEXT vext, typename T>
+void filterScaledHorSimd(const Pel *src, ptrdiff_t srcStride, T *dst, ptrdiff_t dstStride, int width, int height,
+                         const int *srcPos, const TFilterCoeff *coeff, int numTaps, int shift, int offset)
+{
+  CHECKD(numTaps != 4 && numTaps != 8 && numTaps != 16, "Unsupported number of taps");
+
+  const __m128i vOffset = _mm_set1_epi32(offset);
+  const __m128i vShift  = _mm_cvtsi32_si128(shift);
+
+  for (int y = 0; y < height; y++)
+  {
+    int x = 0;
+#if USE_AVX2
+    if (vext >= AVX2 && numTaps == 8)
+    {
+      for (; x + 8 <= width; x += 8)
+      {
+        const TFilterCoeff *c = coeff + x * 8;
+
+        __m256i m[4];
+        for (int i = 0; i < 4; i++)
+        {
+          const __m256i s =
+            _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (src + srcPos[x + i]))),
+                                    _mm_loadu_si128((const __m128i *) (src + srcPos[x + i + 4])), 1);
+          const __m256i f =
+            _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *) (c + i * 8))),
+                                    _mm_loadu_si128((const __m128i *) (c + (i + 4) * 8)), 1);
+          m[i] = _mm256_madd_epi16(s, f);
+        }
+
+        __m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(m[0], m[1]), _mm256_hadd_epi32(m[2], m[3]));
+        sum = _mm256_sra_epi32(_mm256_add_epi32(sum, _mm256_set1_epi32(offset)), vShift);
+
+        if constexpr (std::is_same<T, int>::value)
+        {
+          _mm256_storeu_si256((__m256i *) &dst[x], sum);
+        }
+        else
+        {
+          sum = _mm256_permute4x64_epi64(_mm256_packs_epi32(sum, sum), 0x08);
+          _mm_storeu_si128((__m128i *) &dst[x], _mm256_castsi256_si128(sum));
+        }
+      }
+    }
+#endif
+
+    for (; x + 4 <= width; x += 4)
+    {
+      const TFilterCoeff *c = coeff + x * numTaps;
+
+      __m128i sum;
+      if (numTaps == 4)
+      {
+        const __m128i s01 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *) (src + srcPos[x])),
+                                               _mm_loadl_epi64((const __m128i *) (src + srcPos[x + 1])));
+        const __m128i s23 = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *) (src + srcPos[x + 2])),
+                                               _mm_loadl_epi64((const __m128i *) (src + srcPos[x + 3])));
+
+        sum = _mm_hadd_epi32(_mm_madd_epi16(s01, _mm_loadu_si128((const __m128i *) c)),
+                             _mm_madd_epi16(s23, _mm_loadu_si128((const __m128i *) (c + 8))));
+      }
+      else
+      {
+        __m128i m[4];
+        for (int i = 0; i < 4; i++)
+        {
+          const Pel          *s = src + srcPos[x + i];
+          const TFilterCoeff *f = c + i * numTaps;
+
+          m[i] = _mm_madd_epi16(_mm_loadu_si128((const __m128i *) s), _mm_loadu_si128((const __m128i *) f));
+          if (numTaps == 16)
+          {
+            m[i] = _mm_add_epi32(m[i], _mm_madd_epi16(_mm_loadu_si128((const __m128i *) (s + 8)),
+                                                      _mm_loadu_si128((const __m128i *) (f + 8))));
+          }
+        }
+        sum = _mm_hadd_epi32(_mm_hadd_epi32(m[0], m[1]), _mm_hadd_epi32(m[2], m[3]));
+      }
+      sum = _mm_sra_epi32(_mm_add_epi32(sum, vOffset), vShift);
+
+      if constexpr (std::is_same<T, int>::value)
+      {
+        _mm_storeu_si128((__m128i *) &dst[x], sum);
+      }
+      else
+      {
+        _mm_storel_epi64((__m128i *) &dst[x], _mm_packs_epi32(sum, sum));
+      }
+    }
+
+    for (; x < width; x++)
+    {
+      const Pel          *s = src + srcPos[x];
+      const TFilterCoeff *c = coeff + x * numTaps;
+
+      int sum = 0;
+      for (int k = 0; k < numTaps; k++)
+      {
+        sum += c[k] * s[k];
+      }
+      dst[x] = T((sum + offset) >> shift);
+    }
+
+    src += srcStride;
+    dst += dstStride;
+  }
+}
+
+template<X86_VEXT vext>
+void filterScaledVerSimd(const int *const *srcRows, int numTaps, const TFilterCoeff *coeff, Pel *dst, int width,
+                         int shift, int maxVal)
+{
+  const int offset = 1 << (shift - 1);
+
+  int x = 0;
+#if USE_AVX2
+  if (vext >= AVX2)
+  {
+    const __m256i vOffset = _mm256_set1_epi32(offset);
+    const __m256i vMax    = _mm256_set1_epi32(maxVal);
+    const __m128i vShift  = _mm_cvtsi32_si128(shift);
+
+    for (; x + 8 <= width; x += 8)
+    {
+      __m256i sum = vOffset;
+      for (int k = 0; k < numTaps; k++)
+      {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) &srcRows[k][x]);
+        sum             = _mm256_add_epi32(sum, _mm256_mullo_epi32(s, _mm256_set1_epi32(coeff[k])));
+      }
+      sum = _mm256_min_epi32(_mm256_max_epi32(_mm256_sra_epi32(sum, vShift), _mm256_setzero_si256()), vMax);
+      sum = _mm256_permute4x64_epi64(_mm256_packs_epi32(sum, sum), 0x08);
+      _mm_storeu_si128((__m128i *) &dst[x], _mm256_castsi256_si128(sum));
+    }
+  }
+#endif
+
+  const __m128i vOffset = _mm_set1_epi32(offset);
+  const __m128i vMax    = _mm_set1_epi32(maxVal);
+  const __m128i vShift  = _mm_cvtsi32_si128(shift);
+
+  for (; x + 4 <= width; x += 4)
+  {
+    __m128i sum = vOffset;
+    for (int k = 0; k < numTaps; k++)
+    {
+      const __m128i s = _mm_loadu_si128((const __m128i *) &srcRows[k][x]);
+      sum             = _mm_add_epi32(sum, _mm_mullo_epi32(s, _mm_set1_epi32(coeff[k])));
+    }
+    sum = _mm_min_epi32(_mm_max_epi32(_mm_sra_epi32(sum, vShift), _mm_setzero_si128()), vMax);
+    _mm_storel_epi64((__m128i *) &dst[x], _mm_packs_epi32(sum, sum));
+  }
+
+  for (; x < width; x++)
+  {
+    int sum = 0;
+    for (int k = 0; k < numTaps; k++)
+    {
+      sum += coeff[k] * srcRows[k][x];
+    }
+    dst[x] = Pel(std::min<int>(std::max(0, (sum + offset) >> shift), maxVal));
+  }
+}
+
 template<X86_VEXT vext> void paddingSimd(Pel *dst, ptrdiff_t stride, int width, int height, int padSize)
 {
   size_t extWidth = width + 2 * padSize;
@@ -232,6 +585,215 @@ template<X86_VEXT vext> void paddingSimd(Pel *dst, ptrdiff_t stride, int width,
   }
 }
 
+template<X86_VEXT vext> void extendHorSimd(Pel *ptr, ptrdiff_t stride, int width, int height, int margin)
+{
+  if (margin < 8)
+  {
+    extendHorCore(ptr, stride, width, height, margin);
+    return;
+  }
+
+  // the last store of each side overlaps the previous ones when the margin is not a multiple of the vector size
+  for (int y = 0; y < height; y++)
+  {
+    Pel *left  = ptr - margin;
+    Pel *right = ptr + width;
+
+    int x = 0;
+#if USE_AVX2
+    if (vext >= AVX2 && margin >= 16)
+    {
+      const __m256i l = _mm256_set1_epi16(ptr[0]);
+      const __m256i r = _mm256_set1_epi16(ptr[width - 1]);
+      for (; x + 16 <= margin; x += 16)
+      {
+        _mm256_storeu_si256((__m256i *) &left[x], l);
+        _mm256_storeu_si256((__m256i *) &right[x], r);
+      }
+    }
+#endif
+    const __m128i l = _mm_set1_epi16(ptr[0]);
+    const __m128i r = _mm_set1_epi16(ptr[width - 1]);
+    for (; x + 8 <= margin; x += 8)
+    {
+      _mm_storeu_si128((__m128i *) &left[x], l);
+      _mm_storeu_si128((__m128i *) &right[x], r);
+    }
+    if (x < margin)
+    {
+      _mm_storeu_si128((__m128i *) &left[margin - 8], l);
+      _mm_storeu_si128((__m128i *) &right[margin - 8], r);
+    }
+
+    ptr += stride;
+  }
+}
+
+template<X86_VEXT vext> void unpackSamplesSimd(const uint8_t *src, bool is16bit, Pel *dst, int width, int scaleX)
+{
+  int x = 0;
+
+  if (scaleX == 0 && is16bit)
+  {
+    // file samples are little-endian, as is the host
+    memcpy(dst, src, width * sizeof(Pel));
+    return;
+  }
+  else if (scaleX == 0)
+  {
+#if USE_AVX2
+    if (vext >= AVX2)
+    {
+      for (; x + 16 <= width; x += 16)
+      {
+        const __m256i v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) &src[x]));
+        _mm256_storeu_si256((__m256i *) &dst[x], v);
+      }
+    }
+#endif
+    for (; x + 8 <= width; x += 8)
+    {
+      _mm_storeu_si128((__m128i *) &dst[x], _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *) &src[x])));
+    }
+  }
+  else if (scaleX == 1)
+  {
+    // keep the even samples
+    if (is16bit)
+    {
+      const __m128i mask = _mm_set1_epi32(0xffff);
+      for (; x + 8 <= width; x += 8)
+      {
+        const __m128i v0 = _mm_and_si128(_mm_loadu_si128((const __m128i *) &src[4 * x]), mask);
+        const __m128i v1 = _mm_and_si128(_mm_loadu_si128((const __m128i *) &src[4 * x + 16]), mask);
+        _mm_storeu_si128((__m128i *) &dst[x], _mm_packus_epi32(v0, v1));
+      }
+    }
+    else
+    {
+      const __m128i mask = _mm_set1_epi16(0xff);
+      for (; x + 8 <= width; x += 8)
+      {
+        _mm_storeu_si128((__m128i *) &dst[x], _mm_and_si128(_mm_loadu_si128((const __m128i *) &src[2 * x]), mask));
+      }
+    }
+  }
+  else if (scaleX == -1)
+  {
+    // repeat each sample twice
+    if (is16bit)
+    {
+      for (; x + 8 <= width; x += 8)
+      {
+        const __m128i v = _mm_loadl_epi64((const __m128i *) &src[x]);
+        _mm_storeu_si128((__m128i *) &dst[x], _mm_unpacklo_epi16(v, v));
+      }
+    }
+    else
+    {
+      for (; x + 16 <= width; x += 16)
+      {
+        const __m128i v = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i *) &src[x >> 1]));
+        _mm_storeu_si128((__m128i *) &dst[x], _mm_unpacklo_epi16(v, v));
+        _mm_storeu_si128((__m128i *) &dst[x + 8], _mm_unpackhi_epi16(v, v));
+      }
+    }
+  }
+
+  if (x < width)
+  {
+    const ptrdiff_t srcOffset = (scaleX >= 0 ? x << scaleX : x >> -scaleX) * (is16bit ? 2 : 1);
+    unpackSamplesCore(src + srcOffset, is16bit, dst + x, width - x, scaleX);
+  }
+}
+
+template<X86_VEXT vext> void packSamplesSimd(const Pel *src, uint8_t *dst, bool is16bit, int width)
+{
+  if (is16bit)
+  {
+    memcpy(dst, src, width * sizeof(Pel));
+    return;
+  }
+
+  // only the low-order byte of each sample is written
+  const __m128i mask = _mm_set1_epi16(0xff);
+
+  int x = 0;
+#if USE_AVX2
+  if (vext >= AVX2)
+  {
+    const __m256i mask256 = _mm256_set1_epi16(0xff);
+    for (; x + 32 <= width; x += 32)
+    {
+      const __m256i v0 = _mm256_and_si256(_mm256_loadu_si256((const __m256i *) &src[x]), mask256);
+      const __m256i v1 = _mm256_and_si256(_mm256_loadu_si256((const __m256i *) &src[x + 16]), mask256);
+      _mm256_storeu_si256((__m256i *) &dst[x], _mm256_permute4x64_epi64(_mm256_packus_epi16(v0, v1), 0xd8));
+    }
+  }
+#endif
+  for (; x + 16 <= width; x += 16)
+  {
+    const __m128i v0 = _mm_and_si128(_mm_loadu_si128((const __m128i *) &src[x]), mask);
+    const __m128i v1 = _mm_and_si128(_mm_loadu_si128((const __m128i *) &src[x + 8]), mask);
+    _mm_storeu_si128((__m128i *) &dst[x], _mm_packus_epi16(v0, v1));
+  }
+  if (x < width)
+  {
+    packSamplesCore(src + x, dst + x, false, width - x);
+  }
+}
+
+template<X86_VEXT vext>
+void scaleSamplesSimd(Pel *ptr, ptrdiff_t stride, int width, int height, int shift, Pel minVal, Pel maxVal)
+{
+  if (shift == 0)
+  {
+    return;
+  }
+
+  const int widthSimd = width & ~7;
+
+  if (shift > 0)
+  {
+    const __m128i sh = _mm_cvtsi32_si128(shift);
+    for (int y = 0; y < height; y++, ptr += stride)
+    {
+      for (int x = 0; x < widthSimd; x += 8)
+      {
+        const __m128i v = _mm_loadu_si128((const __m128i *) &ptr[x]);
+        _mm_storeu_si128((__m128i *) &ptr[x], _mm_sll_epi16(v, sh));
+      }
+      if (widthSimd < width)
+      {
+        scaleSamplesCore(ptr + widthSimd, stride, width - widthSimd, 1, shift, minVal, maxVal);
+      }
+    }
+  }
+  else
+  {
+    // the rounding offset is added in 32 bits as in the scalar version
+    const __m128i sh    = _mm_cvtsi32_si128(-shift);
+    const __m128i round = _mm_set1_epi32(1 << (-shift - 1));
+    const __m128i vmin  = _mm_set1_epi16(minVal);
+    const __m128i vmax  = _mm_set1_epi16(maxVal);
+    for (int y = 0; y < height; y++, ptr += stride)
+    {
+      for (int x = 0; x < widthSimd; x += 8)
+      {
+        const __m128i v  = _mm_loadu_si128((const __m128i *) &ptr[x]);
+        const __m128i lo = _mm_sra_epi32(_mm_add_epi32(_mm_cvtepi16_epi32(v), round), sh);
+        const __m128i hi = _mm_sra_epi32(_mm_add_epi32(_mm_cvtepi16_epi32(_mm_unpackhi_epi64(v, v)), round), sh);
+        const __m128i r  = _mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(lo, hi), vmin), vmax);
+        _mm_storeu_si128((__m128i *) &ptr[x], r);
+      }
+      if (widthSimd < width)
+      {
+        scaleSamplesCore(ptr + widthSimd, stride, width - widthSimd, 1, shift, minVal, maxVal);
+      }
+    }
+  }
+}
+
 template<X86_VEXT vext>
 void addBIOAvg4_SSE(const Pel *src0, ptrdiff_t src0Stride, const Pel *src1, ptrdiff_t src1Stride, Pel *dst,
                     ptrdiff_t dstStride, const Pel *gradX0, const Pel *gradX1, const Pel *gradY0, const Pel *gradY1,
@@ -1826,6 +2388,23 @@ void PelBufferOps::_initPelBufOpsX86()
 
   copyBuffer = copyBufferSimd<vext>;
   padding    = paddingSimd<vext>;
+  extendHor  = extendHorSimd<vext>;
+  dmvrSads   = dmvrSadsSimd<vext>;
+  calcSse    = calcSseSimd<vext>;
+
+  filterScaledHor    = filterScaledHorSimd<vext, int>;
+  filterScaledHorPel = filterScaledHorSimd<vext, Pel>;
+  filterScaledVer    = filterScaledVerSimd<vext>;
+
+  unpackSamples = unpackSamplesSimd<vext>;
+  packSamples   = packSamplesSimd<vext>;
+  scaleSamples  = scaleSamplesSimd<vext>;
+#if USE_AVX2
+  if (vext >= AVX2)
+  {
+    applyLut = applyLut_AVX2<vext>;
+  }
+#endif
   reco8 = reco_SSE<vext, 8>;
   reco4 = reco_SSE<vext, 4>;
 
@@ -0,0 +1,315 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the SIMD trellis decision kernel for dependent quantization
+ */
+
+#include "CommonDefX86.h"
+#include "../DepQuant.h"
+
+#ifdef TARGET_SIMD_X86
+
+#include <immintrin.h>
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+namespace SIMD::X86::DQ
+{
+using namespace DQIntern;
+
+static constexpr int64_t UNUSED_COST = std::numeric_limits<int64_t>::max() >> 2;
+
+// Signed 64-bit comparison a < b. SSE4.1 lacks pcmpgtq, so it is composed of 32-bit comparisons there.
+static inline __m128i cmpLt64(const __m128i a, const __m128i b)
+{
+#ifdef USE_SSE41
+  const __m128i signBit = _mm_set1_epi32(0x80000000);
+
+  const __m128i gt   = _mm_cmpgt_epi32(b, a);
+  const __m128i eq   = _mm_cmpeq_epi32(b, a);
+  const __m128i gtLo = _mm_cmpgt_epi32(_mm_xor_si128(b, signBit), _mm_xor_si128(a, signBit));
+
+  const __m128i res = _mm_or_si128(gt, _mm_and_si128(eq, _mm_shuffle_epi32(gtLo, _MM_SHUFFLE(2, 2, 0, 0))));
+  return _mm_shuffle_epi32(res, _MM_SHUFFLE(3, 3, 1, 1));
+#else
+  return _mm_cmpgt_epi64(b, a);
+#endif
+}
+
+template<X86_VEXT vext> static inline __m128i gather32(const int32_t* base, const __m128i idx)
+{
+#if USE_AVX2
+  if constexpr (vext >= AVX2)
+  {
+    return _mm_i32gather_epi32(base, idx, sizeof(int32_t));
+  }
+#endif
+  return _mm_setr_epi32(base[_mm_cvtsi128_si32(idx)], base[_mm_extract_epi32(idx, 1)], base[_mm_extract_epi32(idx, 2)],
+                        base[_mm_extract_epi32(idx, 3)]);
+}
+
+// Split four BinFracBits into the vectors of their 0-bins and 1-bins
+static inline void loadBinFracBits(const BinFracBits* bits, __m128i& bits0, __m128i& bits1)
+{
+  const __m128 lo = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*) &bits[0]));
+  const __m128 hi = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*) &bits[2]));
+
+  bits0 = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+  bits1 = _mm_castps_si128(_mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+static inline __m128i loadInt8x4(const int8_t* p)
+{
+  int32_t v;
+  memcpy(&v, p, sizeof(v));
+  return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(v));
+}
+
+// Per-state parameters of the four lanes of a candidate vector
+struct LaneParams
+{
+  __m128i stateId;
+  __m128i regular;     // remRegBins >= 4
+  __m128i goRiceBase;  // goRicePar * RICEMAX
+  __m128i goRiceZero;
+  __m128i sig0;
+  __m128i sig1;
+  __m128i sbbSig;      // 0 if the current sub-block has no significant coefficient yet, -1 otherwise
+};
+
+template<int PERM> static inline LaneParams permuteLanes(const LaneParams& p)
+{
+  return { _mm_shuffle_epi32(p.stateId, PERM),    _mm_shuffle_epi32(p.regular, PERM),
+           _mm_shuffle_epi32(p.goRiceBase, PERM), _mm_shuffle_epi32(p.goRiceZero, PERM),
+           _mm_shuffle_epi32(p.sig0, PERM),       _mm_shuffle_epi32(p.sig1, PERM),
+           _mm_shuffle_epi32(p.sbbSig, PERM) };
+}
+
+// Rate of coding the non-zero levels 'absLevel' in the lanes described by 'p' (excluding the significance flag)
+template<X86_VEXT vext>
+static inline __m128i levelRate(const LaneParams& p, const __m128i absLevel, const int32_t* coeffFracBits,
+                                const int32_t* goRiceBits, const bool anyRegular, const bool allRegular)
+{
+  const __m128i one       = _mm_set1_epi32(1);
+  const __m128i riceMax   = _mm_set1_epi32(RICEMAX - 1);
+  const __m128i remainder = _mm_cmpgt_epi32(absLevel, _mm_set1_epi32(3));
+
+  __m128i rateReg = _mm_setzero_si128();
+  if (anyRegular)
+  {
+    // levels above 3 use the gt1/par/gt2 bits of 4 or 5 plus a Golomb-Rice coded remainder
+    const __m128i cfbIdx =
+      _mm_blendv_epi8(absLevel, _mm_add_epi32(_mm_set1_epi32(4), _mm_and_si128(absLevel, one)), remainder);
+    rateReg = gather32<vext>(coeffFracBits, _mm_add_epi32(_mm_mullo_epi32(p.stateId, _mm_set1_epi32(6)), cfbIdx));
+
+    if (!_mm_testz_si128(remainder, remainder))
+    {
+      __m128i value = _mm_srai_epi32(_mm_sub_epi32(absLevel, _mm_set1_epi32(4)), 1);
+      value         = _mm_min_epi32(_mm_max_epi32(value, _mm_setzero_si128()), riceMax);
+      const __m128i rice = gather32<vext>(goRiceBits, _mm_add_epi32(p.goRiceBase, value));
+      rateReg            = _mm_add_epi32(rateReg, _mm_and_si128(rice, remainder));
+    }
+  }
+  if (allRegular)
+  {
+    return rateReg;
+  }
+
+  // all bins are bypass coded once the regular bin budget is used up
+  const __m128i belowZero = _mm_cmpgt_epi32(_mm_add_epi32(p.goRiceZero, one), absLevel);
+  const __m128i riceIdx   = _mm_blendv_epi8(_mm_min_epi32(absLevel, riceMax), _mm_sub_epi32(absLevel, one), belowZero);
+  const __m128i rateByp   = _mm_add_epi32(_mm_set1_epi32(1 << SCALE_BITS),
+                                        gather32<vext>(goRiceBits, _mm_add_epi32(p.goRiceBase, riceIdx)));
+
+  return _mm_blendv_epi8(rateByp, rateReg, p.regular);
+}
+
+static inline void update(__m128i& cost01, __m128i& cost23, __m128i& levelPrev01, __m128i& levelPrev23,
+                          const __m128i cand01, const __m128i cand23, const __m128i levelPrev01New,
+                          const __m128i levelPrev23New)
+{
+  const __m128i lt01 = cmpLt64(cand01, cost01);
+  const __m128i lt23 = cmpLt64(cand23, cost23);
+
+  cost01      = _mm_blendv_epi8(cost01, cand01, lt01);
+  cost23      = _mm_blendv_epi8(cost23, cand23, lt23);
+  levelPrev01 = _mm_blendv_epi8(levelPrev01, levelPrev01New, lt01);
+  levelPrev23 = _mm_blendv_epi8(levelPrev23, levelPrev23New, lt23);
+}
+
+// Pack two 32-bit lanes of (level, prevId) pairs
+static inline __m128i levelPrev(const int32_t l0, const int32_t p0, const int32_t l1, const int32_t p1)
+{
+  return _mm_setr_epi32(l0, p0, l1, p1);
+}
+
+// Evaluates all transitions from the four previous states (and the skip states at the end of a sub-block) and
+// keeps the best one for each of the four current states. The candidates are processed in the same order as in
+// the scalar implementation, so that ties are resolved identically.
+template<X86_VEXT vext>
+static void checkRdCosts(const ScanPosType spt, const PQData* pqData, Decision* decisions, const StateMem& prevStates,
+                         const StateMem& skipStates, const int32_t (*goRiceBits)[RICEMAX])
+{
+  static_assert(sizeof(Decision) == 16, "Decision must consist of a 64-bit cost and two 32-bit values");
+  static_assert(sizeof(CoeffFracBits) == 6 * sizeof(int32_t), "CoeffFracBits must be densely packed");
+
+  const int32_t* riceBits = &goRiceBits[0][0];
+  const int32_t* cfb      = &prevStates.coeffFracBits[0].bits[0];
+
+  LaneParams states;
+  states.stateId    = _mm_setr_epi32(0, 1, 2, 3);
+  const __m128i rem = _mm_loadu_si128((const __m128i*) prevStates.remRegBins);
+  states.regular    = _mm_cmpgt_epi32(rem, _mm_set1_epi32(3));
+  states.goRiceBase = _mm_mullo_epi32(loadInt8x4(prevStates.goRicePar), _mm_set1_epi32(RICEMAX));
+  states.goRiceZero = loadInt8x4(prevStates.goRiceZero);
+  loadBinFracBits(prevStates.sigFracBits, states.sig0, states.sig1);
+  states.sbbSig = _mm_cmpeq_epi32(_mm_cmpeq_epi32(loadInt8x4(prevStates.numSigSbb), _mm_setzero_si128()),
+                                  _mm_setzero_si128());
+
+  const int  regMask    = _mm_movemask_ps(_mm_castsi128_ps(states.regular));
+  const bool anyRegular = regMask != 0;
+  const bool allRegular = regMask == 0xf;
+
+  // significance related rate of the non-zero and zero candidates in the regular coding mode
+  __m128i sigNZ = states.sig1;
+  __m128i sigZ  = states.sig0;
+  __m128i zeroValid = _mm_set1_epi32(-1);
+  if (spt == SCAN_SOCSBB)
+  {
+    __m128i sbb0, sbb1;
+    loadBinFracBits(prevStates.sbbFracBits, sbb0, sbb1);
+    sigNZ = _mm_add_epi32(sigNZ, sbb1);
+    sigZ  = _mm_add_epi32(sigZ, sbb1);
+  }
+  else if (spt == SCAN_EOCSBB)
+  {
+    sigNZ     = _mm_and_si128(sigNZ, states.sbbSig);
+    zeroValid = _mm_or_si128(states.sbbSig, _mm_xor_si128(states.regular, _mm_set1_epi32(-1)));
+  }
+  states.sig0 = sigZ;
+  states.sig1 = _mm_and_si128(sigNZ, states.regular);
+
+  // zero candidates of states 0, 2, 1, 3
+  __m128i rateZ = _mm_blendv_epi8(
+    gather32<vext>(riceBits, _mm_add_epi32(states.goRiceBase, states.goRiceZero)), sigZ, states.regular);
+  rateZ     = _mm_shuffle_epi32(rateZ, _MM_SHUFFLE(3, 1, 2, 0));
+  zeroValid = _mm_shuffle_epi32(zeroValid, _MM_SHUFFLE(3, 1, 2, 0));
+
+  // non-zero candidates of the even states (0, 2, 0, 2) and the odd states (1, 3, 1, 3)
+  const LaneParams even = permuteLanes<_MM_SHUFFLE(2, 0, 2, 0)>(states);
+  const LaneParams odd  = permuteLanes<_MM_SHUFFLE(3, 1, 3, 1)>(states);
+
+  const int32_t l0 = int32_t(pqData[0].absLevel);
+  const int32_t l1 = int32_t(pqData[1].absLevel);
+  const int32_t l2 = int32_t(pqData[2].absLevel);
+  const int32_t l3 = int32_t(pqData[3].absLevel);
+
+  const __m128i levelsEven = _mm_setr_epi32(l0, l3, l2, l1);
+  const __m128i levelsOdd  = _mm_setr_epi32(l2, l1, l0, l3);
+
+  const __m128i rateEven = _mm_add_epi32(
+    levelRate<vext>(even, levelsEven, cfb, riceBits, anyRegular, allRegular), even.sig1);
+  const __m128i rateOdd =
+    _mm_add_epi32(levelRate<vext>(odd, levelsOdd, cfb, riceBits, anyRegular, allRegular), odd.sig1);
+
+  // 64-bit costs
+  const __m128i rd01 = _mm_loadu_si128((const __m128i*) &prevStates.rdCost[0]);
+  const __m128i rd23 = _mm_loadu_si128((const __m128i*) &prevStates.rdCost[2]);
+  const __m128i rd02 = _mm_unpacklo_epi64(rd01, rd23);
+  const __m128i rd13 = _mm_unpackhi_epi64(rd01, rd23);
+  const __m128i dd03 = _mm_set_epi64x(pqData[3].deltaDist, pqData[0].deltaDist);
+  const __m128i dd21 = _mm_set_epi64x(pqData[1].deltaDist, pqData[2].deltaDist);
+
+  const __m128i unused = _mm_set1_epi64x(UNUSED_COST);
+
+  const __m128i zeroValid01 = _mm_cvtepi32_epi64(zeroValid);
+  const __m128i zeroValid23 = _mm_cvtepi32_epi64(_mm_unpackhi_epi64(zeroValid, zeroValid));
+
+  // decisions 0, 1, 2, 3 are reached from: (A0, Z0, B1), (A2, Z2, B3), (B0, A1, Z1), (B2, A3, Z3)
+  const __m128i cand1lo = _mm_add_epi64(_mm_add_epi64(rd02, dd03), _mm_cvtepi32_epi64(rateEven));
+  const __m128i cand1hi =
+    _mm_add_epi64(_mm_add_epi64(rd02, dd21), _mm_cvtepi32_epi64(_mm_unpackhi_epi64(rateEven, rateEven)));
+  const __m128i cand2lo =
+    _mm_blendv_epi8(unused, _mm_add_epi64(rd02, _mm_cvtepi32_epi64(rateZ)), zeroValid01);
+  const __m128i cand2hi =
+    _mm_add_epi64(_mm_add_epi64(rd13, dd03), _mm_cvtepi32_epi64(_mm_unpackhi_epi64(rateOdd, rateOdd)));
+  const __m128i cand3lo = _mm_add_epi64(_mm_add_epi64(rd13, dd21), _mm_cvtepi32_epi64(rateOdd));
+  const __m128i cand3hi = _mm_blendv_epi8(
+    unused, _mm_add_epi64(rd13, _mm_cvtepi32_epi64(_mm_unpackhi_epi64(rateZ, rateZ))), zeroValid23);
+
+  // initial decisions
+  const __m128i d0 = _mm_loadu_si128((const __m128i*) &decisions[0]);
+  const __m128i d1 = _mm_loadu_si128((const __m128i*) &decisions[1]);
+  const __m128i d2 = _mm_loadu_si128((const __m128i*) &decisions[2]);
+  const __m128i d3 = _mm_loadu_si128((const __m128i*) &decisions[3]);
+
+  __m128i cost01 = _mm_unpacklo_epi64(d0, d1);
+  __m128i cost23 = _mm_unpacklo_epi64(d2, d3);
+  __m128i lp01   = _mm_unpackhi_epi64(d0, d1);
+  __m128i lp23   = _mm_unpackhi_epi64(d2, d3);
+
+  update(cost01, cost23, lp01, lp23, cand1lo, cand1hi, levelPrev(l0, 0, l3, 2), levelPrev(l2, 0, l1, 2));
+  update(cost01, cost23, lp01, lp23, cand2lo, cand2hi, levelPrev(0, 0, 0, 2), levelPrev(l0, 1, l3, 3));
+  update(cost01, cost23, lp01, lp23, cand3lo, cand3hi, levelPrev(l2, 1, l1, 3), levelPrev(0, 1, 0, 3));
+
+  if (spt == SCAN_EOCSBB)
+  {
+    __m128i sbb0, sbb1;
+    loadBinFracBits(skipStates.sbbFracBits, sbb0, sbb1);
+
+    const __m128i skip01 = _mm_add_epi64(_mm_loadu_si128((const __m128i*) &skipStates.rdCost[0]), _mm_cvtepu32_epi64(sbb0));
+    const __m128i skip23 = _mm_add_epi64(_mm_loadu_si128((const __m128i*) &skipStates.rdCost[2]),
+                                         _mm_cvtepu32_epi64(_mm_unpackhi_epi64(sbb0, sbb0)));
+
+    update(cost01, cost23, lp01, lp23, skip01, skip23, levelPrev(0, 4, 0, 5), levelPrev(0, 6, 0, 7));
+  }
+
+  _mm_storeu_si128((__m128i*) &decisions[0], _mm_unpacklo_epi64(cost01, lp01));
+  _mm_storeu_si128((__m128i*) &decisions[1], _mm_unpackhi_epi64(cost01, lp01));
+  _mm_storeu_si128((__m128i*) &decisions[2], _mm_unpacklo_epi64(cost23, lp23));
+  _mm_storeu_si128((__m128i*) &decisions[3], _mm_unpackhi_epi64(cost23, lp23));
+}
+}   // namespace SIMD::X86::DQ
+#endif
+
+template<X86_VEXT vext> void DepQuant::_initDepQuantX86()
+{
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+  m_checkRdCosts = SIMD::X86::DQ::checkRdCosts<vext>;
+#endif
+}
+
+template void DepQuant::_initDepQuantX86<SIMDX86>();
+
+#endif   // TARGET_SIMD_X86
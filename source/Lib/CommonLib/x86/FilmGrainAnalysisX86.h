@@ -0,0 +1,420 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the SIMD kernels of the film grain analysis
+ */
+
+#include "CommonDefX86.h"
+#include "../FilmGrainAnalysis.h"
+#include "../Rom.h"
+
+#ifdef TARGET_SIMD_X86
+
+#include <immintrin.h>
+
+#include <array>
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+namespace SIMD::X86::FGA
+{
+// the Sobel gradients and the sum of their magnitudes fit in 16 bits for samples of up to 12 bits
+static constexpr int MAX_SIMD_BIT_DEPTH = 12;
+
+template<X86_VEXT vext>
+static void sobel(const Pel *src, ptrdiff_t srcStride, Pel *mag, ptrdiff_t magStride, Pel *dir, ptrdiff_t dirStride,
+                  int width, int height, int maxValue)
+{
+  if (maxValue >= (1 << MAX_SIMD_BIT_DEPTH))
+  {
+    FilmGrainAnalysis::xSobel(src, srcStride, mag, magStride, dir, dirStride, width, height, maxValue);
+    return;
+  }
+
+  const int widthSimd = width & ~7;
+
+  const __m128i vzero = _mm_setzero_si128();
+  const __m128i vmax  = _mm_set1_epi16(maxValue);
+  const __m128i v45   = _mm_set1_epi16(45);
+  const __m128i v90   = _mm_set1_epi16(90);
+  const __m128i v135  = _mm_set1_epi16(135);
+
+  for (int y = 0; y < height; y++, src += srcStride, mag += magStride, dir += dirStride)
+  {
+    const Pel *above = src - srcStride;
+    const Pel *below = src + srcStride;
+
+    for (int x = 0; x < widthSimd; x += 8)
+    {
+      const __m128i al = _mm_loadu_si128((const __m128i *) &above[x - 1]);
+      const __m128i ac = _mm_loadu_si128((const __m128i *) &above[x]);
+      const __m128i ar = _mm_loadu_si128((const __m128i *) &above[x + 1]);
+      const __m128i ml = _mm_loadu_si128((const __m128i *) &src[x - 1]);
+      const __m128i mr = _mm_loadu_si128((const __m128i *) &src[x + 1]);
+      const __m128i bl = _mm_loadu_si128((const __m128i *) &below[x - 1]);
+      const __m128i bc = _mm_loadu_si128((const __m128i *) &below[x]);
+      const __m128i br = _mm_loadu_si128((const __m128i *) &below[x + 1]);
+
+      const __m128i gx = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(bl, br), _mm_slli_epi16(bc, 1)),
+                                       _mm_add_epi16(_mm_add_epi16(al, ar), _mm_slli_epi16(ac, 1)));
+      const __m128i gy = _mm_sub_epi16(_mm_add_epi16(_mm_add_epi16(ar, br), _mm_slli_epi16(mr, 1)),
+                                       _mm_add_epi16(_mm_add_epi16(al, bl), _mm_slli_epi16(ml, 1)));
+
+      const __m128i sum = _mm_add_epi16(_mm_abs_epi16(gx), _mm_abs_epi16(gy));
+      _mm_storeu_si128((__m128i *) &mag[x], _mm_min_epi16(_mm_srli_epi16(sum, 1), vmax));
+
+      // sum^2 - 2 * g^2 as pairwise products, positive outside the sector of the respective axis
+      const __m128i m2gy = _mm_sub_epi16(vzero, _mm_slli_epi16(gy, 1));
+      const __m128i m2gx = _mm_sub_epi16(vzero, _mm_slli_epi16(gx, 1));
+
+      const __m128i dy0 = _mm_madd_epi16(_mm_unpacklo_epi16(sum, gy), _mm_unpacklo_epi16(sum, m2gy));
+      const __m128i dy1 = _mm_madd_epi16(_mm_unpackhi_epi16(sum, gy), _mm_unpackhi_epi16(sum, m2gy));
+      const __m128i dx0 = _mm_madd_epi16(_mm_unpacklo_epi16(sum, gx), _mm_unpacklo_epi16(sum, m2gx));
+      const __m128i dx1 = _mm_madd_epi16(_mm_unpackhi_epi16(sum, gx), _mm_unpackhi_epi16(sum, m2gx));
+
+      const __m128i not0  = _mm_packs_epi32(_mm_cmpgt_epi32(dy0, vzero), _mm_cmpgt_epi32(dy1, vzero));
+      const __m128i not90 = _mm_packs_epi32(_mm_cmpgt_epi32(dx0, vzero), _mm_cmpgt_epi32(dx1, vzero));
+
+      const __m128i diag = _mm_blendv_epi8(v45, v135, _mm_srai_epi16(_mm_xor_si128(gx, gy), 15));
+      const __m128i d    = _mm_and_si128(_mm_blendv_epi8(v90, diag, not90), not0);
+      _mm_storeu_si128((__m128i *) &dir[x], d);
+    }
+
+    if (widthSimd < width)
+    {
+      FilmGrainAnalysis::xSobel(src + widthSimd, srcStride, mag + widthSimd, magStride, dir + widthSimd, dirStride,
+                                width - widthSimd, 1, maxValue);
+    }
+  }
+}
+
+template<X86_VEXT vext>
+static void suppressNonMax(const Pel *mag, ptrdiff_t magStride, const Pel *dir, ptrdiff_t dirStride, Pel *dst,
+                           ptrdiff_t dstStride, int width, int height)
+{
+  const int widthSimd = width & ~7;
+
+  const __m128i v45  = _mm_set1_epi16(45);
+  const __m128i v90  = _mm_set1_epi16(90);
+  const __m128i v135 = _mm_set1_epi16(135);
+
+  for (int y = 0; y < height; y++, mag += magStride, dir += dirStride, dst += dstStride)
+  {
+    const Pel *above = mag - magStride;
+    const Pel *below = mag + magStride;
+
+    for (int x = 0; x < widthSimd; x += 8)
+    {
+      const __m128i cur = _mm_loadu_si128((const __m128i *) &mag[x]);
+
+      // larger of the two neighbours along each direction
+      const __m128i n0 = _mm_max_epi16(_mm_loadu_si128((const __m128i *) &mag[x - 1]),
+                                       _mm_loadu_si128((const __m128i *) &mag[x + 1]));
+      const __m128i n45 = _mm_max_epi16(_mm_loadu_si128((const __m128i *) &above[x - 1]),
+                                        _mm_loadu_si128((const __m128i *) &below[x + 1]));
+      const __m128i n90 = _mm_max_epi16(_mm_loadu_si128((const __m128i *) &above[x]),
+                                        _mm_loadu_si128((const __m128i *) &below[x]));
+      const __m128i n135 = _mm_max_epi16(_mm_loadu_si128((const __m128i *) &above[x + 1]),
+                                         _mm_loadu_si128((const __m128i *) &below[x - 1]));
+
+      const __m128i d = _mm_loadu_si128((const __m128i *) &dir[x]);
+
+      __m128i n = n0;
+      n         = _mm_blendv_epi8(n, n45, _mm_cmpeq_epi16(d, v45));
+      n         = _mm_blendv_epi8(n, n90, _mm_cmpeq_epi16(d, v90));
+      n         = _mm_blendv_epi8(n, n135, _mm_cmpeq_epi16(d, v135));
+
+      _mm_storeu_si128((__m128i *) &dst[x], _mm_andnot_si128(_mm_cmpgt_epi16(n, cur), cur));
+    }
+
+    if (widthSimd < width)
+    {
+      FilmGrainAnalysis::xSuppressNonMax(mag + widthSimd, magStride, dir + widthSimd, dirStride, dst + widthSimd,
+                                         dstStride, width - widthSimd, 1);
+    }
+  }
+}
+
+template<X86_VEXT vext>
+static void morph3x3(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                     Pel value)
+{
+  const int widthSimd = width & ~7;
+
+  const __m128i v = _mm_set1_epi16(value);
+
+  for (int y = 0; y < height; y++, src += srcStride, dst += dstStride)
+  {
+    for (int x = 0; x < widthSimd; x += 8)
+    {
+      __m128i found = _mm_setzero_si128();
+      for (int dy = -1; dy <= 1; dy++)
+      {
+        const Pel *row = src + dy * srcStride + x;
+
+        found = _mm_or_si128(found, _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *) &row[-1]), v));
+        found = _mm_or_si128(found, _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *) &row[0]), v));
+        found = _mm_or_si128(found, _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *) &row[1]), v));
+      }
+
+      const __m128i cur = _mm_loadu_si128((const __m128i *) &src[x]);
+      _mm_storeu_si128((__m128i *) &dst[x], _mm_blendv_epi8(cur, v, found));
+    }
+
+    if (widthSimd < width)
+    {
+      FilmGrainAnalysis::xMorph3x3(src + widthSimd, srcStride, dst + widthSimd, dstStride, width - widthSimd, 1,
+                                   value);
+    }
+  }
+}
+
+template<X86_VEXT vext>
+static void subsample(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                      int factor)
+{
+  if (factor != 2 && factor != 4)
+  {
+    FilmGrainAnalysis::xSubsample(src, srcStride, dst, dstStride, width, height, factor);
+    return;
+  }
+
+  const int widthSimd = width & ~7;
+
+  // the pairwise sums are formed by madd, for a factor of 4 only the first pair of each group of four is kept
+  const __m128i weights = factor == 2 ? _mm_set1_epi16(1) : _mm_set1_epi64x(0x0000000000010001);
+  const __m128i round   = _mm_set1_epi32(2);
+
+  for (int y = 0; y < height; y++, src += factor * srcStride, dst += dstStride)
+  {
+    const Pel *below = src + srcStride;
+
+    for (int x = 0; x < widthSimd; x += 8)
+    {
+      __m128i sum[2];
+
+      for (int i = 0; i < 2; i++)
+      {
+        if (factor == 2)
+        {
+          const int pos = 2 * x + 8 * i;
+          sum[i]        = _mm_add_epi32(_mm_madd_epi16(_mm_loadu_si128((const __m128i *) &src[pos]), weights),
+                                        _mm_madd_epi16(_mm_loadu_si128((const __m128i *) &below[pos]), weights));
+        }
+        else
+        {
+          const int     pos = 4 * x + 16 * i;
+          const __m128i s0  = _mm_add_epi32(_mm_madd_epi16(_mm_loadu_si128((const __m128i *) &src[pos]), weights),
+                                            _mm_madd_epi16(_mm_loadu_si128((const __m128i *) &below[pos]), weights));
+          const __m128i s1 =
+            _mm_add_epi32(_mm_madd_epi16(_mm_loadu_si128((const __m128i *) &src[pos + 8]), weights),
+                          _mm_madd_epi16(_mm_loadu_si128((const __m128i *) &below[pos + 8]), weights));
+          sum[i] = _mm_unpacklo_epi64(_mm_shuffle_epi32(s0, 0x08), _mm_shuffle_epi32(s1, 0x08));
+        }
+        sum[i] = _mm_srai_epi32(_mm_add_epi32(sum[i], round), 2);
+      }
+
+      _mm_storeu_si128((__m128i *) &dst[x], _mm_packs_epi32(sum[0], sum[1]));
+    }
+
+    if (widthSimd < width)
+    {
+      FilmGrainAnalysis::xSubsample(src + factor * widthSimd, srcStride, dst + widthSimd, dstStride,
+                                    width - widthSimd, 1, factor);
+    }
+  }
+}
+
+static constexpr int DCT_SIZE = FilmGrainAnalysis::DCT_SIZE;
+
+// Interleaves the rows 2m and 2m+1 of a DCT_SIZE x DCT_SIZE matrix so that madd can multiply a pair of rows with a
+// pair of coefficients: dst[m][2x] = src[2m][x], dst[m][2x+1] = src[2m+1][x]
+static inline void interleaveRowPairs(const int16_t *src, ptrdiff_t srcStride, int16_t *dst)
+{
+  for (int m = 0; m < DCT_SIZE / 2; m++, src += 2 * srcStride, dst += 2 * DCT_SIZE)
+  {
+    for (int x = 0; x < DCT_SIZE; x += 8)
+    {
+      const __m128i r0 = _mm_loadu_si128((const __m128i *) &src[x]);
+      const __m128i r1 = _mm_loadu_si128((const __m128i *) &src[srcStride + x]);
+      _mm_storeu_si128((__m128i *) &dst[2 * x], _mm_unpacklo_epi16(r0, r1));
+      _mm_storeu_si128((__m128i *) &dst[2 * x + 8], _mm_unpackhi_epi16(r0, r1));
+    }
+  }
+}
+
+// dst[r][x] = (sum_k a[r][k] * b[k][x] + round) >> DCT_SHIFT for DCT_SIZE x DCT_SIZE matrices, b given as produced
+// by interleaveRowPairs
+template<X86_VEXT vext> static void matMul(const int16_t *a, ptrdiff_t aStride, const int16_t *bPairs, int *dst)
+{
+  constexpr int shift = FilmGrainAnalysis::DCT_SHIFT;
+
+#if USE_AVX2
+  if (vext >= AVX2)
+  {
+    const __m256i round = _mm256_set1_epi32(1 << (shift - 1));
+
+    for (int r = 0; r < DCT_SIZE; r++, a += aStride, dst += DCT_SIZE)
+    {
+      __m256i acc[DCT_SIZE / 8];
+      for (int i = 0; i < DCT_SIZE / 8; i++)
+      {
+        acc[i] = round;
+      }
+
+      for (int m = 0; m < DCT_SIZE / 2; m++)
+      {
+        int32_t pair;
+        memcpy(&pair, &a[2 * m], sizeof(pair));
+        const __m256i coeffs = _mm256_set1_epi32(pair);
+        const int16_t *b     = bPairs + 2 * DCT_SIZE * m;
+
+        for (int i = 0; i < DCT_SIZE / 8; i++)
+        {
+          acc[i] = _mm256_add_epi32(acc[i], _mm256_madd_epi16(_mm256_loadu_si256((const __m256i *) &b[16 * i]), coeffs));
+        }
+      }
+
+      for (int i = 0; i < DCT_SIZE / 8; i++)
+      {
+        _mm256_storeu_si256((__m256i *) &dst[8 * i], _mm256_srai_epi32(acc[i], shift));
+      }
+    }
+    return;
+  }
+#endif
+
+  const __m128i round = _mm_set1_epi32(1 << (shift - 1));
+
+  for (int r = 0; r < DCT_SIZE; r++, a += aStride, dst += DCT_SIZE)
+  {
+    // two passes over half of the columns to keep the accumulators in registers
+    for (int half = 0; half < 2; half++)
+    {
+      __m128i acc[DCT_SIZE / 8];
+      for (int i = 0; i < DCT_SIZE / 8; i++)
+      {
+        acc[i] = round;
+      }
+
+      for (int m = 0; m < DCT_SIZE / 2; m++)
+      {
+        int32_t pair;
+        memcpy(&pair, &a[2 * m], sizeof(pair));
+        const __m128i coeffs = _mm_set1_epi32(pair);
+        const int16_t *b     = bPairs + 2 * DCT_SIZE * m + DCT_SIZE * half;
+
+        for (int i = 0; i < DCT_SIZE / 8; i++)
+        {
+          acc[i] = _mm_add_epi32(acc[i], _mm_madd_epi16(_mm_loadu_si128((const __m128i *) &b[8 * i]), coeffs));
+        }
+      }
+
+      for (int i = 0; i < DCT_SIZE / 8; i++)
+      {
+        _mm_storeu_si128((__m128i *) &dst[DCT_SIZE / 2 * half + 4 * i], _mm_srai_epi32(acc[i], shift));
+      }
+    }
+  }
+}
+
+template<X86_VEXT vext> static void squaredDct(const Pel *src, ptrdiff_t srcStride, Intermediate_Int *dst, int bitDepth)
+{
+  // the output of the first stage fits in 16 bits as the absolute row sums of the matrix are at most 4096
+  if (bitDepth > MAX_SIMD_BIT_DEPTH)
+  {
+    FilmGrainAnalysis::xSquaredDct(src, srcStride, dst, bitDepth);
+    return;
+  }
+
+  const TMatrixCoeff *tr = g_trCoreDCT2P64[TRANSFORM_FORWARD][0];
+
+  // transposed transform matrix, with the pairs of rows interleaved
+  static const std::array<int16_t, DCT_SIZE * DCT_SIZE> trTransposed = [tr]
+  {
+    std::array<int16_t, DCT_SIZE * DCT_SIZE> pairs;
+    for (int m = 0; m < DCT_SIZE / 2; m++)
+    {
+      for (int x = 0; x < DCT_SIZE; x++)
+      {
+        pairs[2 * DCT_SIZE * m + 2 * x]     = tr[x * DCT_SIZE + 2 * m];
+        pairs[2 * DCT_SIZE * m + 2 * x + 1] = tr[x * DCT_SIZE + 2 * m + 1];
+      }
+    }
+    return pairs;
+  }();
+
+  int     tmp[DCT_SIZE * DCT_SIZE];
+  int16_t tmp16[DCT_SIZE * DCT_SIZE];
+  int16_t tmpPairs[DCT_SIZE * DCT_SIZE];
+
+  // horizontal transform, tmp[y][u] is frequency u of row y
+  matMul<vext>(src, srcStride, trTransposed.data(), tmp);
+
+  for (int i = 0; i < DCT_SIZE * DCT_SIZE; i += 8)
+  {
+    _mm_storeu_si128((__m128i *) &tmp16[i], _mm_packs_epi32(_mm_loadu_si128((const __m128i *) &tmp[i]),
+                                                            _mm_loadu_si128((const __m128i *) &tmp[i + 4])));
+  }
+  interleaveRowPairs(tmp16, DCT_SIZE, tmpPairs);
+
+  // vertical transform, tmp[v][u] is the coefficient of vertical frequency v and horizontal frequency u
+  matMul<vext>(tr, DCT_SIZE, tmpPairs, tmp);
+
+  const __m128i vmax = _mm_set1_epi32((1 << (bitDepth + 6)) - 1);
+  const __m128i vmin = _mm_sub_epi32(_mm_setzero_si128(), vmax);
+
+  for (int i = 0; i < DCT_SIZE * DCT_SIZE; i += 4)
+  {
+    const __m128i c = _mm_min_epi32(_mm_max_epi32(_mm_loadu_si128((const __m128i *) &tmp[i]), vmin), vmax);
+    _mm_storeu_si128((__m128i *) &dst[i], _mm_mullo_epi32(c, c));
+  }
+}
+}   // namespace SIMD::X86::FGA
+#endif
+
+template<X86_VEXT vext> void FilmGrainAnalysis::_initFilmGrainAnalysisX86()
+{
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+  m_sobel          = SIMD::X86::FGA::sobel<vext>;
+  m_suppressNonMax = SIMD::X86::FGA::suppressNonMax<vext>;
+  m_morph3x3       = SIMD::X86::FGA::morph3x3<vext>;
+  m_subsample      = SIMD::X86::FGA::subsample<vext>;
+  m_squaredDct     = SIMD::X86::FGA::squaredDct<vext>;
+#endif
+}
+
+template void FilmGrainAnalysis::_initFilmGrainAnalysisX86<SIMDX86>();
+
+#endif   // TARGET_SIMD_X86
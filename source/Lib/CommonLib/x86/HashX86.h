@@ -0,0 +1,176 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the SSE4.2 block hash kernels for hash-based motion estimation
+ */
+
+#include "CommonDefX86.h"
+#include "../Unit.h"
+#include "../Hash.h"
+
+#ifdef TARGET_SIMD_X86
+
+#include <nmmintrin.h>
+
+namespace SIMD::X86::H
+{
+template<X86_VEXT vext>
+static uint32_t hashWords(const uint32_t *words, int numWords, bool mix)
+{
+  uint32_t crc = 0xffffffff;
+  for (int i = 0; i < numWords; i++)
+  {
+    crc = _mm_crc32_u32(crc, mix ? words[i] * HashOps::HASH_MIX : words[i]);
+  }
+  return crc;
+}
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+// the samples are processed as 16-bit lanes
+template<X86_VEXT vext>
+static void hash2x2(const Pel *src, ptrdiff_t stride, int count, int shift, uint32_t *hash1, uint32_t *hash2,
+                    bool *rowSame, bool *colSame)
+{
+  const __m128i vshift = _mm_cvtsi32_si128(shift);
+  const __m128i mask   = _mm_set1_epi16(0xff);
+  const __m128i one    = _mm_set1_epi8(1);
+  const __m128i vmix   = _mm_set1_epi32(HashOps::HASH_MIX);
+
+  alignas(16) uint32_t words[2][8];
+
+  int x = 0;
+
+  // 8 positions per iteration, reading the samples up to x + 8
+  for (; x + 8 <= count; x += 8)
+  {
+    const __m128i a = _mm_and_si128(_mm_srl_epi16(_mm_loadu_si128((const __m128i *) &src[x]), vshift), mask);
+    const __m128i b = _mm_and_si128(_mm_srl_epi16(_mm_loadu_si128((const __m128i *) &src[x + 1]), vshift), mask);
+    const __m128i c =
+      _mm_and_si128(_mm_srl_epi16(_mm_loadu_si128((const __m128i *) &src[x + stride]), vshift), mask);
+    const __m128i d =
+      _mm_and_si128(_mm_srl_epi16(_mm_loadu_si128((const __m128i *) &src[x + stride + 1]), vshift), mask);
+
+    const __m128i row = _mm_and_si128(_mm_cmpeq_epi16(a, b), _mm_cmpeq_epi16(c, d));
+    const __m128i col = _mm_and_si128(_mm_cmpeq_epi16(a, c), _mm_cmpeq_epi16(b, d));
+
+    _mm_storel_epi64((__m128i *) &rowSame[x], _mm_and_si128(_mm_packs_epi16(row, row), one));
+    _mm_storel_epi64((__m128i *) &colSame[x], _mm_and_si128(_mm_packs_epi16(col, col), one));
+
+    // sample bytes of the 2x2 blocks in raster order, one 32-bit word per position
+    const __m128i top    = _mm_or_si128(a, _mm_slli_epi16(b, 8));
+    const __m128i bottom = _mm_or_si128(c, _mm_slli_epi16(d, 8));
+    const __m128i lo     = _mm_unpacklo_epi16(top, bottom);
+    const __m128i hi     = _mm_unpackhi_epi16(top, bottom);
+
+    _mm_store_si128((__m128i *) &words[0][0], lo);
+    _mm_store_si128((__m128i *) &words[0][4], hi);
+    _mm_store_si128((__m128i *) &words[1][0], _mm_mullo_epi32(lo, vmix));
+    _mm_store_si128((__m128i *) &words[1][4], _mm_mullo_epi32(hi, vmix));
+
+    for (int i = 0; i < 8; i++)
+    {
+      hash1[x + i] = _mm_crc32_u32(0xffffffff, words[0][i]);
+      hash2[x + i] = _mm_crc32_u32(0xffffffff, words[1][i]);
+    }
+  }
+
+  for (; x < count; x++)
+  {
+    const uint32_t p0 = uint8_t(src[x] >> shift);
+    const uint32_t p1 = uint8_t(src[x + 1] >> shift);
+    const uint32_t p2 = uint8_t(src[x + stride] >> shift);
+    const uint32_t p3 = uint8_t(src[x + stride + 1] >> shift);
+
+    rowSame[x] = p0 == p1 && p2 == p3;
+    colSame[x] = p0 == p2 && p1 == p3;
+
+    const uint32_t word = p0 | (p1 << 8) | (p2 << 16) | (p3 << 24);
+
+    hash1[x] = _mm_crc32_u32(0xffffffff, word);
+    hash2[x] = _mm_crc32_u32(0xffffffff, word * HashOps::HASH_MIX);
+  }
+}
+#endif
+
+template<X86_VEXT vext>
+static void hashQuad(const uint32_t *src, ptrdiff_t offsetX, ptrdiff_t offsetY, int count, uint32_t *dst, bool mix)
+{
+  const __m128i vmix = _mm_set1_epi32(mix ? HashOps::HASH_MIX : 1);
+
+  alignas(16) uint32_t words[4][4];
+
+  int x = 0;
+
+  for (; x + 4 <= count; x += 4)
+  {
+    const uint32_t *p[4] = { src + x, src + x + offsetX, src + x + offsetY, src + x + offsetX + offsetY };
+
+    for (int k = 0; k < 4; k++)
+    {
+      _mm_store_si128((__m128i *) words[k], _mm_mullo_epi32(_mm_loadu_si128((const __m128i *) p[k]), vmix));
+    }
+
+    for (int i = 0; i < 4; i++)
+    {
+      uint32_t crc = 0xffffffff;
+      for (int k = 0; k < 4; k++)
+      {
+        crc = _mm_crc32_u32(crc, words[k][i]);
+      }
+      dst[x + i] = crc;
+    }
+  }
+
+  for (; x < count; x++)
+  {
+    const uint32_t quad[4] = { src[x], src[x + offsetX], src[x + offsetY], src[x + offsetX + offsetY] };
+
+    dst[x] = hashWords<vext>(quad, 4, mix);
+  }
+}
+}   // namespace SIMD::X86::H
+
+template<X86_VEXT vext> void HashOps::_initHashOpsX86()
+{
+  hashWords = SIMD::X86::H::hashWords<vext>;
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+  hash2x2   = SIMD::X86::H::hash2x2<vext>;
+#endif
+  hashQuad  = SIMD::X86::H::hashQuad<vext>;
+}
+
+template void HashOps::_initHashOpsX86<SIMDX86>();
+
+#endif   // TARGET_SIMD_X86
@@ -49,6 +49,13 @@
 #include "CommonLib/AdaptiveLoopFilter.h"
 
 #include "CommonLib/IbcHashMap.h"
+#include "CommonLib/Hash.h"
+
+#include "CommonLib/Quant.h"
+#include "CommonLib/DepQuant.h"
+#include "CommonLib/MCTF.h"
+#include "CommonLib/SampleAdaptiveOffset.h"
+#include "CommonLib/FilmGrainAnalysis.h"
 
 #ifdef TARGET_SIMD_X86
 
@@ -186,6 +193,140 @@ void IbcHashMap::initIbcHashMapX86()
 }
 #endif
 
+#if ENABLE_SIMD_OPT_HASH
+void HashOps::initHashOpsX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+  case AVX:
+  case SSE42:
+    _initHashOpsX86<SSE42>();
+    break;
+  case SSE41:
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_QUANT
+void Quant::initQuantX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initQuantX86<AVX2>();
+    break;
+  case AVX:
+    _initQuantX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initQuantX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_MCTF
+void MCTF::initMCTFX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initMCTFX86<AVX2>();
+    break;
+  case AVX:
+    _initMCTFX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initMCTFX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_SAO
+void SampleAdaptiveOffset::initSampleAdaptiveOffsetX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initSampleAdaptiveOffsetX86<AVX2>();
+    break;
+  case AVX:
+    _initSampleAdaptiveOffsetX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initSampleAdaptiveOffsetX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_FGA
+void FilmGrainAnalysis::initFilmGrainAnalysisX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initFilmGrainAnalysisX86<AVX2>();
+    break;
+  case AVX:
+    _initFilmGrainAnalysisX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initFilmGrainAnalysisX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
+#if ENABLE_SIMD_OPT_DEPQUANT
+void DepQuant::initDepQuantX86()
+{
+  auto vext = read_x86_extension_flags();
+  switch (vext)
+  {
+  case AVX512:
+  case AVX2:
+    _initDepQuantX86<AVX2>();
+    break;
+  case AVX:
+    _initDepQuantX86<AVX>();
+    break;
+  case SSE42:
+  case SSE41:
+    _initDepQuantX86<SSE41>();
+    break;
+  default:
+    break;
+  }
+}
+#endif
+
 void TrQuant::initX86()
 {
   auto vext = read_x86_extension_flags();
@@ -0,0 +1,243 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the SIMD kernels of the motion compensated temporal pre-filter
+ */
+
+#include "CommonDefX86.h"
+#include "../MCTF.h"
+
+#ifdef TARGET_SIMD_X86
+
+#include <immintrin.h>
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+namespace SIMD::X86::TF
+{
+static inline int horizontalSum(__m128i v)
+{
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4e));
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xb1));
+  return _mm_cvtsi128_si32(v);
+}
+
+template<X86_VEXT vext>
+static int motionError(const Pel *org, ptrdiff_t orgStride, const Pel *buf, ptrdiff_t bufStride, int width, int height,
+                       int bestError)
+{
+  CHECK(width & 3, "width must be a multiple of 4");
+
+  __m128i acc = _mm_setzero_si128();
+
+#if USE_AVX2
+  if (vext >= AVX2 && width == 16)
+  {
+    __m256i acc256 = _mm256_setzero_si256();
+
+    for (int y = 0; y < height; y++, org += orgStride, buf += bufStride)
+    {
+      const __m256i diff = _mm256_sub_epi16(_mm256_loadu_si256((const __m256i *) org),
+                                            _mm256_loadu_si256((const __m256i *) buf));
+
+      acc256 = _mm256_add_epi32(acc256, _mm256_madd_epi16(diff, diff));
+
+      const int error =
+        horizontalSum(_mm_add_epi32(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1)));
+      if (error > bestError)
+      {
+        return error;
+      }
+    }
+
+    return horizontalSum(_mm_add_epi32(_mm256_castsi256_si128(acc256), _mm256_extracti128_si256(acc256, 1)));
+  }
+#endif
+
+  for (int y = 0; y < height; y++, org += orgStride, buf += bufStride)
+  {
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8)
+    {
+      const __m128i diff =
+        _mm_sub_epi16(_mm_loadu_si128((const __m128i *) &org[x]), _mm_loadu_si128((const __m128i *) &buf[x]));
+
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(diff, diff));
+    }
+    if (x < width)
+    {
+      const __m128i diff =
+        _mm_sub_epi16(_mm_loadl_epi64((const __m128i *) &org[x]), _mm_loadl_epi64((const __m128i *) &buf[x]));
+
+      acc = _mm_add_epi32(acc, _mm_madd_epi16(diff, diff));
+    }
+
+    const int error = horizontalSum(acc);
+    if (error > bestError)
+    {
+      return error;
+    }
+  }
+
+  return horizontalSum(acc);
+}
+
+// pairs of consecutive 16-bit filter taps for use with madd
+static inline __m128i filterTaps(const int *filter, int k)
+{
+  return _mm_set1_epi32((filter[k] & 0xffff) | (filter[k + 1] << 16));
+}
+
+template<X86_VEXT vext>
+static void applyMotion(const Pel *src, ptrdiff_t srcStride, Pel *dst, ptrdiff_t dstStride, int width, int height,
+                        const int *xFilter, const int *yFilter, int maxValue)
+{
+  static constexpr int MAX_SIZE = 16;
+  static constexpr int NUM_ROWS = MAX_SIZE + 5;
+
+  CHECK(width > MAX_SIZE || height > MAX_SIZE, "block too large");
+  CHECK(width & 3, "width must be a multiple of 4");
+
+  // the horizontally filtered samples exceed 16 bits and are kept at 32 bits
+  alignas(32) int tmp[NUM_ROWS][MAX_SIZE];
+
+  const __m128i xTaps12 = filterTaps(xFilter, 1);
+  const __m128i xTaps34 = filterTaps(xFilter, 3);
+  const __m128i xTaps56 = filterTaps(xFilter, 5);
+
+  src -= 2 * srcStride + 2;
+
+  for (int y = 0; y < height + 5; y++, src += srcStride)
+  {
+    int x = 0;
+
+    for (; x + 8 <= width; x += 8)
+    {
+      const __m128i s0 = _mm_loadu_si128((const __m128i *) &src[x]);
+      const __m128i s1 = _mm_loadu_si128((const __m128i *) &src[x + 1]);
+      const __m128i s2 = _mm_loadu_si128((const __m128i *) &src[x + 2]);
+      const __m128i s3 = _mm_loadu_si128((const __m128i *) &src[x + 3]);
+      const __m128i s4 = _mm_loadu_si128((const __m128i *) &src[x + 4]);
+      const __m128i s5 = _mm_loadu_si128((const __m128i *) &src[x + 5]);
+
+      __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(s0, s1), xTaps12);
+      __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(s0, s1), xTaps12);
+      lo         = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s2, s3), xTaps34));
+      hi         = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s2, s3), xTaps34));
+      lo         = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(s4, s5), xTaps56));
+      hi         = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(s4, s5), xTaps56));
+
+      _mm_store_si128((__m128i *) &tmp[y][x], lo);
+      _mm_store_si128((__m128i *) &tmp[y][x + 4], hi);
+    }
+    if (x < width)
+    {
+      const __m128i s0 = _mm_loadl_epi64((const __m128i *) &src[x]);
+      const __m128i s1 = _mm_loadl_epi64((const __m128i *) &src[x + 1]);
+      const __m128i s2 = _mm_loadl_epi64((const __m128i *) &src[x + 2]);
+      const __m128i s3 = _mm_loadl_epi64((const __m128i *) &src[x + 3]);
+      const __m128i s4 = _mm_loadl_epi64((const __m128i *) &src[x + 4]);
+      const __m128i s5 = _mm_loadl_epi64((const __m128i *) &src[x + 5]);
+
+      __m128i sum = _mm_madd_epi16(_mm_unpacklo_epi16(s0, s1), xTaps12);
+      sum         = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(s2, s3), xTaps34));
+      sum         = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(s4, s5), xTaps56));
+
+      _mm_store_si128((__m128i *) &tmp[y][x], sum);
+    }
+  }
+
+  const int shift  = 2 * MCTF::FILTER_PREC;
+  const int offset = 1 << (shift - 1);
+
+#if USE_AVX2
+  if (vext >= AVX2 && (width & 7) == 0)
+  {
+    const __m256i vmax    = _mm256_set1_epi32(maxValue);
+    const __m256i voffset = _mm256_set1_epi32(offset);
+
+    for (int y = 0; y < height; y++, dst += dstStride)
+    {
+      for (int x = 0; x < width; x += 8)
+      {
+        __m256i sum = voffset;
+        for (int k = 0; k < 6; k++)
+        {
+          sum = _mm256_add_epi32(sum, _mm256_mullo_epi32(_mm256_load_si256((const __m256i *) &tmp[y + k][x]),
+                                                         _mm256_set1_epi32(yFilter[k + 1])));
+        }
+        sum = _mm256_min_epi32(vmax, _mm256_max_epi32(_mm256_setzero_si256(), _mm256_srai_epi32(sum, shift)));
+
+        _mm_storeu_si128((__m128i *) &dst[x],
+                         _mm_packs_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1)));
+      }
+    }
+    return;
+  }
+#endif
+
+  const __m128i vmax    = _mm_set1_epi32(maxValue);
+  const __m128i voffset = _mm_set1_epi32(offset);
+
+  for (int y = 0; y < height; y++, dst += dstStride)
+  {
+    for (int x = 0; x < width; x += 4)
+    {
+      __m128i sum = voffset;
+      for (int k = 0; k < 6; k++)
+      {
+        sum = _mm_add_epi32(
+          sum, _mm_mullo_epi32(_mm_load_si128((const __m128i *) &tmp[y + k][x]), _mm_set1_epi32(yFilter[k + 1])));
+      }
+      sum = _mm_min_epi32(vmax, _mm_max_epi32(_mm_setzero_si128(), _mm_srai_epi32(sum, shift)));
+
+      _mm_storel_epi64((__m128i *) &dst[x], _mm_packs_epi32(sum, sum));
+    }
+  }
+}
+}   // namespace SIMD::X86::TF
+#endif
+
+template<X86_VEXT vext> void MCTF::_initMCTFX86()
+{
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+  m_motionError = SIMD::X86::TF::motionError<vext>;
+  m_applyMotion = SIMD::X86::TF::applyMotion<vext>;
+#endif
+}
+
+template void MCTF::_initMCTFX86<SIMDX86>();
+
+#endif   // TARGET_SIMD_X86
@@ -0,0 +1,304 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the SIMD kernels for scalar quantization, dequantization and RDOQ level estimation
+ */
+
+#include "CommonDefX86.h"
+#include "../Quant.h"
+
+#ifdef TARGET_SIMD_X86
+
+#include <immintrin.h>
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+namespace SIMD::X86::Q
+{
+template<X86_VEXT vext>
+static void dequantCoeffs(const TCoeff *src, TCoeff *dst, const int numCoeff, const int *scales, const int scale,
+                          const int rightShift, const Intermediate_Int inputMinimum, const Intermediate_Int inputMaximum,
+                          const TCoeff outputMinimum, const TCoeff outputMaximum)
+{
+  // the input clipping guarantees that the products fit into 32 bit (see Quant::dequant)
+  const int     add       = rightShift > 0 ? 1 << (rightShift - 1) : 0;
+  const int     leftShift = rightShift > 0 ? 0 : -rightShift;
+  const __m128i vshift    = _mm_cvtsi32_si128(rightShift > 0 ? rightShift : 0);
+  const __m128i vlshift   = _mm_cvtsi32_si128(leftShift);
+
+  int n = 0;
+
+#if USE_AVX2
+  if constexpr (vext >= AVX2)
+  {
+    const __m256i vinMin  = _mm256_set1_epi32(inputMinimum);
+    const __m256i vinMax  = _mm256_set1_epi32(inputMaximum);
+    const __m256i voutMin = _mm256_set1_epi32(outputMinimum);
+    const __m256i voutMax = _mm256_set1_epi32(outputMaximum);
+    const __m256i vscale  = _mm256_set1_epi32(scale);
+    const __m256i vadd    = _mm256_set1_epi32(add);
+
+    for (; n + 8 <= numCoeff; n += 8)
+    {
+      __m256i v = _mm256_min_epi32(vinMax, _mm256_max_epi32(vinMin, _mm256_loadu_si256((const __m256i *) &src[n])));
+      v = _mm256_mullo_epi32(v, scales ? _mm256_loadu_si256((const __m256i *) &scales[n]) : vscale);
+      v = _mm256_sll_epi32(_mm256_sra_epi32(_mm256_add_epi32(v, vadd), vshift), vlshift);
+      v = _mm256_min_epi32(voutMax, _mm256_max_epi32(voutMin, v));
+      _mm256_storeu_si256((__m256i *) &dst[n], v);
+    }
+  }
+#endif
+
+  const __m128i vinMin  = _mm_set1_epi32(inputMinimum);
+  const __m128i vinMax  = _mm_set1_epi32(inputMaximum);
+  const __m128i voutMin = _mm_set1_epi32(outputMinimum);
+  const __m128i voutMax = _mm_set1_epi32(outputMaximum);
+  const __m128i vscale  = _mm_set1_epi32(scale);
+  const __m128i vadd    = _mm_set1_epi32(add);
+
+  for (; n + 4 <= numCoeff; n += 4)
+  {
+    __m128i v = _mm_min_epi32(vinMax, _mm_max_epi32(vinMin, _mm_loadu_si128((const __m128i *) &src[n])));
+    v         = _mm_mullo_epi32(v, scales ? _mm_loadu_si128((const __m128i *) &scales[n]) : vscale);
+    v         = _mm_sll_epi32(_mm_sra_epi32(_mm_add_epi32(v, vadd), vshift), vlshift);
+    v         = _mm_min_epi32(voutMax, _mm_max_epi32(voutMin, v));
+    _mm_storeu_si128((__m128i *) &dst[n], v);
+  }
+
+  for (; n < numCoeff; n++)
+  {
+    const Intermediate_Int clipQCoef = Clip3<Intermediate_Int>(inputMinimum, inputMaximum, src[n]);
+    const Intermediate_Int coeffQ    = ((clipQCoef * (scales ? scales[n] : scale) + add) >> (rightShift > 0 ? rightShift : 0)) * (1 << leftShift);
+
+    dst[n] = TCoeff(Clip3<Intermediate_Int>(outputMinimum, outputMaximum, coeffQ));
+  }
+}
+
+template<X86_VEXT vext>
+static TCoeff quantCoeffs(const TCoeff *src, TCoeff *dst, TCoeff *deltaU, const int numCoeff, const int *scales,
+                          const int scale, const int64_t add, const int qBits, const TCoeff entropyCodingMinimum,
+                          const TCoeff entropyCodingMaximum)
+{
+  const int qBits8 = qBits - 8;
+  TCoeff    absSum = 0;
+  int       n      = 0;
+
+  // the products are computed in 64 bit, the rounding remainder only fits into 32 bit for qBits <= 30
+  if (qBits <= 30)
+  {
+    const __m128i vqBits  = _mm_cvtsi32_si128(qBits);
+    const __m128i vqBits8 = _mm_cvtsi32_si128(qBits8);
+
+#if USE_AVX2
+    if constexpr (vext >= AVX2)
+    {
+      const __m256i vmin   = _mm256_set1_epi32(entropyCodingMinimum);
+      const __m256i vmax   = _mm256_set1_epi32(entropyCodingMaximum);
+      const __m256i vscale = _mm256_set1_epi32(scale);
+      const __m256i vadd   = _mm256_set1_epi64x(add);
+      __m256i       vsum   = _mm256_setzero_si256();
+
+      for (; n + 8 <= numCoeff; n += 8)
+      {
+        const __m256i level = _mm256_loadu_si256((const __m256i *) &src[n]);
+        const __m256i absLv = _mm256_abs_epi32(level);
+        const __m256i q     = scales ? _mm256_loadu_si256((const __m256i *) &scales[n]) : vscale;
+
+        const __m256i tmp0 = _mm256_mul_epi32(absLv, q);
+        const __m256i tmp1 = _mm256_mul_epi32(_mm256_srli_epi64(absLv, 32), _mm256_srli_epi64(q, 32));
+        const __m256i mag0 = _mm256_srl_epi64(_mm256_add_epi64(tmp0, vadd), vqBits);
+        const __m256i mag1 = _mm256_srl_epi64(_mm256_add_epi64(tmp1, vadd), vqBits);
+        const __m256i rem0 = _mm256_sub_epi64(tmp0, _mm256_sll_epi64(mag0, vqBits));
+        const __m256i rem1 = _mm256_sub_epi64(tmp1, _mm256_sll_epi64(mag1, vqBits));
+
+        const __m256i mag = _mm256_blend_epi32(mag0, _mm256_slli_epi64(mag1, 32), 0xAA);
+        const __m256i rem = _mm256_blend_epi32(rem0, _mm256_slli_epi64(rem1, 32), 0xAA);
+
+        vsum = _mm256_add_epi32(vsum, mag);
+        _mm256_storeu_si256((__m256i *) &deltaU[n], _mm256_sra_epi32(rem, vqBits8));
+        _mm256_storeu_si256((__m256i *) &dst[n],
+                            _mm256_min_epi32(vmax, _mm256_max_epi32(vmin, _mm256_sign_epi32(mag, level))));
+      }
+
+      __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(vsum), _mm256_extracti128_si256(vsum, 1));
+      sum         = _mm_hadd_epi32(sum, sum);
+      absSum += _mm_cvtsi128_si32(_mm_hadd_epi32(sum, sum));
+    }
+#endif
+
+    const __m128i vmin   = _mm_set1_epi32(entropyCodingMinimum);
+    const __m128i vmax   = _mm_set1_epi32(entropyCodingMaximum);
+    const __m128i vscale = _mm_set1_epi32(scale);
+    const __m128i vadd   = _mm_set1_epi64x(add);
+    __m128i       vsum   = _mm_setzero_si128();
+
+    for (; n + 4 <= numCoeff; n += 4)
+    {
+      const __m128i level = _mm_loadu_si128((const __m128i *) &src[n]);
+      const __m128i absLv = _mm_abs_epi32(level);
+      const __m128i q     = scales ? _mm_loadu_si128((const __m128i *) &scales[n]) : vscale;
+
+      const __m128i tmp0 = _mm_mul_epi32(absLv, q);
+      const __m128i tmp1 = _mm_mul_epi32(_mm_srli_epi64(absLv, 32), _mm_srli_epi64(q, 32));
+      const __m128i mag0 = _mm_srl_epi64(_mm_add_epi64(tmp0, vadd), vqBits);
+      const __m128i mag1 = _mm_srl_epi64(_mm_add_epi64(tmp1, vadd), vqBits);
+      const __m128i rem0 = _mm_sub_epi64(tmp0, _mm_sll_epi64(mag0, vqBits));
+      const __m128i rem1 = _mm_sub_epi64(tmp1, _mm_sll_epi64(mag1, vqBits));
+
+      const __m128i mag = _mm_blend_epi16(mag0, _mm_slli_epi64(mag1, 32), 0xCC);
+      const __m128i rem = _mm_blend_epi16(rem0, _mm_slli_epi64(rem1, 32), 0xCC);
+
+      vsum = _mm_add_epi32(vsum, mag);
+      _mm_storeu_si128((__m128i *) &deltaU[n], _mm_sra_epi32(rem, vqBits8));
+      _mm_storeu_si128((__m128i *) &dst[n], _mm_min_epi32(vmax, _mm_max_epi32(vmin, _mm_sign_epi32(mag, level))));
+    }
+
+    vsum = _mm_hadd_epi32(vsum, vsum);
+    absSum += _mm_cvtsi128_si32(_mm_hadd_epi32(vsum, vsum));
+  }
+
+  for (; n < numCoeff; n++)
+  {
+    const TCoeff  level    = src[n];
+    const int64_t tmpLevel = (int64_t) abs(level) * (scales ? scales[n] : scale);
+
+    const TCoeff quantisedMagnitude = TCoeff((tmpLevel + add) >> qBits);
+    deltaU[n]                       = (TCoeff) ((tmpLevel - ((int64_t) quantisedMagnitude << qBits)) >> qBits8);
+
+    absSum += quantisedMagnitude;
+    dst[n] = Clip3<TCoeff>(entropyCodingMinimum, entropyCodingMaximum, level < 0 ? -quantisedMagnitude : quantisedMagnitude);
+  }
+
+  return absSum;
+}
+
+template<X86_VEXT vext>
+static void rdoqLevels(const TCoeff *src, const ScanElement *scan, const int numCoeff, const int *scales, const int scale,
+                       const double *errScales, const double errScale, const int qBits, const TCoeff maxLevel,
+                       Intermediate_Int *levelDouble, TCoeff *maxAbsLevel, double *costCoeff0)
+{
+  // all products are below 2^53 and thereby exact in double precision, which gives the clipping to the
+  // intermediate range and the uncoded distortion in one go
+  const Intermediate_Int half     = Intermediate_Int(1) << (qBits - 1);
+  const double           maxValue = double(std::numeric_limits<Intermediate_Int>::max() - half);
+
+  const __m128i vhalf     = _mm_set1_epi32(half);
+  const __m128i vmaxLevel = _mm_set1_epi32(maxLevel);
+  const __m128i vqBits    = _mm_cvtsi32_si128(qBits);
+  const __m128i vscale    = _mm_set1_epi32(scale);
+
+  int n = 0;
+
+  for (; n + 4 <= numCoeff; n += 4)
+  {
+    __m128i q;
+    __m128i absLv;
+
+#if USE_AVX2
+    __m128i idx;
+
+    if constexpr (vext >= AVX2)
+    {
+      const __m256i scanElem = _mm256_loadu_si256((const __m256i *) &scan[n]);
+      idx = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(scanElem, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+
+      absLv = _mm_abs_epi32(_mm_i32gather_epi32(src, idx, sizeof(TCoeff)));
+      q     = scales ? _mm_i32gather_epi32(scales, idx, sizeof(int)) : vscale;
+    }
+    else
+#endif
+    {
+      absLv = _mm_abs_epi32(_mm_setr_epi32(src[scan[n].idx], src[scan[n + 1].idx], src[scan[n + 2].idx], src[scan[n + 3].idx]));
+      q     = scales ? _mm_setr_epi32(scales[scan[n].idx], scales[scan[n + 1].idx], scales[scan[n + 2].idx], scales[scan[n + 3].idx])
+                     : vscale;
+    }
+
+    __m128i level;
+
+#if USE_AVX2
+    if constexpr (vext >= AVX2)
+    {
+      const __m256d err = errScales ? _mm256_mask_i32gather_pd(_mm256_setzero_pd(), errScales, idx, _mm256_castsi256_pd(_mm256_set1_epi64x(-1)), sizeof(double))
+                                    : _mm256_set1_pd(errScale);
+
+      const __m256d lvl = _mm256_min_pd(_mm256_mul_pd(_mm256_cvtepi32_pd(absLv), _mm256_cvtepi32_pd(q)), _mm256_set1_pd(maxValue));
+      _mm256_storeu_pd(&costCoeff0[n], _mm256_mul_pd(_mm256_mul_pd(lvl, lvl), err));
+      level = _mm256_cvttpd_epi32(lvl);
+    }
+    else
+#endif
+    {
+      const __m128d err0 = errScales ? _mm_setr_pd(errScales[scan[n].idx], errScales[scan[n + 1].idx]) : _mm_set1_pd(errScale);
+      const __m128d err1 = errScales ? _mm_setr_pd(errScales[scan[n + 2].idx], errScales[scan[n + 3].idx]) : _mm_set1_pd(errScale);
+
+      const __m128d vmax = _mm_set1_pd(maxValue);
+      const __m128d lvl0 = _mm_min_pd(_mm_mul_pd(_mm_cvtepi32_pd(absLv), _mm_cvtepi32_pd(q)), vmax);
+      const __m128d lvl1 = _mm_min_pd(_mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(absLv, absLv)), _mm_cvtepi32_pd(_mm_unpackhi_epi64(q, q))), vmax);
+
+      _mm_storeu_pd(&costCoeff0[n], _mm_mul_pd(_mm_mul_pd(lvl0, lvl0), err0));
+      _mm_storeu_pd(&costCoeff0[n + 2], _mm_mul_pd(_mm_mul_pd(lvl1, lvl1), err1));
+      level = _mm_unpacklo_epi64(_mm_cvttpd_epi32(lvl0), _mm_cvttpd_epi32(lvl1));
+    }
+
+    _mm_storeu_si128((__m128i *) &levelDouble[n], level);
+    _mm_storeu_si128((__m128i *) &maxAbsLevel[n], _mm_min_epi32(vmaxLevel, _mm_sra_epi32(_mm_add_epi32(level, vhalf), vqBits)));
+  }
+
+  for (; n < numCoeff; n++)
+  {
+    const uint32_t blkPos   = scan[n].idx;
+    const int64_t  tmpLevel = int64_t(abs(src[blkPos])) * (scales ? scales[blkPos] : scale);
+
+    levelDouble[n] = (Intermediate_Int) std::min<int64_t>(tmpLevel, std::numeric_limits<Intermediate_Int>::max() - half);
+    maxAbsLevel[n] = std::min<uint32_t>(uint32_t(maxLevel), uint32_t((levelDouble[n] + half) >> qBits));
+
+    const double err = double(levelDouble[n]);
+    costCoeff0[n]    = err * err * (errScales ? errScales[blkPos] : errScale);
+  }
+}
+}   // namespace SIMD::X86::Q
+#endif
+
+template<X86_VEXT vext> void Quant::_initQuantX86()
+{
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+  m_dequantCoeffs = SIMD::X86::Q::dequantCoeffs<vext>;
+  m_quantCoeffs   = SIMD::X86::Q::quantCoeffs<vext>;
+  m_rdoqLevels    = SIMD::X86::Q::rdoqLevels<vext>;
+#endif
+}
+
+template void Quant::_initQuantX86<SIMDX86>();
+
+#endif   // TARGET_SIMD_X86
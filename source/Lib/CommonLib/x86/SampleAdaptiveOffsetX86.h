@@ -0,0 +1,214 @@
+/* The copyright in this software is being made available under the BSD
+ * License, included below. This software may be subject to other third party
+ * and contributor rights, including patent rights, and no such rights are
+ * granted under this license.
+ *
+ * Copyright (c) 2010-2024, ITU/ISO/IEC
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *  * Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ *  * Neither the name of the ITU/ISO/IEC nor the names of its contributors may
+ *    be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS
+ * BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ * \brief Implementation of the SIMD kernels of the SAO statistics
+ */
+
+#include "CommonDefX86.h"
+#include "../SampleAdaptiveOffset.h"
+
+#ifdef TARGET_SIMD_X86
+
+#include <immintrin.h>
+
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+namespace SIMD::X86::SAO
+{
+static inline int64_t horizontalSum(__m128i v)
+{
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0x4e));
+  v = _mm_add_epi32(v, _mm_shuffle_epi32(v, 0xb1));
+  return _mm_cvtsi128_si32(v);
+}
+
+// The sign of a difference is (a < b) - (a > b) with the all-ones masks of the comparisons. Per row, the sums of
+// org - s of each edge class are accumulated in 32-bit lanes and the counts in 16-bit lanes.
+template<X86_VEXT vext>
+static void calcEdgeStats(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride, int width,
+                          int height, ptrdiff_t offsetA, ptrdiff_t offsetB, int64_t *diff, int64_t *count)
+{
+  const __m128i ones = _mm_set1_epi16(1);
+
+  for (int y = 0; y < height; y++)
+  {
+    __m128i diffAcc[5];
+    __m128i countAcc[5];
+    for (int k = 0; k < 5; k++)
+    {
+      diffAcc[k]  = _mm_setzero_si128();
+      countAcc[k] = _mm_setzero_si128();
+    }
+
+    int x = 0;
+#if USE_AVX2
+    if (vext >= AVX2)
+    {
+      const __m256i ones256 = _mm256_set1_epi16(1);
+
+      __m256i diffAcc256[5];
+      __m256i countAcc256[5];
+      for (int k = 0; k < 5; k++)
+      {
+        diffAcc256[k]  = _mm256_setzero_si256();
+        countAcc256[k] = _mm256_setzero_si256();
+      }
+
+      for (; x + 16 <= width; x += 16)
+      {
+        const __m256i s = _mm256_loadu_si256((const __m256i *) &src[x]);
+        const __m256i a = _mm256_loadu_si256((const __m256i *) &src[x + offsetA]);
+        const __m256i b = _mm256_loadu_si256((const __m256i *) &src[x + offsetB]);
+        const __m256i o = _mm256_loadu_si256((const __m256i *) &org[x]);
+
+        const __m256i signA = _mm256_sub_epi16(_mm256_cmpgt_epi16(a, s), _mm256_cmpgt_epi16(s, a));
+        const __m256i signB = _mm256_sub_epi16(_mm256_cmpgt_epi16(b, s), _mm256_cmpgt_epi16(s, b));
+        const __m256i edge  = _mm256_add_epi16(signA, signB);
+        const __m256i d     = _mm256_sub_epi16(o, s);
+
+        for (int k = 0; k < 5; k++)
+        {
+          const __m256i mask = _mm256_cmpeq_epi16(edge, _mm256_set1_epi16(k - 2));
+          countAcc256[k]     = _mm256_sub_epi16(countAcc256[k], mask);
+          diffAcc256[k] = _mm256_add_epi32(diffAcc256[k], _mm256_madd_epi16(_mm256_and_si256(mask, d), ones256));
+        }
+      }
+
+      for (int k = 0; k < 5; k++)
+      {
+        diffAcc[k] = _mm_add_epi32(_mm256_castsi256_si128(diffAcc256[k]), _mm256_extracti128_si256(diffAcc256[k], 1));
+        countAcc[k] =
+          _mm_add_epi16(_mm256_castsi256_si128(countAcc256[k]), _mm256_extracti128_si256(countAcc256[k], 1));
+      }
+    }
+#endif
+
+    for (; x + 8 <= width; x += 8)
+    {
+      const __m128i s = _mm_loadu_si128((const __m128i *) &src[x]);
+      const __m128i a = _mm_loadu_si128((const __m128i *) &src[x + offsetA]);
+      const __m128i b = _mm_loadu_si128((const __m128i *) &src[x + offsetB]);
+      const __m128i o = _mm_loadu_si128((const __m128i *) &org[x]);
+
+      const __m128i signA = _mm_sub_epi16(_mm_cmpgt_epi16(a, s), _mm_cmpgt_epi16(s, a));
+      const __m128i signB = _mm_sub_epi16(_mm_cmpgt_epi16(b, s), _mm_cmpgt_epi16(s, b));
+      const __m128i edge  = _mm_add_epi16(signA, signB);
+      const __m128i d     = _mm_sub_epi16(o, s);
+
+      for (int k = 0; k < 5; k++)
+      {
+        const __m128i mask = _mm_cmpeq_epi16(edge, _mm_set1_epi16(k - 2));
+        countAcc[k]        = _mm_sub_epi16(countAcc[k], mask);
+        diffAcc[k]         = _mm_add_epi32(diffAcc[k], _mm_madd_epi16(_mm_and_si128(mask, d), ones));
+      }
+    }
+
+    for (int k = 0; k < 5; k++)
+    {
+      diff[k - 2] += horizontalSum(diffAcc[k]);
+      count[k - 2] += horizontalSum(_mm_madd_epi16(countAcc[k], ones));
+    }
+
+    for (; x < width; x++)
+    {
+      const int edgeType = sgn(src[x] - src[x + offsetA]) + sgn(src[x] - src[x + offsetB]);
+      diff[edgeType] += org[x] - src[x];
+      count[edgeType]++;
+    }
+
+    src += srcStride;
+    org += orgStride;
+  }
+}
+
+// The bands and differences are derived eight samples at a time, the histogram is gathered in local 32-bit bins
+template<X86_VEXT vext>
+static void calcBandStats(const Pel *src, ptrdiff_t srcStride, const Pel *org, ptrdiff_t orgStride, int width,
+                          int height, int shift, int64_t *diff, int64_t *count)
+{
+  const __m128i shiftVec = _mm_cvtsi32_si128(shift);
+
+  for (int y = 0; y < height; y++)
+  {
+    int bandDiff[NUM_SAO_BO_CLASSES]  = { 0 };
+    int bandCount[NUM_SAO_BO_CLASSES] = { 0 };
+
+    int x = 0;
+    for (; x + 8 <= width; x += 8)
+    {
+      const __m128i s = _mm_loadu_si128((const __m128i *) &src[x]);
+      const __m128i o = _mm_loadu_si128((const __m128i *) &org[x]);
+
+      int16_t bands[8];
+      int16_t diffs[8];
+      _mm_storeu_si128((__m128i *) bands, _mm_srl_epi16(s, shiftVec));
+      _mm_storeu_si128((__m128i *) diffs, _mm_sub_epi16(o, s));
+
+      for (int i = 0; i < 8; i++)
+      {
+        bandDiff[bands[i]] += diffs[i];
+        bandCount[bands[i]]++;
+      }
+    }
+    for (; x < width; x++)
+    {
+      const int bandIdx = src[x] >> shift;
+      bandDiff[bandIdx] += org[x] - src[x];
+      bandCount[bandIdx]++;
+    }
+
+    for (int i = 0; i < NUM_SAO_BO_CLASSES; i++)
+    {
+      diff[i] += bandDiff[i];
+      count[i] += bandCount[i];
+    }
+
+    src += srcStride;
+    org += orgStride;
+  }
+}
+}   // namespace SIMD::X86::SAO
+#endif
+
+template<X86_VEXT vext> void SampleAdaptiveOffset::_initSampleAdaptiveOffsetX86()
+{
+#if !RExt__HIGH_BIT_DEPTH_SUPPORT
+  m_calcEdgeStats = SIMD::X86::SAO::calcEdgeStats<vext>;
+  m_calcBandStats = SIMD::X86::SAO::calcBandStats<vext>;
+#endif
+}
+
+template void SampleAdaptiveOffset::_initSampleAdaptiveOffsetX86<SIMDX86>();
+
+#endif   // TARGET_SIMD_X86
@@ -452,6 +452,136 @@ static void matrixMult(const TCoeff* src, TCoeff* dst, int shift, int numRowsIn,
                                 maxOutVal, M[TRANSFORM_INVERSE]);
 }
 }   // namespace Inv
+
+//---------------------------------------------------------------------------------------------------------------------
+
+namespace Lfnst   // Low-frequency non-separable transform functions
+{
+// Load 16 matrix coefficients and widen them in groups of 4
+static inline void loadLfnstCoeff(const int8_t* p, __m128i m[4])
+{
+  const __m128i x = _mm_loadu_si128((const __m128i*) p);
+
+  m[0] = _mm_cvtepi8_epi32(x);
+  m[1] = _mm_cvtepi8_epi32(_mm_srli_si128(x, 4));
+  m[2] = _mm_cvtepi8_epi32(_mm_srli_si128(x, 8));
+  m[3] = _mm_cvtepi8_epi32(_mm_srli_si128(x, 12));
+}
+
+template<X86_VEXT vext> static void fwd(const TCoeff* src, TCoeff* dst, const int8_t* trMat, int trSize, int zeroOutSize)
+{
+  // each output is the dot product of the input with one matrix row, four outputs are reduced together
+  const __m128i add = _mm_set1_epi32(64);
+
+  for (int j = 0; j < zeroOutSize; j += 4)
+  {
+    __m128i acc[4];
+
+#if USE_AVX2
+    if constexpr (vext >= AVX2)
+    {
+      __m256i acc2[4];
+
+      for (int k = 0; k < 4; k++)
+      {
+        const int8_t* row = trMat + (j + k) * trSize;
+
+        acc2[k] = _mm256_setzero_si256();
+        for (int i = 0; i < trSize; i += 16)
+        {
+          const __m128i m = _mm_loadu_si128((const __m128i*) &row[i]);
+
+          acc2[k] = _mm256_add_epi32(acc2[k], _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*) &src[i]),
+                                                                 _mm256_cvtepi8_epi32(m)));
+          acc2[k] = _mm256_add_epi32(acc2[k], _mm256_mullo_epi32(_mm256_loadu_si256((const __m256i*) &src[i + 8]),
+                                                                 _mm256_cvtepi8_epi32(_mm_srli_si128(m, 8))));
+        }
+        acc[k] = _mm_add_epi32(_mm256_castsi256_si128(acc2[k]), _mm256_extracti128_si256(acc2[k], 1));
+      }
+    }
+    else
+#endif
+    {
+      for (int k = 0; k < 4; k++)
+      {
+        const int8_t* row = trMat + (j + k) * trSize;
+
+        acc[k] = _mm_setzero_si128();
+        for (int i = 0; i < trSize; i += 16)
+        {
+          __m128i m[4];
+          loadLfnstCoeff(&row[i], m);
+
+          for (int l = 0; l < 4; l++)
+          {
+            acc[k] = _mm_add_epi32(acc[k], _mm_mullo_epi32(loadCoeff(&src[i + 4 * l]), m[l]));
+          }
+        }
+      }
+    }
+
+    const __m128i sum = _mm_hadd_epi32(_mm_hadd_epi32(acc[0], acc[1]), _mm_hadd_epi32(acc[2], acc[3]));
+    storeCoeff(&dst[j], _mm_srai_epi32(_mm_add_epi32(sum, add), 7));
+  }
+}
+
+template<X86_VEXT vext>
+static void inv(const TCoeff* src, TCoeff* dst, const int8_t* trMat, int trSize, int zeroOutSize,
+                const TCoeff outputMinimum, const TCoeff outputMaximum)
+{
+  // each input scales one matrix row, 16 outputs are accumulated at a time
+  for (int j = 0; j < trSize; j += 16)
+  {
+#if USE_AVX2
+    if constexpr (vext >= AVX2)
+    {
+      __m256i acc[2] = { _mm256_set1_epi32(64), _mm256_set1_epi32(64) };
+
+      for (int i = 0; i < zeroOutSize; i++)
+      {
+        const __m256i c = _mm256_set1_epi32(src[i]);
+        const __m128i m = _mm_loadu_si128((const __m128i*) &trMat[i * trSize + j]);
+
+        acc[0] = _mm256_add_epi32(acc[0], _mm256_mullo_epi32(c, _mm256_cvtepi8_epi32(m)));
+        acc[1] = _mm256_add_epi32(acc[1], _mm256_mullo_epi32(c, _mm256_cvtepi8_epi32(_mm_srli_si128(m, 8))));
+      }
+
+      const __m256i vmin = _mm256_set1_epi32(outputMinimum);
+      const __m256i vmax = _mm256_set1_epi32(outputMaximum);
+
+      for (int l = 0; l < 2; l++)
+      {
+        storeCoeff(&dst[j + 8 * l], _mm256_min_epi32(vmax, _mm256_max_epi32(vmin, _mm256_srai_epi32(acc[l], 7))));
+      }
+    }
+    else
+#endif
+    {
+      __m128i acc[4] = { _mm_set1_epi32(64), _mm_set1_epi32(64), _mm_set1_epi32(64), _mm_set1_epi32(64) };
+
+      for (int i = 0; i < zeroOutSize; i++)
+      {
+        const __m128i c = _mm_set1_epi32(src[i]);
+        __m128i       m[4];
+        loadLfnstCoeff(&trMat[i * trSize + j], m);
+
+        for (int l = 0; l < 4; l++)
+        {
+          acc[l] = _mm_add_epi32(acc[l], _mm_mullo_epi32(c, m[l]));
+        }
+      }
+
+      const __m128i vmin = _mm_set1_epi32(outputMinimum);
+      const __m128i vmax = _mm_set1_epi32(outputMaximum);
+
+      for (int l = 0; l < 4; l++)
+      {
+        storeCoeff(&dst[j + 4 * l], _mm_min_epi32(vmax, _mm_max_epi32(vmin, _mm_srai_epi32(acc[l], 7))));
+      }
+    }
+  }
+}
+}   // namespace Lfnst
 #endif
 }   // namespace SIMD::X86::TX
 
@@ -493,6 +623,9 @@ template<X86_VEXT vext> void TrQuant::_initX86()
   m_invTx[TransType::DCT8][2] = SIMD::X86::TX::Inv::matrixMult<vext, 8, g_trCoreDCT8P8>;
   m_invTx[TransType::DCT8][3] = SIMD::X86::TX::Inv::matrixMult<vext, 16, g_trCoreDCT8P16>;
   m_invTx[TransType::DCT8][4] = SIMD::X86::TX::Inv::matrixMult<vext, 32, g_trCoreDCT8P32>;
+
+  m_fwdLfnst = SIMD::X86::TX::Lfnst::fwd<vext>;
+  m_invLfnst = SIMD::X86::TX::Lfnst::inv<vext>;
 #endif
 }
 
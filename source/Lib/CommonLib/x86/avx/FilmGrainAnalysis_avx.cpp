@@ -0,0 +1 @@
+#include "../FilmGrainAnalysisX86.h"
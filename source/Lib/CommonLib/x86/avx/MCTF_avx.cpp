@@ -0,0 +1 @@
+#include "../MCTFX86.h"
@@ -38,6 +38,8 @@
 
 
 #include <stdint.h>
+#include <algorithm>
+#include <cstring>
 #include <vector>
 #include "AnnexBread.h"
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
@@ -47,6 +49,75 @@
 //! \ingroup DecoderLib
 //! \{
 
+uint32_t InputByteStream::readBytesUntilStartCode(std::vector<uint8_t> &buf)
+{
+  if (m_numFutureBytes != 0 || !m_input.good())
+  {
+    return 0;
+  }
+
+  std::streambuf *sb        = m_input.rdbuf();
+  const size_t    bufStart  = buf.size();
+  size_t          chunkSize = MIN_CHUNK_SIZE;
+  while (true)
+  {
+    // make sure the get area of the stream buffer holds data, in_avail() then returns its size
+    if (sb->sgetc() == std::char_traits<char>::eof())
+    {
+      break;
+    }
+    const size_t avail = (size_t) sb->in_avail();
+
+    // copy a chunk from the get area, leaving at least one byte in it so that the stream buffer is not refilled
+    const size_t size    = avail > 1 ? std::min(chunkSize, avail - 1) : 1;
+    const size_t oldSize = buf.size();
+    buf.resize(oldSize + size);
+    sb->sgetn((char *) buf.data() + oldSize, size);
+
+    // search the zero bytes with memchr(), which is vectorised by the C library, starting two bytes before the chunk
+    // so that start code prefixes spanning two chunks are found
+    const uint8_t *data  = buf.data();
+    const size_t   end   = buf.size() >= bufStart + 3 ? buf.size() - 2 : bufStart;
+    size_t         pos   = std::max(bufStart + 2, oldSize) - 2;
+    bool           found = false;
+    while (!found && pos < end)
+    {
+      const uint8_t *zero = (const uint8_t *) memchr(data + pos, 0, end - pos);
+      if (zero == nullptr)
+      {
+        break;
+      }
+      pos   = zero - data;
+      found = data[pos + 1] == 0 && data[pos + 2] <= 2;
+      pos += found ? 0 : 1;
+    }
+
+    if (found)
+    {
+      // hand the chunk bytes from the start code prefix on back to the stream buffer, they are still in its get
+      // area, and keep the zero bytes of a prefix that started in an earlier chunk as peeked bytes
+      const size_t numPutBack = buf.size() - std::max(pos, oldSize);
+      for (size_t i = 0; i < numPutBack; i++)
+      {
+        if (sb->sungetc() == std::char_traits<char>::eof())
+        {
+          CHECK(sb->pubseekoff(std::streamoff(i) - std::streamoff(numPutBack), std::ios_base::cur, std::ios_base::in) < 0,
+                "Cannot return bytes to the input stream");
+          break;
+        }
+      }
+      m_numFutureBytes = uint32_t(oldSize > pos ? oldSize - pos : 0);
+      m_futureBytes    = 0;
+      buf.resize(pos);
+      break;
+    }
+
+    // larger NAL units are read in larger chunks
+    chunkSize = std::min(2 * chunkSize, MAX_CHUNK_SIZE);
+  }
+  return uint32_t(buf.size() - bufStart);
+}
+
 /**
  * Parse an AVC AnnexB Bytestream bs to extract a single nalUnit
  * while accumulating bytestream statistics into stats.
@@ -141,7 +212,13 @@ static void _byteStreamNALUnit(InputByteStream &bs, std::vector<uint8_t> &nalUni
   /* NB, (unsigned)x > 2 implies n!=0 && n!=1 */
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::SStat &bodyStats=CodingStatistics::GetStatisticEP(STATS__NAL_UNIT_TOTAL_BODY);
+  const uint32_t numBlockBytes = bs.readBytesUntilStartCode(nalUnit);
+  bodyStats.bits += 8 * numBlockBytes;
+  bodyStats.count += numBlockBytes;
+#else
+  bs.readBytesUntilStartCode(nalUnit);
 #endif
+  /* the remaining bytes, if any, are read one at a time */
   while (bs.eofBeforeNBytes(24/8) || bs.peekBytes(24/8) > 2)
   {
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
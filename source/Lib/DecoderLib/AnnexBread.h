@@ -154,14 +154,33 @@ public:
     return val;
   }
 
+  /**
+   * consume bytes from the input and append them to buf, stopping
+   * before the next start code prefix, i.e. before the next three
+   * bytes equal to 0x000000, 0x000001 or 0x000002, or at the end of
+   * the input.
+   *
+   * The bytes are taken in chunks from the get area of the stream
+   * buffer, without seeking. The chunks start small and grow with
+   * the NAL unit, and the bytes read beyond the start code prefix are
+   * returned to the stream buffer. Nothing is consumed if bytes have
+   * been peeked.
+   *
+   * Returns the number of bytes appended to buf.
+   */
+  uint32_t readBytesUntilStartCode(std::vector<uint8_t> &buf);
+
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   uint32_t getNumBufferedBytes() const { return m_numFutureBytes; }
 #endif
 
 private:
-  uint32_t      m_numFutureBytes; /* number of valid bytes in m_futureBytes */
-  uint32_t      m_futureBytes;    /* bytes that have been peeked */
-  std::istream &m_input;          /* Input stream to read from */
+  static constexpr size_t MIN_CHUNK_SIZE = 64;
+  static constexpr size_t MAX_CHUNK_SIZE = 1 << 16;
+
+  uint32_t             m_numFutureBytes; /* number of valid bytes in m_futureBytes */
+  uint32_t             m_futureBytes;    /* bytes that have been peeked */
+  std::istream        &m_input;          /* Input stream to read from */
 };
 
 /**
@@ -46,7 +46,14 @@
 
 template<class BinProbModel>
 BinDecoderBase::BinDecoderBase(const BinProbModel *dummy)
-  : Ctx(dummy), m_bitstream(nullptr), m_range(0), m_value(0), m_bitsNeeded(0)
+  : Ctx(dummy)
+  , m_bitstream(nullptr)
+  , m_bytes(nullptr)
+  , m_numBytes(0)
+  , m_bytePos(0)
+  , m_range(0)
+  , m_value(0)
+  , m_bitsNeeded(0)
 {}
 
 void BinDecoderBase::init( InputBitstream* bitstream )
@@ -62,20 +69,61 @@ void BinDecoderBase::uninit()
 void BinDecoderBase::start()
 {
   CHECK(m_bitstream->getNumBitsUntilByteAligned(), "Bitstream is not byte aligned.");
+  CHECK(m_bitstream->getNumBitsLeft() < 16, "FIFO exceeded");
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::UpdateCABACStat(STATS__CABAC_INITIALISATION, 512, 510, 0);
 #endif
+  // the bytes are read in place, the bitstream is only advanced by finish()
+  m_bytes       = m_bitstream->getFifo().data() + m_bitstream->getByteLocation();
+  m_numBytes    = m_bitstream->getNumBitsLeft() >> 3;
+  m_bytePos     = 0;
   m_range       = 510;
-  m_value       = (m_bitstream->readByte() << 8) + m_bitstream->readByte();
-  m_bitsNeeded  = -8;
+  m_value       = 0;
+  m_bitsNeeded  = 9;
+  refill();
 }
 
 void BinDecoderBase::finish()
 {
-  unsigned lastByte;
-  m_bitstream->peekPreviousByte(lastByte);
-  CHECK( ( ( lastByte << ( 8 + m_bitsNeeded ) ) & 0xff ) != 0x80,
+  // the byte-wise engine has read the two initial bytes and one more byte for every 8 bits consumed
+  const uint32_t numBitsConsumed = getNumBitsConsumed();
+  const uint32_t numBytesRead    = 2 + (numBitsConsumed >> 3);
+  CHECK(numBytesRead > m_numBytes, "FIFO exceeded");
+
+  const unsigned lastByte = m_bytes[numBytesRead - 1];
+  CHECK( ( ( lastByte << ( numBitsConsumed & 7 ) ) & 0xff ) != 0x80,
         "No proper stop/alignment pattern at end of CABAC stream." );
+  m_bitstream->skipBytes(numBytesRead);
+}
+
+void BinDecoderBase::refill()
+{
+  // loads whole bytes below the buffered bits until at least VALUE_SHIFT - 7 bits are buffered
+  if (m_bytePos + 8 <= m_numBytes)
+  {
+    const uint8_t *bytes = m_bytes + m_bytePos;
+    uint64_t       word  = 0;
+    for (int i = 0; i < 8; i++)
+    {
+      word = (word << 8) | bytes[i];
+    }
+    // the bits of the last, partially loaded byte are loaded again by the next refill at the same position
+    const int numBytes = (m_bitsNeeded + VALUE_SHIFT) >> 3;
+    m_value |= word >> (64 - VALUE_SHIFT - m_bitsNeeded);
+    m_bytePos += numBytes;
+    m_bitsNeeded -= 8 * numBytes;
+  }
+  else
+  {
+    // zeros are loaded after the end of the stream, finish() checks that they were not used
+    while (m_bitsNeeded >= 8 - VALUE_SHIFT)
+    {
+      const uint64_t byte = m_bytePos < m_numBytes ? m_bytes[m_bytePos] : 0;
+      m_value |= byte << (VALUE_SHIFT - 8 + m_bitsNeeded);
+      m_bytePos++;
+      m_bitsNeeded -= 8;
+    }
+  }
 }
 
 void BinDecoderBase::reset( int qp, int initId )
@@ -92,14 +140,13 @@ void BinDecoderBase::riceStatReset(int bitDepth, bool persistentRiceAdaptationEn
 unsigned BinDecoderBase::decodeBinEP()
 {
   m_value += m_value;
-  if( ++m_bitsNeeded >= 0 )
+  if( ++m_bitsNeeded > 0 )
   {
-    m_value += m_bitstream->readByte();
-    m_bitsNeeded      = -8;
+    refill();
   }
 
   unsigned bin = 0;
-  unsigned scaledRange = m_range << 7;
+  const uint64_t scaledRange = uint64_t(m_range) << VALUE_SHIFT;
   if (m_value >= scaledRange)
   {
     m_value -= scaledRange;
@@ -114,58 +161,32 @@ unsigned BinDecoderBase::decodeBinEP()
 
 unsigned BinDecoderBase::decodeBinsEP( unsigned numBins )
 {
-#if ENABLE_TRACING
-  int numBinsOrig = numBins;
-#endif
+  CHECK(numBins > 32, "Too many bypass bins");
 
-  if (m_range == 256)
-  {
-    return decodeAlignedBinsEP( numBins );
-  }
-  unsigned remBins = numBins;
-  unsigned bins    = 0;
-  while(   remBins > 8 )
-  {
-    m_value              = (m_value << 8) + (m_bitstream->readByte() << (8 + m_bitsNeeded));
-    unsigned scaledRange = m_range << 15;
-    for( int i = 0; i < 8; i++ )
-    {
-      bins += bins;
-      scaledRange >>= 1;
-      if (m_value >= scaledRange)
-      {
-        bins    ++;
-        m_value -= scaledRange;
-      }
-    }
-    remBins -= 8;
-  }
-  m_bitsNeeded   += remBins;
-  m_value <<= remBins;
-  if( m_bitsNeeded >= 0 )
-  {
-    m_value += m_bitstream->readByte() << m_bitsNeeded;
-    m_bitsNeeded -= 8;
-  }
-  unsigned scaledRange = m_range << (remBins + 7);
-  for ( int i = 0; i < remBins; i++ )
+  if( m_bitsNeeded > -int( numBins ) )
   {
-    bins += bins;
-    scaledRange >>= 1;
-    if (m_value >= scaledRange)
-    {
-      bins    ++;
-      m_value -= scaledRange;
-    }
+    refill();
   }
+
+  // Decoding numBins bypass bins one by one is a binary long division of the offset, extended by the next numBins
+  // bits, by the range: the bins are the quotient and the new offset is the remainder. With a range of 256 (after
+  // align()) the division is a shift.
+  const uint64_t dividend  = m_value >> (VALUE_SHIFT - numBins);
+  const uint64_t quotient  = m_range == 256 ? dividend >> 8 : dividend / m_range;
+  const uint64_t remainder = dividend - quotient * m_range;
+  const unsigned bins      = unsigned(quotient);
+
+  m_value = (remainder << VALUE_SHIFT) | ((m_value << numBins) & ((uint64_t(1) << VALUE_SHIFT) - 1));
+  m_bitsNeeded += numBins;
+
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   CodingStatistics::IncrementStatisticEP( *ptype, numBins, int(bins) );
 #endif
 #if ENABLE_TRACING
-  for( int i = 0; i < numBinsOrig; i++ )
+  for( int i = 0; i < int( numBins ); i++ )
   {
     DTRACE(g_trace_ctx, D_CABAC, "%d  %d  EP=%d \n", DTRACE_GET_COUNTER(g_trace_ctx, D_CABAC), m_range,
-           (bins >> (numBinsOrig - 1 - i)) & 1);
+           (bins >> (numBins - 1 - i)) & 1);
   }
 #endif
   return bins;
@@ -203,12 +224,12 @@ unsigned BinDecoderBase::decodeRemAbsEP(unsigned goRicePar, unsigned cutoff, int
 unsigned BinDecoderBase::decodeBinTrm()
 {
   m_range -= 2;
-  unsigned scaledRange = m_range << 7;
+  const uint64_t scaledRange = uint64_t(m_range) << VALUE_SHIFT;
   if (m_value >= scaledRange)
   {
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
     CodingStatistics::UpdateCABACStat(STATS__CABAC_TRM_BITS, m_range + 2, 2, 1);
-    CodingStatistics::IncrementStatisticEP( STATS__BYTE_ALIGNMENT_BITS, -m_bitsNeeded, 0 );
+    CodingStatistics::IncrementStatisticEP( STATS__BYTE_ALIGNMENT_BITS, 8 - ( getNumBitsConsumed() & 7 ), 0 );
 #endif
     return 1;
   }
@@ -221,10 +242,9 @@ unsigned BinDecoderBase::decodeBinTrm()
     {
       m_range += m_range;
       m_value += m_value;
-      if( ++m_bitsNeeded == 0 )
+      if( ++m_bitsNeeded > 0 )
       {
-        m_value += m_bitstream->readByte();
-        m_bitsNeeded  = -8;
+        refill();
       }
     }
     return 0;
@@ -239,50 +259,6 @@ void BinDecoderBase::align()
   m_range = 256;
 }
 
-unsigned BinDecoderBase::decodeAlignedBinsEP( unsigned numBins )
-{
-#if ENABLE_TRACING
-  int numBinsOrig = numBins;
-#endif
-  unsigned remBins = numBins;
-  unsigned bins    = 0;
-  while(   remBins > 0 )
-  {
-    // The MSB of m_value is known to be 0 because range is 256. Therefore:
-    //   > The comparison against the symbol range of 128 is simply a test on the next-most-significant bit
-    //   > "Subtracting" the symbol range if the decoded bin is 1 simply involves clearing that bit.
-    //  As a result, the required bins are simply the <binsToRead> next-most-significant bits of m_value
-    //  (m_value is stored MSB-aligned in a 16-bit buffer - hence the shift of 15)
-    //
-    //    m_value = |0|V|V|V|V|V|V|V|V|B|B|B|B|B|B|B|
-    //    (V = usable bit, B = potential buffered bit (buffer refills when m_bitsNeeded >= 0))
-    //
-    unsigned binsToRead = std::min<unsigned>( remBins, 8 ); //read bytes if able to take advantage of the system's byte-read function
-    unsigned binMask    = ( 1 << binsToRead ) - 1;
-    unsigned newBins    = (m_value >> (15 - binsToRead)) & binMask;
-    bins                = ( bins    << binsToRead) | newBins;
-    m_value             = (m_value << binsToRead) & 0x7FFF;
-    remBins            -= binsToRead;
-    m_bitsNeeded       += binsToRead;
-    if( m_bitsNeeded >= 0 )
-    {
-      m_value |= m_bitstream->readByte() << m_bitsNeeded;
-      m_bitsNeeded     -= 8;
-    }
-  }
-#if RExt__DECODER_DEBUG_BIT_STATISTICS
-  CodingStatistics::IncrementStatisticEP( *ptype, numBins, int(bins) );
-#endif
-#if ENABLE_TRACING
-  for( int i = 0; i < numBinsOrig; i++ )
-  {
-    DTRACE(g_trace_ctx, D_CABAC, "%d  %d  EP=%d \n", DTRACE_GET_COUNTER(g_trace_ctx, D_CABAC), m_range,
-           (bins >> (numBinsOrig - 1 - i)) & 1);
-  }
-#endif
-  return bins;
-}
-
 template<class BinProbModel>
 TBinDecoder<BinProbModel>::TBinDecoder()
   : BinDecoderBase(static_cast<const BinProbModel *>(nullptr)), m_ctx(static_cast<CtxStore<BinProbModel> &>(*this))
@@ -297,10 +273,10 @@ unsigned TBinDecoder<BinProbModel>::decodeBin( unsigned ctxId )
 
   DTRACE(g_trace_ctx, D_CABAC, "%d %d %d  [%d:%d]  %2d(MPS=%d)  ", DTRACE_GET_COUNTER(g_trace_ctx, D_CABAC), ctxId,
          m_range, m_range - lpsRange, lpsRange, (unsigned int) (probModel.state()),
-         m_value < ((m_range - lpsRange) << 7));
+         m_value < (uint64_t(m_range - lpsRange) << VALUE_SHIFT));
 
   m_range -= lpsRange;
-  uint32_t scaledRange = m_range << 7;
+  const uint64_t scaledRange = uint64_t(m_range) << VALUE_SHIFT;
   if (m_value < scaledRange)
   {
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
@@ -313,10 +289,9 @@ unsigned TBinDecoder<BinProbModel>::decodeBin( unsigned ctxId )
       m_range <<= numBits;
       m_value <<= numBits;
       m_bitsNeeded += numBits;
-      if( m_bitsNeeded >= 0 )
+      if( m_bitsNeeded > 0 )
       {
-        m_value += m_bitstream->readByte() << m_bitsNeeded;
-        m_bitsNeeded -= 8;
+        refill();
       }
     }
   }
@@ -332,10 +307,9 @@ unsigned TBinDecoder<BinProbModel>::decodeBin( unsigned ctxId )
     m_value = m_value << numBits;
     m_range = lpsRange << numBits;
     m_bitsNeeded += numBits;
-    if( m_bitsNeeded >= 0 )
+    if( m_bitsNeeded > 0 )
     {
-      m_value += m_bitstream->readByte() << m_bitsNeeded;
-      m_bitsNeeded -= 8;
+      refill();
     }
   }
   probModel.update(bin);
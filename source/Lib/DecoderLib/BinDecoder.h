@@ -77,15 +77,24 @@ public:
   void              align               ();
   unsigned          getNumBitsRead()
   {
-    return m_bitstream->getNumBitsRead() + m_bitsNeeded;
+    return m_bitstream->getNumBitsRead() + getNumBitsConsumed();
   }
 
-private:
-  unsigned          decodeAlignedBinsEP ( unsigned numBins  );
 protected:
+  // The arithmetic decoder keeps the 9-bit offset at bit VALUE_SHIFT of m_value, one bit of headroom above it and up
+  // to VALUE_SHIFT bits of the following data below it. m_bitsNeeded is the number of offset bits that still have to
+  // be loaded, it is negative when bits are buffered.
+  static constexpr int VALUE_SHIFT = 54;
+
+  uint32_t          getNumBitsConsumed  () const { return 8 * m_bytePos - 9 + m_bitsNeeded; }
+  void              refill              ();
+
   InputBitstream   *m_bitstream;
+  const uint8_t    *m_bytes;       // remaining bytes of m_bitstream when start() was called
+  uint32_t          m_numBytes;
+  uint32_t          m_bytePos;     // number of bytes loaded into m_value, including the zero padding after the end
   uint32_t          m_range;
-  uint32_t          m_value;
+  uint64_t          m_value;
   int32_t           m_bitsNeeded;
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
   const CodingStatisticsClassType* ptype;
@@ -3566,7 +3566,8 @@ bool DecLib::xDecodeSlice(InputNALUnit &nalu, int &iSkipFrame, int iPOCLastDispl
         m_cReshaper.setRecReshaped(false);
       }
     }
-    m_cReshaper.setVPDULoc(-1, -1);
+    m_cReshaper.resetVpduChromaScale(pcSlice->getPPS()->getPicWidthInLumaSamples(),
+                                     pcSlice->getPPS()->getPicHeightInLumaSamples(), pcSlice->getSPS()->getCTUSize());
   }
   else
   {
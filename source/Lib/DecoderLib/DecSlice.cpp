@@ -103,19 +103,23 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
 
   const unsigned numSubstreams = slice->getNumberOfSubstreamSizes() + 1;
 
-  // init each couple {EntropyDecoder, Substream}
-  // Table of extracted substreams.
-  std::vector<InputBitstream*> ppcSubstreams( numSubstreams );
-  for( unsigned idx = 0; idx < numSubstreams; idx++ )
+  // the substreams are read in place from the slice bitstream, only their byte positions are determined here
+  CHECK(bitstream->getNumBitsUntilByteAligned(), "Slice data is not byte aligned");
+  std::vector<uint32_t> substreamStart( numSubstreams + 1 );
+  substreamStart[0]             = bitstream->getByteLocation();
+  substreamStart[numSubstreams] = bitstream->getByteLocation() + ( bitstream->getNumBitsLeft() >> 3 );
+  for( unsigned idx = 0; idx + 1 < numSubstreams; idx++ )
   {
-    ppcSubstreams[idx] = bitstream->extractSubstream( idx+1 < numSubstreams ? ( slice->getSubstreamSize(idx) << 3 ) : bitstream->getNumBitsLeft() );
+    substreamStart[idx + 1] = substreamStart[idx] + slice->getSubstreamSize( idx );
   }
+  CHECK( substreamStart[numSubstreams - 1] > substreamStart[numSubstreams], "Substream sizes exceed the slice data" );
+  bitstream->setSubstream( substreamStart[0], substreamStart[1] - substreamStart[0] );
 
   const unsigned  widthInCtus             = cs.pcv->widthInCtus;
   const bool     wavefrontsEnabled           = cs.sps->getEntropyCodingSyncEnabledFlag();
   const bool     entryPointPresent           = cs.sps->getEntryPointsPresentFlag();
 
-  cabacReader.initBitstream( ppcSubstreams[0] );
+  cabacReader.initBitstream( bitstream );
   cabacReader.initCtxModels( *slice );
 
   // Quantization parameter
@@ -177,8 +181,6 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
 
     DTRACE_UPDATE( g_trace_ctx, std::make_pair( "ctu", ctuRsAddr ) );
 
-    cabacReader.initBitstream( ppcSubstreams[subStrmId] );
-
     // set up CABAC contexts' state for this CTU
     if( ctuXPosInCtus == tileXPosInCtus && ctuYPosInCtus == tileYPosInCtus )
     {
@@ -268,6 +270,8 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
         cabacReader.remaining_bytes( true );
 #endif
         subStrmId++;
+        CHECK( subStrmId >= numSubstreams, "Too few substreams in the slice" );
+        bitstream->setSubstream( substreamStart[subStrmId], substreamStart[subStrmId + 1] - substreamStart[subStrmId] );
       }
     }
     if (slice->getPPS()->getNumSubPics() >= 2 && curSubPic.getTreatedAsPicFlag() && ctuIdx == (slice->getNumCtuInSlice() - 1))
@@ -325,12 +329,7 @@ void DecSlice::decompressSlice( Slice* slice, InputBitstream* bitstream, int deb
   }
   slice->setFeatureCounter(featureCounter);
 #endif
-  
-  // deallocate all created substreams, including internal buffers.
-  for( auto substr: ppcSubstreams )
-  {
-    delete substr;
-  }
+
   slice->stopProcessingTimer();
 }
 
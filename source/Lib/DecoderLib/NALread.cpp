@@ -40,6 +40,7 @@
 #include <vector>
 #include <algorithm>
 #include <ostream>
+#include <cstring>
 
 #include "NALread.h"
 
@@ -56,42 +57,58 @@
 //! \{
 static void convertPayloadToRBSP(std::vector<uint8_t> &nalUnitBuf, InputBitstream *bitstream, bool isVclNalUnit)
 {
-  uint32_t zeroCount = 0;
-  std::vector<uint8_t>::iterator it_read, it_write;
+  uint8_t     *buf  = nalUnitBuf.data();
+  const size_t size = nalUnitBuf.size();
 
-  uint32_t pos = 0;
   bitstream->clearEmulationPreventionByteLocation();
-  for (it_read = it_write = nalUnitBuf.begin(); it_read != nalUnitBuf.end(); it_read++, it_write++, pos++)
+
+  // Only a pair of zero bytes can be followed by an emulation prevention byte. The pairs are located with memchr(),
+  // which is vectorised by the C library, and the bytes between two emulation prevention bytes are moved as a block.
+  size_t readPos  = 0;
+  size_t writePos = 0;
+  size_t scanPos  = 0;
+  while (scanPos + 1 < size)
   {
-    CHECK(zeroCount >= 2 && *it_read < 0x03, "Zero count is '2' and read value is small than '3'");
-    if (zeroCount == 2 && *it_read == 0x03)
+    const uint8_t *zero = (const uint8_t *) memchr(buf + scanPos, 0, size - 1 - scanPos);
+    if (zero == nullptr)
+    {
+      break;
+    }
+    const size_t zeroPos = zero - buf;
+    if (buf[zeroPos + 1] != 0)
+    {
+      scanPos = zeroPos + 2;
+      continue;
+    }
+
+    const size_t pos = zeroPos + 2;
+    CHECK(pos == size, "Zero count not '0'");
+    CHECK(buf[pos] < 0x03, "Zero count is '2' and read value is small than '3'");
+    if (buf[pos] == 0x03)
     {
-      bitstream->pushEmulationPreventionByteLocation( pos );
-      pos++;
-      it_read++;
-      zeroCount = 0;
+      bitstream->pushEmulationPreventionByteLocation((uint32_t) pos);
 #if RExt__DECODER_DEBUG_BIT_STATISTICS
       CodingStatistics::IncrementStatisticEP(STATS__EMULATION_PREVENTION_3_BYTES, 8, 0);
 #endif
-      if (it_read == nalUnitBuf.end())
-      {
-        break;
-      }
-      CHECK(*it_read > 0x03, "Read a value bigger than '3'");
+      CHECK(pos + 1 < size && buf[pos + 1] > 0x03, "Read a value bigger than '3'");
+      memmove(buf + writePos, buf + readPos, pos - readPos);
+      writePos += pos - readPos;
+      readPos = pos + 1;
     }
-    zeroCount = (*it_read == 0x00) ? zeroCount+1 : 0;
-    *it_write = *it_read;
+    scanPos = pos + 1;
   }
-  CHECK(zeroCount != 0, "Zero count not '0'");
+  CHECK(readPos < size && buf[size - 1] == 0x00, "Zero count not '0'");
+  memmove(buf + writePos, buf + readPos, size - readPos);
+  writePos += size - readPos;
 
   if (isVclNalUnit)
   {
     // Remove cabac_zero_word from payload if present
     int n = 0;
 
-    while (it_write[-1] == 0x00)
+    while (buf[writePos - 1] == 0x00)
     {
-      it_write--;
+      writePos--;
       n++;
     }
 
@@ -101,7 +118,7 @@ static void convertPayloadToRBSP(std::vector<uint8_t> &nalUnitBuf, InputBitstrea
     }
   }
 
-  nalUnitBuf.resize(it_write - nalUnitBuf.begin());
+  nalUnitBuf.resize(writePos);
 }
 
 #if ENABLE_TRACING
@@ -3529,6 +3529,38 @@ void  HLSyntaxReader::checkAlfNaluTidAndPicTid(Slice* pcSlice, PicHeader* picHea
   }
 }
 
+int HLSyntaxReader::xDerivePoc(PicHeader* picHeader, const SPS* sps, const int pocLsb, const bool idrPicFlag, const int prevTid0POC)
+{
+  const int maxPocLsb = 1 << sps->getBitsForPOC();
+  int       pocMsb;
+  if (picHeader->getPocMsbPresentFlag())
+  {
+    pocMsb = picHeader->getPocMsbVal() * maxPocLsb;
+  }
+  else if (idrPicFlag)
+  {
+    pocMsb = 0;
+  }
+  else
+  {
+    const int prevPocLsb = prevTid0POC & (maxPocLsb - 1);
+    const int prevPocMsb = prevTid0POC - prevPocLsb;
+    if ((pocLsb < prevPocLsb) && ((prevPocLsb - pocLsb) >= (maxPocLsb / 2)))
+    {
+      pocMsb = prevPocMsb + maxPocLsb;
+    }
+    else if ((pocLsb > prevPocLsb) && ((pocLsb - prevPocLsb) > (maxPocLsb / 2)))
+    {
+      pocMsb = prevPocMsb - maxPocLsb;
+    }
+    else
+    {
+      pocMsb = prevPocMsb;
+    }
+  }
+  return pocMsb + pocLsb;
+}
+
 void HLSyntaxReader::parseSliceHeader (Slice* pcSlice, PicHeader* picHeader, ParameterSetManager *parameterSetManager, const int prevTid0POC, const int prevPicPOC)
 {
   uint32_t  uiCode;
@@ -3584,48 +3616,7 @@ void HLSyntaxReader::parseSliceHeader (Slice* pcSlice, PicHeader* picHeader, Par
   const bool         hasChroma    = isChromaEnabled(chFmt);
 
   // picture order count
-  uiCode = picHeader->getPocLsb();
-  int pocLsb    = uiCode;
-  int maxPocLsb = 1 << sps->getBitsForPOC();
-  int pocMsb;
-  if (pcSlice->getIdrPicFlag())
-  {
-    if (picHeader->getPocMsbPresentFlag())
-    {
-      pocMsb = picHeader->getPocMsbVal() * maxPocLsb;
-    }
-    else
-    {
-      pocMsb = 0;
-    }
-    pcSlice->setPOC(pocMsb + pocLsb);
-  }
-  else
-  {
-    int prevPoc    = prevTid0POC;
-    int prevPocLsb = prevPoc & (maxPocLsb - 1);
-    int prevPocMsb = prevPoc - prevPocLsb;
-    if (picHeader->getPocMsbPresentFlag())
-    {
-      pocMsb = picHeader->getPocMsbVal() * maxPocLsb;
-    }
-    else
-    {
-      if ((pocLsb < prevPocLsb) && ((prevPocLsb - pocLsb) >= (maxPocLsb / 2)))
-      {
-        pocMsb = prevPocMsb + maxPocLsb;
-      }
-      else if ((pocLsb > prevPocLsb) && ((pocLsb - prevPocLsb) > (maxPocLsb / 2)))
-      {
-        pocMsb = prevPocMsb - maxPocLsb;
-      }
-      else
-      {
-        pocMsb = prevPocMsb;
-      }
-    }
-    pcSlice->setPOC(pocMsb + pocLsb);
-  }
+  pcSlice->setPOC(xDerivePoc(picHeader, sps, picHeader->getPocLsb(), pcSlice->getIdrPicFlag(), prevTid0POC));
 
   if (sps->getSubPicInfoPresentFlag())
   {
@@ -4483,47 +4474,71 @@ void HLSyntaxReader::getSlicePoc(Slice* pcSlice, PicHeader* picHeader, Parameter
     // picture order count
     xReadCode(sps->getBitsForPOC(), pocLsb, "ph_pic_order_cnt_lsb");
   }
-  int maxPocLsb = 1 << sps->getBitsForPOC();
-  int pocMsb;
-  if (pcSlice->getIdrPicFlag())
+  pcSlice->setPOC(xDerivePoc(picHeader, sps, pocLsb, pcSlice->getIdrPicFlag(), prevTid0POC));
+  DTRACE_UPDATE( g_trace_ctx, std::make_pair( "final", 1 ) );
+}
+
+void HLSyntaxReader::probePictureHeader(PicHeaderProbe& probe, ParameterSetManager *parameterSetManager)
+{
+  uint32_t uiCode;
+  uint32_t phGdrOrIrapPicFlag;
+
+  xReadFlag(phGdrOrIrapPicFlag, "ph_gdr_or_irap_pic_flag");
+  xReadFlag(uiCode, "ph_non_ref_pic_flag");
+  if (phGdrOrIrapPicFlag)
+  {
+    xReadFlag(uiCode, "ph_gdr_pic_flag");
+  }
+  xReadFlag(uiCode, "ph_inter_slice_allowed_flag");
+  if (uiCode)
   {
-    if (picHeader->getPocMsbPresentFlag())
-    {
-      pocMsb = picHeader->getPocMsbVal()*maxPocLsb;
-    }
-    else
-    {
-      pocMsb = 0;
-    }
-    pcSlice->setPOC(pocMsb + pocLsb);
+    xReadFlag(uiCode, "ph_intra_slice_allowed_flag");
   }
-  else
+  // parameter sets
+  xReadUvlc(uiCode, "ph_pic_parameter_set_id");
+  probe.ppsId = uiCode;
+  const PPS *pps = parameterSetManager->getPPS(probe.ppsId);
+  CHECK(pps == nullptr, "Invalid PPS");
+  const SPS *sps = parameterSetManager->getSPS(pps->getSPSId());
+  CHECK(sps == nullptr, "Invalid SPS");
+  // picture order count
+  probe.pocLsbBitPos = m_pcBitstream->getNumBitsRead();
+  xReadCode(sps->getBitsForPOC(), probe.pocLsb, "ph_pic_order_cnt_lsb");
+}
+
+void HLSyntaxReader::probeSliceHeader(SliceHeaderProbe& probe, NalUnitType nalUnitType, PicHeader* picHeader, ParameterSetManager *parameterSetManager, const int prevTid0POC)
+{
+  uint32_t uiCode;
+
+  xReadFlag(uiCode, "sh_picture_header_in_slice_header_flag");
+  probe.picHeaderInSliceHeader = uiCode != 0;
+  if (probe.picHeaderInSliceHeader)
   {
-    int prevPoc = prevTid0POC;
-    int prevPocLsb = prevPoc & (maxPocLsb - 1);
-    int prevPocMsb = prevPoc - prevPocLsb;
-    if (picHeader->getPocMsbPresentFlag())
-    {
-      pocMsb = picHeader->getPocMsbVal()*maxPocLsb;
-    }
-    else
-    {
-      if ((pocLsb < prevPocLsb) && ((prevPocLsb - pocLsb) >= (maxPocLsb / 2)))
-      {
-        pocMsb = prevPocMsb + maxPocLsb;
-      }
-      else if ((pocLsb > prevPocLsb) && ((pocLsb - prevPocLsb) > (maxPocLsb / 2)))
-      {
-        pocMsb = prevPocMsb - maxPocLsb;
-      }
-      else
-      {
-        pocMsb = prevPocMsb;
-      }
-    }
-    pcSlice->setPOC(pocMsb + pocLsb);
+    // the remaining slice header fields follow the complete picture header
+    probePictureHeader(probe.picHeader, parameterSetManager);
+    return;
+  }
+  if (picHeader == nullptr)
+  {
+    // caller is only interested in the picture header location
+    return;
+  }
+
+  CHECK(picHeader->isValid()==false, "Invalid Picture Header");
+  const PPS *pps = parameterSetManager->getPPS(picHeader->getPPSId());
+  CHECK(pps == nullptr, "Invalid PPS");
+  const SPS *sps = parameterSetManager->getSPS(pps->getSPSId());
+  CHECK(sps == nullptr, "Invalid SPS");
+
+  // picture order count
+  const bool idrPicFlag = nalUnitType == NAL_UNIT_CODED_SLICE_IDR_W_RADL || nalUnitType == NAL_UNIT_CODED_SLICE_IDR_N_LP;
+  probe.poc = xDerivePoc(picHeader, sps, picHeader->getPocLsb(), idrPicFlag, prevTid0POC);
+
+  probe.subPicId = 0;
+  if (sps->getSubPicInfoPresentFlag())
+  {
+    xReadCode(sps->getSubPicIdLen(), probe.subPicId, "sh_subpic_id");
   }
-  DTRACE_UPDATE( g_trace_ctx, std::make_pair( "final", 1 ) );
 }
 
 void HLSyntaxReader::parseConstraintInfo(ConstraintInfo *cinfo, const ProfileTierLevel* ptl )
@@ -96,6 +96,23 @@ public:
 
 
 
+/// leading picture header fields, read without building a PicHeader
+struct PicHeaderProbe
+{
+  int      ppsId        = -1;
+  uint32_t pocLsb       = 0;
+  uint32_t pocLsbBitPos = 0;   ///< position of ph_pic_order_cnt_lsb in the NAL unit, in bits
+};
+
+/// slice header fields used by the stream tools for routing, read without building a Slice
+struct SliceHeaderProbe
+{
+  bool           picHeaderInSliceHeader = false;
+  PicHeaderProbe picHeader;                ///< only valid with picHeaderInSliceHeader
+  int            poc      = 0;             ///< only valid without picHeaderInSliceHeader, when a picture header is given
+  uint32_t       subPicId = 0;             ///< only valid without picHeaderInSliceHeader, when a picture header is given
+};
+
 class HLSyntaxReader : public VLCReader
 {
 public:
@@ -105,6 +122,7 @@ public:
 protected:
   void  copyRefPicList(SPS* pcSPS, ReferencePictureList* sourceRpl, ReferencePictureList* dest_rpl);
   void  parseRefPicList(SPS* pcSPS, ReferencePictureList* rpl, int rplIdx);
+  static int xDerivePoc(PicHeader* picHeader, const SPS* sps, const int pocLsb, const bool idrPicFlag, const int prevTid0POC);
 
 public:
   void  setBitstream        ( InputBitstream* p )   { m_pcBitstream = p; }
@@ -126,6 +144,8 @@ public:
   void  checkAlfNaluTidAndPicTid(Slice* pcSlice, PicHeader* picHeader, ParameterSetManager *parameterSetManager);
   void  parseSliceHeader    ( Slice* pcSlice, PicHeader* picHeader, ParameterSetManager *parameterSetManager, const int prevTid0POC, const int prevPicPOC );
   void  getSlicePoc ( Slice* pcSlice, PicHeader* picHeader, ParameterSetManager *parameterSetManager, const int prevTid0POC );
+  void  probePictureHeader  ( PicHeaderProbe& probe, ParameterSetManager *parameterSetManager );
+  void  probeSliceHeader    ( SliceHeaderProbe& probe, NalUnitType nalUnitType, PicHeader* picHeader, ParameterSetManager *parameterSetManager, const int prevTid0POC );
   void  parseTerminatingBit(uint32_t& bit);
   void  parseRemainingBytes ( bool noTrailingBytesExpected );
 
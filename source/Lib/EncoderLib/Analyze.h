@@ -116,7 +116,7 @@ public:
   TExt360EncAnalyze& getExt360Info() { return m_ext360; }
 #endif
 #if JVET_O0756_CALCULATE_HDRMETRICS
-  void addHDRMetricsResult(double deltaE[hdrtoolslib::NB_REF_WHITE], double psnrL[hdrtoolslib::NB_REF_WHITE])
+  void addHDRMetricsResult(const double deltaE[hdrtoolslib::NB_REF_WHITE], const double psnrL[hdrtoolslib::NB_REF_WHITE])
   {
     for (int i=0; i<hdrtoolslib::NB_REF_WHITE; i++)
     {
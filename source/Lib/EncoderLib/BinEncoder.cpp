@@ -87,14 +87,15 @@ void BinEncoderBase::start()
   m_range             = 510;
   m_bufferedByte      = 0xff;
   m_numBufferedBytes  = 0;
-  m_bitsLeft          = 23;
+  m_bitsLeft          = LOW_BITS - 9;
   BinCounter::reset();
   m_binStore.reset();
 }
 
 void BinEncoderBase::finish()
 {
-  if (m_low >> (32 - m_bitsLeft))
+  writeOut();
+  if (m_low >> (LOW_BITS - m_bitsLeft))
   {
     m_bitstream->write(m_bufferedByte + 1, 8);
     while( m_numBufferedBytes > 1 )
@@ -102,7 +103,7 @@ void BinEncoderBase::finish()
       m_bitstream->write(0x00, 8);
       m_numBufferedBytes--;
     }
-    m_low -= 1 << (32 - m_bitsLeft);
+    m_low -= uint64_t(1) << (LOW_BITS - m_bitsLeft);
   }
   else
   {
@@ -116,7 +117,7 @@ void BinEncoderBase::finish()
       m_numBufferedBytes--;
     }
   }
-  m_bitstream->write(m_low >> 8, 24 - m_bitsLeft);
+  m_bitstream->write(uint32_t(m_low >> 8), LOW_BITS - 8 - m_bitsLeft);
 }
 
 void BinEncoderBase::restart()
@@ -125,7 +126,7 @@ void BinEncoderBase::restart()
   m_range             = 510;
   m_bufferedByte      = 0xff;
   m_numBufferedBytes  = 0;
-  m_bitsLeft          = 23;
+  m_bitsLeft          = LOW_BITS - 9;
 }
 
 void BinEncoderBase::reset( int qp, int initId )
@@ -139,7 +140,7 @@ void BinEncoderBase::resetBits()
   m_low               = 0;
   m_bufferedByte      = 0xff;
   m_numBufferedBytes  = 0;
-  m_bitsLeft          = 23;
+  m_bitsLeft          = LOW_BITS - 9;
   BinCounter::reset();
 }
 
@@ -174,21 +175,13 @@ void BinEncoderBase::encodeBinsEP( unsigned bins, unsigned numBins )
     encodeAlignedBinsEP( bins, numBins );
     return;
   }
-  while( numBins > 8 )
+  // all bins are added to the register at once, after writing out whole bytes if there is not enough room
+  CHECKD(numBins > 32, "Too many bins");
+  if (m_bitsLeft < int32_t(numBins) + 12)
   {
-    numBins          -= 8;
-    unsigned pattern  = bins >> numBins;
-    m_low <<= 8;
-    m_low += m_range * pattern;
-    bins             -= pattern << numBins;
-    m_bitsLeft       -= 8;
-    if( m_bitsLeft < 12 )
-    {
-      writeOut();
-    }
+    writeOut();
   }
-  m_low <<= numBins;
-  m_low += m_range * bins;
+  m_low = (m_low << numBins) + uint64_t(m_range) * bins;
   m_bitsLeft -= numBins;
   if( m_bitsLeft < 12 )
   {
@@ -203,8 +196,15 @@ void BinEncoderBase::encodeRemAbsEP(unsigned bins, unsigned goRicePar, unsigned
   {
     const unsigned bitMask = (1 << goRicePar) - 1;
     const unsigned length = (bins >> goRicePar) + 1;
-    encodeBinsEP((1 << length) - 2, length);
-    encodeBinsEP(bins & bitMask, goRicePar);
+    if (length + goRicePar <= 32)
+    {
+      encodeBinsEP(unsigned(((uint64_t(1) << length) - 2) << goRicePar) | (bins & bitMask), length + goRicePar);
+    }
+    else
+    {
+      encodeBinsEP((1 << length) - 2, length);
+      encodeBinsEP(bins & bitMask, goRicePar);
+    }
   }
   else
   {
@@ -229,8 +229,15 @@ void BinEncoderBase::encodeRemAbsEP(unsigned bins, unsigned goRicePar, unsigned
     const unsigned bitMask = (1 << goRicePar) - 1;
     const unsigned prefix = (1 << totalPrefixLength) - 1;
     const unsigned suffix = ((codeValue - ((1 << prefixLength) - 1)) << goRicePar) | (bins & bitMask);
-    encodeBinsEP(prefix, totalPrefixLength); //prefix
-    encodeBinsEP(suffix, suffixLength); //separator, suffix, and rParam bits
+    if (totalPrefixLength + suffixLength <= 32)
+    {
+      encodeBinsEP(unsigned((uint64_t(prefix) << suffixLength) | suffix), totalPrefixLength + suffixLength);
+    }
+    else
+    {
+      encodeBinsEP(prefix, totalPrefixLength); //prefix
+      encodeBinsEP(suffix, suffixLength); //separator, suffix, and rParam bits
+    }
   }
 }
 
@@ -270,65 +277,67 @@ void BinEncoderBase::align()
 
 void BinEncoderBase::encodeAlignedBinsEP( unsigned bins, unsigned numBins )
 {
-  unsigned remBins = numBins;
-  while( remBins > 0 )
+  //The process of encoding an EP bin is the same as that of coding a normal
+  //bin where the symbol ranges for 1 and 0 are both half the range:
+  //
+  //  low = (low + range/2) << 1       (to encode a 1)
+  //  low =  low            << 1       (to encode a 0)
+  //
+  //  i.e.
+  //  low = (low + (bin * range/2)) << 1
+  //
+  //  which is equivalent to:
+  //
+  //  low = (low << 1) + (bin * range)
+  //
+  //  this can be generalised for multiple bins, producing the following expression:
+  //
+  CHECKD(numBins > 32, "Too many bins");
+  if (m_bitsLeft < int32_t(numBins) + 12)
   {
-    //The process of encoding an EP bin is the same as that of coding a normal
-    //bin where the symbol ranges for 1 and 0 are both half the range:
-    //
-    //  low = (low + range/2) << 1       (to encode a 1)
-    //  low =  low            << 1       (to encode a 0)
-    //
-    //  i.e.
-    //  low = (low + (bin * range/2)) << 1
-    //
-    //  which is equivalent to:
-    //
-    //  low = (low << 1) + (bin * range)
-    //
-    //  this can be generalised for multiple bins, producing the following expression:
-    //
-    unsigned binsToCode = std::min<unsigned>( remBins, 8); //code bytes if able to take advantage of the system's byte-write function
-    unsigned binMask    = ( 1 << binsToCode ) - 1;
-    unsigned newBins    = ( bins >> ( remBins - binsToCode ) ) & binMask;
-    m_low               = (m_low << binsToCode) + (newBins << 8);   // range is known to be 256
-    remBins            -= binsToCode;
-    m_bitsLeft         -= binsToCode;
-    if( m_bitsLeft < 12 )
-    {
-      writeOut();
-    }
+    writeOut();
+  }
+  m_low = (m_low << numBins) + (uint64_t(bins) << 8);   // range is known to be 256
+  m_bitsLeft -= numBins;
+  if( m_bitsLeft < 12 )
+  {
+    writeOut();
   }
 }
 
 void BinEncoderBase::writeOut()
 {
-  unsigned leadByte = m_low >> (24 - m_bitsLeft);
-  m_bitsLeft       += 8;
-  m_low &= 0xffffffffu >> m_bitsLeft;
-  if( leadByte == 0xff )
+  // the carry into bytes equal to 0xff is resolved when the next byte that is not 0xff is written out, so whole bytes
+  // can be written out until 20 bits are left in the register
+  while (m_bitsLeft < LOW_BITS - 20)
   {
-    m_numBufferedBytes++;
-  }
-  else
-  {
-    if( m_numBufferedBytes > 0 )
+    const unsigned leadByte = unsigned(m_low >> (LOW_BITS - 8 - m_bitsLeft));
+    m_bitsLeft += 8;
+    m_low &= ~uint64_t(0) >> m_bitsLeft;
+    if (leadByte == 0xff)
     {
-      unsigned carry  = leadByte >> 8;
-      unsigned byte   = m_bufferedByte + carry;
-      m_bufferedByte  = leadByte & 0xff;
-      m_bitstream->write(byte, 8);
-      byte            = ( 0xff + carry ) & 0xff;
-      while( m_numBufferedBytes > 1 )
-      {
-        m_bitstream->write(byte, 8);
-        m_numBufferedBytes--;
-      }
+      m_numBufferedBytes++;
     }
     else
     {
-      m_numBufferedBytes  = 1;
-      m_bufferedByte      = leadByte;
+      if (m_numBufferedBytes > 0)
+      {
+        unsigned carry = leadByte >> 8;
+        unsigned byte  = m_bufferedByte + carry;
+        m_bufferedByte = leadByte & 0xff;
+        m_bitstream->writeByte(byte);
+        byte = (0xff + carry) & 0xff;
+        while (m_numBufferedBytes > 1)
+        {
+          m_bitstream->writeByte(byte);
+          m_numBufferedBytes--;
+        }
+      }
+      else
+      {
+        m_numBufferedBytes = 1;
+        m_bufferedByte     = leadByte;
+      }
     }
   }
 }
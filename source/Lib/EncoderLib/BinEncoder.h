@@ -189,7 +189,7 @@ public:
   void      align               ();
   unsigned  getNumWrittenBits()
   {
-    return (m_bitstream->getNumberOfWrittenBits() + 8 * m_numBufferedBytes + 23 - m_bitsLeft);
+    return (m_bitstream->getNumberOfWrittenBits() + 8 * m_numBufferedBytes + LOW_BITS - 9 - m_bitsLeft);
   }
 
 public:
@@ -199,8 +199,11 @@ protected:
   void      encodeAlignedBinsEP ( unsigned bins,  unsigned numBins  );
   void      writeOut            ();
 protected:
+  // m_low is a 64-bit register, whole bytes are written out only when fewer than 12 of its bits are free
+  static const int32_t    LOW_BITS = 64;
+
   OutputBitstream        *m_bitstream;
-  uint32_t                m_low;
+  uint64_t                m_low;
   uint32_t                m_range;
   uint32_t                m_bufferedByte;
   int32_t                 m_numBufferedBytes;
@@ -277,7 +280,7 @@ protected:
 
 
 template <class BinProbModel>
-class TBitEstimator : public BitEstimatorBase
+class TBitEstimator final : public BitEstimatorBase
 {
 public:
   TBitEstimator ();
@@ -2586,8 +2586,7 @@ void CABACWriter::joint_cb_cr( const TransformUnit& tu, const int cbfMask )
 
 void CABACWriter::residual_coding( const TransformUnit& tu, ComponentID compID, CUCtx* cuCtx )
 {
-  const CodingUnit& cu = *tu.cu;
-  DTRACE( g_trace_ctx, D_SYNTAX, "residual_coding() etype=%d pos=(%d,%d) size=%dx%d predMode=%d\n", tu.blocks[compID].compID, tu.blocks[compID].x, tu.blocks[compID].y, tu.blocks[compID].width, tu.blocks[compID].height, cu.predMode );
+  DTRACE( g_trace_ctx, D_SYNTAX, "residual_coding() etype=%d pos=(%d,%d) size=%dx%d predMode=%d\n", tu.blocks[compID].compID, tu.blocks[compID].x, tu.blocks[compID].y, tu.blocks[compID].width, tu.blocks[compID].height, tu.cu->predMode );
 
   if( compID == COMPONENT_Cr && tu.jointCbCr == 3 )
   {
@@ -2596,9 +2595,26 @@ void CABACWriter::residual_coding( const TransformUnit& tu, ComponentID compID,
 
   ts_flag            ( tu, compID );
 
+  if (isEncoding())
+  {
+    xResidualCoding(m_binEncoder, tu, compID, cuCtx);
+  }
+  else
+  {
+    // rate estimation: the estimator type is known, so the per-bin calls are resolved at compile time
+    CHECKD(dynamic_cast<BitEstimator_Std *>(&m_binEncoder) == nullptr, "Unexpected bit estimator type");
+    xResidualCoding(static_cast<BitEstimator_Std &>(m_binEncoder), tu, compID, cuCtx);
+  }
+}
+
+template <class BinEnc>
+void CABACWriter::xResidualCoding(BinEnc &binEnc, const TransformUnit &tu, ComponentID compID, CUCtx *cuCtx)
+{
+  const CodingUnit& cu = *tu.cu;
+
   if (tu.mtsIdx[compID] == MtsType::SKIP && !tu.cs->slice->getTSResidualCodingDisabledFlag())
   {
-    residual_codingTS( tu, compID );
+    xResidualCodingTS(binEnc, tu, compID);
     return;
   }
 
@@ -2641,7 +2657,7 @@ void CABACWriter::residual_coding( const TransformUnit& tu, ComponentID compID,
 
 
   // code last coeff position
-  last_sig_coeff( cctx, tu, compID );
+  xLastSigCoeff(binEnc, cctx, tu, compID);
 
   // code subblocks
   const int stateTab = ( tu.cs->slice->getDepQuantEnabledFlag() ? 32040 : 0 );
@@ -2650,12 +2666,12 @@ void CABACWriter::residual_coding( const TransformUnit& tu, ComponentID compID,
   int ctxBinSampleRatio = (compID == COMPONENT_Y) ? MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_LUMA : MAX_TU_LEVEL_CTX_CODED_BIN_CONSTRAINT_CHROMA;
   cctx.regBinLimit = (tu.getTbAreaAfterCoefZeroOut(compID) * ctxBinSampleRatio) >> 4;
 
-  int baseLevel = m_binEncoder.getCtx().getBaseLevel();
+  int baseLevel = binEnc.getCtx().getBaseLevel();
   cctx.setBaseLevel(baseLevel);
   if (tu.cs->slice->getSPS()->getSpsRangeExtension().getPersistentRiceAdaptationEnabledFlag())
   {
     cctx.setUpdateHist(1);
-    unsigned riceStats    = m_binEncoder.getCtx().getGRAdaptStats((unsigned) compID);
+    unsigned riceStats    = binEnc.getCtx().getGRAdaptStats((unsigned) compID);
     TCoeff historyValue = (TCoeff)1 << riceStats;
     cctx.setHistValue(historyValue);
   }
@@ -2672,7 +2688,7 @@ void CABACWriter::residual_coding( const TransformUnit& tu, ComponentID compID,
         continue;
       }
     }
-    residual_coding_subblock( cctx, coeff, stateTab, state );
+    xResidualCodingSubblock(binEnc, cctx, coeff, stateTab, state);
 
     if ( cuCtx && isLuma(compID) && cctx.isSigGroup() && ( cctx.cgPosY() > 3 || cctx.cgPosX() > 3 ) )
     {
@@ -2808,6 +2824,12 @@ void CABACWriter::residual_lfnst_mode( const CodingUnit& cu, CUCtx& cuCtx )
 }
 
 void CABACWriter::last_sig_coeff( CoeffCodingContext& cctx, const TransformUnit& tu, ComponentID compID )
+{
+  xLastSigCoeff(m_binEncoder, cctx, tu, compID);
+}
+
+template <class BinEnc>
+void CABACWriter::xLastSigCoeff(BinEnc &binEnc, CoeffCodingContext &cctx, const TransformUnit &tu, ComponentID compID)
 {
   unsigned blkPos = cctx.blockPos( cctx.scanPosLast() );
   unsigned posX, posY;
@@ -2834,7 +2856,7 @@ void CABACWriter::last_sig_coeff( CoeffCodingContext& cctx, const TransformUnit&
     zoTbWdith = (tu.blocks[compID].width == 32) ? 16 : zoTbWdith;
     zoTbHeight = (tu.blocks[compID].height == 32) ? 16 : zoTbHeight;
   }
-  if (isEncoding())
+  if (binEnc.isEncoding())
   {
     if ((posX + posY) > ((zoTbWdith + zoTbHeight + 2) / 2))
     {
@@ -2856,26 +2878,26 @@ void CABACWriter::last_sig_coeff( CoeffCodingContext& cctx, const TransformUnit&
 
   for( CtxLast = 0; CtxLast < GroupIdxX; CtxLast++ )
   {
-    m_binEncoder.encodeBin(1, cctx.lastXCtxId(CtxLast));
+    binEnc.encodeBin(1, cctx.lastXCtxId(CtxLast));
   }
   if( GroupIdxX < maxLastPosX )
   {
-    m_binEncoder.encodeBin(0, cctx.lastXCtxId(CtxLast));
+    binEnc.encodeBin(0, cctx.lastXCtxId(CtxLast));
   }
   for( CtxLast = 0; CtxLast < GroupIdxY; CtxLast++ )
   {
-    m_binEncoder.encodeBin(1, cctx.lastYCtxId(CtxLast));
+    binEnc.encodeBin(1, cctx.lastYCtxId(CtxLast));
   }
   if( GroupIdxY < maxLastPosY )
   {
-    m_binEncoder.encodeBin(0, cctx.lastYCtxId(CtxLast));
+    binEnc.encodeBin(0, cctx.lastYCtxId(CtxLast));
   }
   if( GroupIdxX > 3 )
   {
     posX -= g_minInGroup[GroupIdxX];
     for (int i = ( ( GroupIdxX - 2 ) >> 1 ) - 1 ; i >= 0; i-- )
     {
-      m_binEncoder.encodeBinEP((posX >> i) & 1);
+      binEnc.encodeBinEP((posX >> i) & 1);
     }
   }
   if( GroupIdxY > 3 )
@@ -2883,12 +2905,19 @@ void CABACWriter::last_sig_coeff( CoeffCodingContext& cctx, const TransformUnit&
     posY -= g_minInGroup[GroupIdxY];
     for ( int i = ( ( GroupIdxY - 2 ) >> 1 ) - 1 ; i >= 0; i-- )
     {
-      m_binEncoder.encodeBinEP((posY >> i) & 1);
+      binEnc.encodeBinEP((posY >> i) & 1);
     }
   }
 }
 
 void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoeff* coeff, const int stateTransTable, int& state )
+{
+  xResidualCodingSubblock(m_binEncoder, cctx, coeff, stateTransTable, state);
+}
+
+template <class BinEnc>
+void CABACWriter::xResidualCodingSubblock(BinEnc &binEnc, CoeffCodingContext &cctx, const TCoeff *coeff,
+                                          const int stateTransTable, int &state)
 {
   //===== init =====
   const int   minSubPos   = cctx.minSubPos();
@@ -2903,11 +2932,11 @@ void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoe
   {
     if( cctx.isSigGroup() )
     {
-      m_binEncoder.encodeBin(1, cctx.sigGroupCtxId());
+      binEnc.encodeBin(1, cctx.sigGroupCtxId());
     }
     else
     {
-      m_binEncoder.encodeBin(0, cctx.sigGroupCtxId());
+      binEnc.encodeBin(0, cctx.sigGroupCtxId());
       return;
     }
   }
@@ -2930,7 +2959,7 @@ void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoe
     if( numNonZero || nextSigPos != inferSigPos )
     {
       const unsigned sigCtxId = cctx.sigCtxIdAbs( nextSigPos, coeff, state );
-      m_binEncoder.encodeBin(sigFlag, sigCtxId);
+      binEnc.encodeBin(sigFlag, sigCtxId);
       DTRACE( g_trace_ctx, D_SYNTAX_RESI, "sig_bin() bin=%d ctx=%d\n", sigFlag, sigCtxId );
       remRegBins--;
     }
@@ -2958,18 +2987,18 @@ void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoe
       }
 
       const bool gt1 = absLevel > 1;
-      m_binEncoder.encodeBin( gt1, cctx.greater1CtxIdAbs(ctxOff) );
+      binEnc.encodeBin( gt1, cctx.greater1CtxIdAbs(ctxOff) );
       DTRACE( g_trace_ctx, D_SYNTAX_RESI, "gt1_flag() bin=%d ctx=%d\n", gt1, cctx.greater1CtxIdAbs(ctxOff) );
       remRegBins--;
 
       if( gt1 )
       {
-        m_binEncoder.encodeBin(absLevel & 1, cctx.parityCtxIdAbs(ctxOff));
+        binEnc.encodeBin(absLevel & 1, cctx.parityCtxIdAbs(ctxOff));
         DTRACE(g_trace_ctx, D_SYNTAX_RESI, "par_flag() bin=%d ctx=%d\n", absLevel & 1, cctx.parityCtxIdAbs(ctxOff));
 
         remRegBins--;
         const bool gt2 = absLevel > 3;
-        m_binEncoder.encodeBin(gt2, cctx.greater2CtxIdAbs(ctxOff));
+        binEnc.encodeBin(gt2, cctx.greater2CtxIdAbs(ctxOff));
         DTRACE(g_trace_ctx, D_SYNTAX_RESI, "gt2_flag() bin=%d ctx=%d\n", gt2, cctx.greater2CtxIdAbs(ctxOff));
         remRegBins--;
 
@@ -2995,11 +3024,11 @@ void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoe
       const unsigned ricePar = (cctx.*(cctx.deriveRiceRRC))(scanPos, coeff, baseLevel);
 
       unsigned rem      = ( absLevel - 4 ) >> 1;
-      m_binEncoder.encodeRemAbsEP(rem, ricePar, COEF_REMAIN_BIN_REDUCTION, cctx.maxLog2TrDRange());
+      binEnc.encodeRemAbsEP(rem, ricePar, COEF_REMAIN_BIN_REDUCTION, cctx.maxLog2TrDRange());
       DTRACE( g_trace_ctx, D_SYNTAX_RESI, "rem_val() bin=%d ctx=%d\n", rem, ricePar );
       if ((updateHistory) && (rem > 0))
       {
-        unsigned &riceStats = m_binEncoder.getCtx().getGRAdaptStats((unsigned) (cctx.compID()));
+        unsigned &riceStats = binEnc.getCtx().getGRAdaptStats((unsigned) (cctx.compID()));
         cctx.updateRiceStat(riceStats, rem, 1);
         cctx.setUpdateHist(0);
         updateHistory = 0;
@@ -3015,12 +3044,12 @@ void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoe
     int rice = (cctx.*(cctx.deriveRiceRRC))(scanPos, coeff, 0);
     int         pos0      = g_goRicePosCoeff0(state, rice);
     unsigned  rem       = ( absLevel == 0 ? pos0 : absLevel <= pos0 ? absLevel-1 : absLevel );
-    m_binEncoder.encodeRemAbsEP(rem, rice, COEF_REMAIN_BIN_REDUCTION, cctx.maxLog2TrDRange());
+    binEnc.encodeRemAbsEP(rem, rice, COEF_REMAIN_BIN_REDUCTION, cctx.maxLog2TrDRange());
     DTRACE( g_trace_ctx, D_SYNTAX_RESI, "rem_val() bin=%d ctx=%d\n", rem, rice );
     state = ( stateTransTable >> ((state<<2)+((absLevel&1)<<1)) ) & 3;
     if ((updateHistory) && (rem > 0))
     {
-      unsigned &riceStats = m_binEncoder.getCtx().getGRAdaptStats((unsigned) cctx.compID());
+      unsigned &riceStats = binEnc.getCtx().getGRAdaptStats((unsigned) cctx.compID());
       cctx.updateRiceStat(riceStats, rem, 0);
       cctx.setUpdateHist(0);
       updateHistory = 0;
@@ -3045,10 +3074,16 @@ void CABACWriter::residual_coding_subblock( CoeffCodingContext& cctx, const TCoe
     numSigns    --;
     signPattern >>= 1;
   }
-  m_binEncoder.encodeBinsEP(signPattern, numSigns);
+  binEnc.encodeBinsEP(signPattern, numSigns);
 }
 
 void CABACWriter::residual_codingTS( const TransformUnit& tu, ComponentID compID )
+{
+  xResidualCodingTS(m_binEncoder, tu, compID);
+}
+
+template <class BinEnc>
+void CABACWriter::xResidualCodingTS(BinEnc &binEnc, const TransformUnit &tu, ComponentID compID)
 {
   DTRACE( g_trace_ctx, D_SYNTAX, "residual_codingTS() etype=%d pos=(%d,%d) size=%dx%d\n", tu.blocks[compID].compID, tu.blocks[compID].x, tu.blocks[compID].y, tu.blocks[compID].width, tu.blocks[compID].height );
 
@@ -3079,7 +3114,7 @@ void CABACWriter::residual_codingTS( const TransformUnit& tu, ComponentID compID
     if (tu.cu->slice->getSPS()->getSpsRangeExtension().getTSRCRicePresentFlag() && tu.mtsIdx[compID] == MtsType::SKIP)
     {
       goRiceParam = goRiceParam + tu.cu->slice->getTsrcIndex();
-      if (isEncoding())
+      if (binEnc.isEncoding())
       {
         ricePresentFlag = true;
         for (int i = 0; i < MAX_TSRC_RICE; i++)
@@ -3088,9 +3123,9 @@ void CABACWriter::residual_codingTS( const TransformUnit& tu, ComponentID compID
         }
       }
     }
-    residual_coding_subblockTS( cctx, coeff, RiceBit, goRiceParam, ricePresentFlag);
+    xResidualCodingSubblockTS(binEnc, cctx, coeff, RiceBit, goRiceParam, ricePresentFlag);
     if (tu.cu->slice->getSPS()->getSpsRangeExtension().getTSRCRicePresentFlag() && tu.mtsIdx[compID] == MtsType::SKIP
-        && isEncoding())
+        && binEnc.isEncoding())
     {
       for (int i = 0; i < MAX_TSRC_RICE; i++)
       {
@@ -3102,6 +3137,13 @@ void CABACWriter::residual_codingTS( const TransformUnit& tu, ComponentID compID
 
 void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCoeff *coeff, unsigned (&RiceBit)[8],
                                              const int riceParam, bool ricePresentFlag)
+{
+  xResidualCodingSubblockTS(m_binEncoder, cctx, coeff, RiceBit, riceParam, ricePresentFlag);
+}
+
+template <class BinEnc>
+void CABACWriter::xResidualCodingSubblockTS(BinEnc &binEnc, CoeffCodingContext &cctx, const TCoeff *coeff,
+                                            unsigned (&RiceBit)[8], const int riceParam, bool ricePresentFlag)
 {
   //===== init =====
   const int   minSubPos   = cctx.maxSubPos();
@@ -3113,12 +3155,12 @@ void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCo
   {
     if( cctx.isSigGroup() )
     {
-      m_binEncoder.encodeBin(1, cctx.sigGroupCtxId(true));
+      binEnc.encodeBin(1, cctx.sigGroupCtxId(true));
       DTRACE(g_trace_ctx, D_SYNTAX_RESI, "ts_sigGroup() bin=%d ctx=%d\n", 1, cctx.sigGroupCtxId());
     }
     else
     {
-      m_binEncoder.encodeBin(0, cctx.sigGroupCtxId(true));
+      binEnc.encodeBin(0, cctx.sigGroupCtxId(true));
       DTRACE(g_trace_ctx, D_SYNTAX_RESI, "ts_sigGroup() bin=%d ctx=%d\n", 0, cctx.sigGroupCtxId());
       return;
     }
@@ -3140,7 +3182,7 @@ void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCo
     if( numNonZero || nextSigPos != inferSigPos )
     {
       const unsigned sigCtxId = cctx.sigCtxIdAbsTS(nextSigPos, coeff);
-      m_binEncoder.encodeBin(sigFlag, sigCtxId);
+      binEnc.encodeBin(sigFlag, sigCtxId);
       DTRACE(g_trace_ctx, D_SYNTAX_RESI, "ts_sig_bin() bin=%d ctx=%d\n", sigFlag, sigCtxId);
       cctx.decimateNumCtxBins(1);
     }
@@ -3150,7 +3192,7 @@ void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCo
       //===== encode sign's =====
       int            sign      = coeffVal < 0;
       const unsigned signCtxId = cctx.signCtxIdAbsTS(nextSigPos, coeff, cctx.bdpcm());
-      m_binEncoder.encodeBin(sign, signCtxId);
+      binEnc.encodeBin(sign, signCtxId);
       cctx.decimateNumCtxBins(1);
       numNonZero++;
       cctx.neighTS(rightPixel, belowPixel, nextSigPos, coeff);
@@ -3159,14 +3201,14 @@ void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCo
 
       unsigned gt1 = !!remAbsLevel;
       const unsigned gt1CtxId = cctx.lrg1CtxIdAbsTS(nextSigPos, coeff, cctx.bdpcm());
-      m_binEncoder.encodeBin(gt1, gt1CtxId);
+      binEnc.encodeBin(gt1, gt1CtxId);
       DTRACE(g_trace_ctx, D_SYNTAX_RESI, "ts_gt1_flag() bin=%d ctx=%d\n", gt1, gt1CtxId);
       cctx.decimateNumCtxBins(1);
 
       if( gt1 )
       {
         remAbsLevel  -= 1;
-        m_binEncoder.encodeBin(remAbsLevel & 1, cctx.parityCtxIdAbsTS());
+        binEnc.encodeBin(remAbsLevel & 1, cctx.parityCtxIdAbsTS());
         DTRACE(g_trace_ctx, D_SYNTAX_RESI, "ts_par_flag() bin=%d ctx=%d\n", remAbsLevel & 1, cctx.parityCtxIdAbsTS());
         cctx.decimateNumCtxBins(1);
       }
@@ -3188,7 +3230,7 @@ void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCo
       if (absLevel >= cutoffVal)
       {
         unsigned gt2 = (absLevel >= (cutoffVal + 2));
-        m_binEncoder.encodeBin(gt2, cctx.greaterXCtxIdAbsTS(cutoffVal >> 1));
+        binEnc.encodeBin(gt2, cctx.greaterXCtxIdAbsTS(cutoffVal >> 1));
         DTRACE(g_trace_ctx, D_SYNTAX_RESI, "ts_gt%d_flag() bin=%d ctx=%d sp=%d coeff=%d\n", i, gt2,
                cctx.greaterXCtxIdAbsTS(cutoffVal >> 1), scanPos, std::min<int>(absLevel, cutoffVal + 2));
         cctx.decimateNumCtxBins(1);
@@ -3210,9 +3252,9 @@ void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCo
     if( absLevel >= cutoffVal )
     {
       unsigned  rem = scanPos <= lastScanPosPass1 ? (absLevel - cutoffVal) >> 1 : absLevel;
-      m_binEncoder.encodeRemAbsEP(rem, riceParam, COEF_REMAIN_BIN_REDUCTION, cctx.maxLog2TrDRange());
+      binEnc.encodeRemAbsEP(rem, riceParam, COEF_REMAIN_BIN_REDUCTION, cctx.maxLog2TrDRange());
       DTRACE(g_trace_ctx, D_SYNTAX_RESI, "ts_rem_val() bin=%d ctx=%d sp=%d\n", rem, riceParam, scanPos);
-      if ( ricePresentFlag && (isEncoding()) && (cctx.compID() == COMPONENT_Y))
+      if ( ricePresentFlag && (binEnc.isEncoding()) && (cctx.compID() == COMPONENT_Y))
       {
         for (int idx = 1; idx < 9; idx++)
         {
@@ -3239,7 +3281,7 @@ void CABACWriter::residual_coding_subblockTS(CoeffCodingContext &cctx, const TCo
       if (absLevel && scanPos > lastScanPosPass1)
       {
         const int sign = coeff[cctx.blockPos(scanPos)] < 0 ? 1 : 0;
-        m_binEncoder.encodeBinEP(sign);
+        binEnc.encodeBinEP(sign);
       }
     }
   }
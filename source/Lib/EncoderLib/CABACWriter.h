@@ -184,6 +184,20 @@ private:
   void        xWriteTruncBinCode(uint32_t symbol, uint32_t numSymbols);
   void        codeScanRotationModeFlag   ( const CodingUnit& cu,     ComponentID compBegin);
   void        xEncodePLTPredIndicator    ( const CodingUnit& cu,     uint32_t    maxPltSize, ComponentID compBegin);
+
+  // residual coding, templated on the bin coder so that rate estimation calls the bit estimator directly
+  template <class BinEnc>
+  void xResidualCoding(BinEnc &binEnc, const TransformUnit &tu, ComponentID compID, CUCtx *cuCtx);
+  template <class BinEnc>
+  void xLastSigCoeff(BinEnc &binEnc, CoeffCodingContext &cctx, const TransformUnit &tu, ComponentID compID);
+  template <class BinEnc>
+  void xResidualCodingSubblock(BinEnc &binEnc, CoeffCodingContext &cctx, const TCoeff *coeff, const int stateTransTable,
+                               int &state);
+  template <class BinEnc>
+  void xResidualCodingTS(BinEnc &binEnc, const TransformUnit &tu, ComponentID compID);
+  template <class BinEnc>
+  void xResidualCodingSubblockTS(BinEnc &binEnc, CoeffCodingContext &cctx, const TCoeff *coeff, unsigned (&RiceBit)[8],
+                                 int riceParam, bool ricePresentFlag);
 private:
   BinEncIf         &m_binEncoder;
   OutputBitstream  *m_bitstream;
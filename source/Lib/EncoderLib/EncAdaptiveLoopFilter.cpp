@@ -617,6 +617,7 @@ void EncAdaptiveLoopFilter::create(const EncCfg* encCfg, const int picWidth, con
   m_buf                   = new PelBuf(m_bufOrigin, picWidth >> getComponentScaleX(COMPONENT_Cb, chromaFormatIdc),
                                        picWidth >> getComponentScaleX(COMPONENT_Cb, chromaFormatIdc),
                                        picHeight >> getComponentScaleY(COMPONENT_Cb, chromaFormatIdc));
+  m_covAcc.assign(MAX_NUM_ALF_CLASSES * COV_ACC_SIZE * COV_ACC_STRIDE, 0);
   m_lumaSwingGreaterThanThresholdCount = new uint64_t[m_numCTUsInPic];
   m_chromaSampleCountNearMidPoint = new uint64_t[m_numCTUsInPic];
 }
@@ -2333,6 +2334,70 @@ void EncAdaptiveLoopFilter::getBlkStats(AlfCovariance *alfCovariance, const AlfF
     isLuma(channel) ? m_encCfg->getALFStrengthTargetLuma() : m_encCfg->getALFStrengthTargetChroma();
   const double invStrength = strength != 0.0 ? 1.0 / strength : 0.0;
 
+  const int bitDepth = m_inputBitDepth[channel];
+
+  if (!m_alfWSSD && bitDepth <= COV_ACC_MAX_BITDEPTH)
+  {
+    // |ELocal| <= 2^(bitDepth+1), hence a product is bounded by 2^(2*bitDepth+2) and the 32-bit accumulators have to
+    // be flushed every 2^(28-2*bitDepth) samples
+    const int numCoeff      = shape.numCoeff;
+    const int size          = numBins * numCoeff + 1;
+    const int flushInterval = 1 << (28 - 2 * bitDepth);
+
+    int x[COV_ACC_STRIDE] = { 0 };
+    int count[MAX_NUM_ALF_CLASSES] = { 0 };
+
+    for (int i = 0; i < area.height; i++)
+    {
+      const int vbDistance = ((areaDst.y + i) % vbCTUHeight) - vbPos;
+      for (int j = 0; j < area.width; j++)
+      {
+        std::fill_n(ELocal[0], MAX_NUM_ALF_LUMA_COEFF * MAX_ALF_NUM_CLIP_VALS, 0);
+
+        int transposeIdx = 0;
+        int classIdx     = 0;
+        if (classifier)
+        {
+          AlfClassifier &cl = classifier[areaDst.y + i][areaDst.x + j];
+          transposeIdx      = cl.transposeIdx;
+          classIdx          = cl.classIdx;
+        }
+
+        calcCovariance(ELocal, rec + j, recStride, shape, transposeIdx, channel, vbDistance);
+
+        for (int b = 0; b < numBins; b++)
+        {
+          for (int k = 0; k < numCoeff; k++)
+          {
+            x[b * numCoeff + k] = ELocal[k][b];
+          }
+        }
+        x[size - 1] = org[j] - rec[j];
+
+        int *acc = &m_covAcc[classIdx * COV_ACC_SIZE * COV_ACC_STRIDE];
+        m_accumulateCovariance(x, size, acc, COV_ACC_STRIDE);
+
+        if (++count[classIdx] == flushInterval)
+        {
+          flushCovariance(alfCovariance[classIdx], acc, size, invStrength);
+          count[classIdx] = 0;
+        }
+      }
+      org += orgStride;
+      rec += recStride;
+    }
+
+    for (int classIdx = 0; classIdx < MAX_NUM_ALF_CLASSES; classIdx++)
+    {
+      if (count[classIdx] > 0)
+      {
+        flushCovariance(alfCovariance[classIdx], &m_covAcc[classIdx * COV_ACC_SIZE * COV_ACC_STRIDE], size,
+                        invStrength);
+      }
+    }
+    return;
+  }
+
   for( int i = 0; i < area.height; i++ )
   {
     const int vbDistance = ((areaDst.y + i) % vbCTUHeight) - vbPos;
@@ -2393,6 +2458,35 @@ void EncAdaptiveLoopFilter::getBlkStats(AlfCovariance *alfCovariance, const AlfF
   }
 }
 
+// Adds the integer statistics of acc, gathered for the vector (e, yLocal) with e of size - 1 entries, to
+// alfCovariance and clears acc
+void EncAdaptiveLoopFilter::flushCovariance(AlfCovariance &alfCovariance, int *acc, const int size,
+                                            const double invStrength)
+{
+  const int    n      = size - 1;
+  const double scaleE = invStrength * invStrength;
+
+  for (int r = 0; r < n; r++)
+  {
+    const int *row  = acc + r * COV_ACC_STRIDE;
+    double    *data = &alfCovariance.data[alfCovariance.offsetE + (r * (r + 1) >> 1)];
+
+    for (int c = 0; c <= r; c++)
+    {
+      data[c] += scaleE * row[c];
+    }
+  }
+
+  const int *rowY = acc + n * COV_ACC_STRIDE;
+  for (int c = 0; c < n; c++)
+  {
+    alfCovariance.data[c] += invStrength * rowY[c];
+  }
+  alfCovariance.pixAcc += rowY[n];
+
+  std::fill_n(acc, size * COV_ACC_STRIDE, 0);
+}
+
 void EncAdaptiveLoopFilter::calcCovariance(Pel ELocal[MAX_NUM_ALF_LUMA_COEFF][MAX_ALF_NUM_CLIP_VALS], const Pel *rec,
                                            const ptrdiff_t stride, const AlfFilterShape &shape, const int transposeIdx,
                                            const ChannelType channel, int vbDistance)
@@ -4154,6 +4248,14 @@ void EncAdaptiveLoopFilter::getBlkStatsCcAlf(AlfCovariance &alfCovariance, const
   const double strength    = m_encCfg->getCCALFStrengthTarget();
   const double invStrength = strength != 0.0 ? 1.0 / strength : 0.0;
 
+  const int  bitDepth      = std::max(m_inputBitDepth[ChannelType::LUMA], m_inputBitDepth[ChannelType::CHROMA]);
+  const bool useIntegerAcc = !m_alfWSSD && bitDepth <= COV_ACC_MAX_BITDEPTH;
+  const int  size          = shape.numCoeff;   // numCoeff - 1 luma differences followed by the sample error
+  const int  flushInterval = useIntegerAcc ? 1 << (28 - 2 * bitDepth) : 0;
+
+  int x[COV_ACC_STRIDE] = { 0 };
+  int count             = 0;
+
   for (int i = 0; i < compArea.height; i++)
   {
     const int iY = i << getComponentScaleY(compID, m_chromaFormat);
@@ -4168,6 +4270,24 @@ void EncAdaptiveLoopFilter::getBlkStatsCcAlf(AlfCovariance &alfCovariance, const
 
       calcCovarianceCcAlf(ELocal, rec[COMPONENT_Y] + jY, recStride[COMPONENT_Y], shape, vbDistance);
 
+      if (useIntegerAcc)
+      {
+        for (int k = 0; k < size - 1; k++)
+        {
+          x[k] = ELocal[k][0];
+        }
+        x[size - 1] = org[j] - rec[compID][j];
+
+        m_accumulateCovariance(x, size, m_covAcc.data(), COV_ACC_STRIDE);
+
+        if (++count == flushInterval)
+        {
+          flushCovariance(alfCovariance, m_covAcc.data(), size, invStrength);
+          count = 0;
+        }
+        continue;
+      }
+
       const Pel *lumaPtr = orgLuma + iY * orgLumaStride + jY;
 
       const double weight = m_alfWSSD ? m_lumaLevelToWeightPLUT[*lumaPtr] : 1.0;
@@ -4214,6 +4334,11 @@ void EncAdaptiveLoopFilter::getBlkStatsCcAlf(AlfCovariance &alfCovariance, const
       }
     }
   }
+
+  if (count > 0)
+  {
+    flushCovariance(alfCovariance, m_covAcc.data(), size, invStrength);
+  }
 }
 
 void EncAdaptiveLoopFilter::calcCovarianceCcAlf(Pel ELocal[MAX_NUM_CC_ALF_CHROMA_COEFF][1], const Pel *rec,
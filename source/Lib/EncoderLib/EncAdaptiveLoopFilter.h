@@ -289,6 +289,13 @@ private:
   AlfCovariance**                          m_alfCovarianceCcAlf[2];        // [compIdx-1][shapeIdx][ctbAddr]
   AlfCovariance*                           m_alfCovarianceFrameCcAlf[2];   // [compIdx-1][shapeIdx]
 
+  // Without luma level weighting the block statistics are sums of integer products. They are accumulated in 32 bits
+  // (local E vector followed by the sample error) and added to the AlfCovariance before they can overflow.
+  static constexpr int COV_ACC_SIZE         = MAX_NUM_ALF_LUMA_COEFF * MAX_ALF_NUM_CLIP_VALS + 1;
+  static constexpr int COV_ACC_STRIDE       = (COV_ACC_SIZE + 7) & ~7;
+  static constexpr int COV_ACC_MAX_BITDEPTH = 14;
+  std::vector<int>     m_covAcc;   // [classIdx][row][column]
+
   //for RDO
   AlfParam               m_alfParamTemp;
   ParameterSetMap<APS>*  m_apsMap;
@@ -390,6 +397,7 @@ private:
                           const ComponentID compID, const int yPos);
   void   calcCovarianceCcAlf(Pel ELocal[MAX_NUM_CC_ALF_CHROMA_COEFF][1], const Pel *rec, const ptrdiff_t stride,
                              const AlfFilterShape &shape, int vbDistance);
+  void   flushCovariance(AlfCovariance &alfCovariance, int *acc, const int size, const double invStrength);
   void   mergeClasses(const AlfFilterShape& alfShape, AlfCovariance* cov, AlfCovariance* covMerged,
                       AlfClipIdx clipMerged[MAX_NUM_ALF_CLASSES][MAX_NUM_ALF_CLASSES][MAX_NUM_ALF_LUMA_COEFF],
                       const int numClasses, AlfBankIdx filterIndices[MAX_NUM_ALF_CLASSES][MAX_NUM_ALF_CLASSES]);
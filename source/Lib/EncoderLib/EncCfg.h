@@ -179,6 +179,7 @@ protected:
   bool      m_printMSSSIM;
   bool      m_printWPSNR;
   bool      m_printHighPrecEncTime = false;
+  bool      m_backgroundMetrics;                              ///< compute the metrics of a frame while the next frame is coded
   bool      m_cabacZeroWordPaddingEnabled;
   bool      m_ShutterFilterEnable;                          ///< enable Pre-Filtering with Shutter Interval SEI
   int       m_SII_BlendingRatio;
@@ -560,6 +561,9 @@ protected:
   bool      m_singleSlicePerSubPicFlag;
   bool      m_entropyCodingSyncEnabledFlag;
   bool      m_entryPointPresentFlag;                           ///< flag for the presence of entry points
+#if ENABLE_PARALLEL_TILE_WRITING
+  int       m_numTileWriterThreads;                            ///< number of threads writing the tile substreams of a slice
+#endif
 
   HashType  m_decodedPictureHashSEIType;
   HashType  m_subpicDecodedPictureHashType;
@@ -1253,6 +1257,9 @@ public:
   bool getPrintHighPrecEncTime() const { return m_printHighPrecEncTime; }
   void setPrintHightPrecEncTime(bool val) { m_printHighPrecEncTime = val; }
 
+  bool      getBackgroundMetrics            ()         const { return m_backgroundMetrics;          }
+  void      setBackgroundMetrics            (bool value)     { m_backgroundMetrics = value;         }
+
   bool      getCabacZeroWordPaddingEnabled()           const { return m_cabacZeroWordPaddingEnabled;  }
   void      setCabacZeroWordPaddingEnabled(bool value)       { m_cabacZeroWordPaddingEnabled = value; }
 
@@ -1914,6 +1921,10 @@ public:
   void  setEntropyCodingSyncEnabledFlag(bool b)                      { m_entropyCodingSyncEnabledFlag = b; }
   bool  getEntropyCodingSyncEnabledFlag() const                      { return m_entropyCodingSyncEnabledFlag; }
   void  setEntryPointPresentFlag(bool b)                             { m_entryPointPresentFlag = b; }
+#if ENABLE_PARALLEL_TILE_WRITING
+  void  setNumTileWriterThreads(int n)                               { m_numTileWriterThreads = n; }
+  int   getNumTileWriterThreads() const                              { return m_numTileWriterThreads; }
+#endif
   void  setDecodedPictureHashSEIType(HashType m)                     { m_decodedPictureHashSEIType = m; }
   HashType getDecodedPictureHashSEIType() const                      { return m_decodedPictureHashSEIType; }
   void  setSubpicDecodedPictureHashType(HashType m)                  { m_subpicDecodedPictureHashType = m; }
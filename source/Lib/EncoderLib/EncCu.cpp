@@ -2263,33 +2263,35 @@ void EncCu::xCheckRDCostUnifiedMerge(CodingStructure *&tempCS, CodingStructure *
   // 1. Pass: get SATD-cost for selected candidates and reduce their count
   m_mergeItemList.resetList(numMergeSatdCand);
   const TempCtx ctxStart(m_ctxPool, m_CABACEstimator->getCtx());
+  MergeFracBits mergeBits;
+  mergeBits.init(*pu, ctxStart);
   DistParam distParam;
   const bool bUseHadamard = !tempCS->slice->getDisableSATDForRD();
   // the third arguments to setDistParam is dummy and will be updated before being used
   m_pcRdCost->setDistParam(distParam, tempCS->getOrgBuf().Y(), tempCS->getOrgBuf().Y(), sps.getBitDepth(ChannelType::LUMA), COMPONENT_Y, bUseHadamard);
 
-  addRegularCandsToPruningList(mergeCtx, localUnitArea, sqrtLambdaForFirstPass, ctxStart, numDmvrMvd, dmvrL0Mvd, dmvrImpreciseMv, mrgPredBufNoCiip,
+  addRegularCandsToPruningList(mergeCtx, localUnitArea, sqrtLambdaForFirstPass, mergeBits, numDmvrMvd, dmvrL0Mvd, dmvrImpreciseMv, mrgPredBufNoCiip,
     mrgPredBufNoMvRefine, distParam, pu);
   // CIIP needs to be checked right after regular merge as the checking is based on the best 4 regular merge cand in the mergeItemList
   if (isIntrainterEnabled)
   {
-    addCiipCandsToPruningList(mergeCtx, localUnitArea, sqrtLambdaForFirstPass, ctxStart, mrgPredBufNoCiip,
+    addCiipCandsToPruningList(mergeCtx, localUnitArea, sqrtLambdaForFirstPass, mergeBits, mrgPredBufNoCiip,
       mrgPredBufNoMvRefine, distParam, pu);
   }
 
   if (pu->cs->sps->getUseMMVD())
   {
-    addMmvdCandsToPruningList(mergeCtx, localUnitArea, sqrtLambdaForFirstPass, ctxStart, distParam, pu);
+    addMmvdCandsToPruningList(mergeCtx, localUnitArea, sqrtLambdaForFirstPass, mergeBits, distParam, pu);
   }
 
   if (affineMergeCtx.numValidMergeCand > 0)
   {
-    addAffineCandsToPruningList(affineMergeCtx, localUnitArea, sqrtLambdaForFirstPass, ctxStart, distParam, pu);
+    addAffineCandsToPruningList(affineMergeCtx, localUnitArea, sqrtLambdaForFirstPass, mergeBits, distParam, pu);
   }
 
   if (toAddGpmCand)
   {
-    addGpmCandsToPruningList(gpmMergeCtx, localUnitArea, sqrtLambdaForFirstPass, ctxStart, comboList, geoBuffer, distParam, pu);
+    addGpmCandsToPruningList(gpmMergeCtx, localUnitArea, sqrtLambdaForFirstPass, mergeBits, comboList, geoBuffer, distParam, pu);
   }
 
   // Try to limit number of candidates using SATD-costs
@@ -2859,12 +2861,11 @@ void EncCu::generateMergePrediction(const UnitArea& unitArea, MergeItem* mergeIt
   }
 }
 
-double EncCu::calcLumaCost4MergePrediction(const TempCtx& ctxStart, const PelUnitBuf& predBuf, double lambda, PredictionUnit& pu, DistParam& distParam)
+double EncCu::calcLumaCost4MergePrediction(const MergeFracBits& mergeBits, const PelUnitBuf& predBuf, double lambda, PredictionUnit& pu, DistParam& distParam)
 {
   distParam.cur = predBuf.Y();
   auto dist = distParam.distFunc(distParam);
-  m_CABACEstimator->getCtx() = ctxStart;
-  auto fracBits = m_pcInterSearch->xCalcPuMeBits(pu);
+  auto fracBits = mergeBits.getFracBits(pu);
   double cost = (double)dist + (double)fracBits * lambda;
   return cost;
 }
@@ -2918,7 +2919,7 @@ void EncCu::checkEarlySkip(const CodingStructure* bestCS, const Partitioner &par
 
 template <size_t N>
 void EncCu::addRegularCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPassIntra,
-  const TempCtx& ctxStart, int numDmvrMvd, Mv dmvrL0Mvd[MRG_MAX_NUM_CANDS][MAX_NUM_SUBCU_DMVR], bool dmvrImpreciseMv[MRG_MAX_NUM_CANDS],
+  const MergeFracBits& mergeBits, int numDmvrMvd, Mv dmvrL0Mvd[MRG_MAX_NUM_CANDS][MAX_NUM_SUBCU_DMVR], bool dmvrImpreciseMv[MRG_MAX_NUM_CANDS],
   PelUnitBufVector<N>& mrgPredBufNoCiip, PelUnitBufVector<N>& mrgPredBufNoMvRefine, DistParam& distParam, PredictionUnit* pu)
 {
   // only set this to true when cfg, size, tid, framerate all fulfilled
@@ -2940,7 +2941,7 @@ void EncCu::addRegularCandsToPruningList(const MergeCtx& mergeCtx, const UnitAre
     // mrgPredBufNoCiip will be used directly without performing prediction
     generateMergePrediction(localUnitArea, regularMerge, *pu, true, true, dstBuf, false, false,
       mrgPredBufNoMvRefine[uiMergeCand], mrgPredBufNoCiip[uiMergeCand]);
-    regularMerge->cost = calcLumaCost4MergePrediction(ctxStart, dstBuf, sqrtLambdaForFirstPassIntra, *pu, distParam);
+    regularMerge->cost = calcLumaCost4MergePrediction(mergeBits, dstBuf, sqrtLambdaForFirstPassIntra, *pu, distParam);
     if (PU::checkDMVRCondition(*pu))
     {
       std::copy_n(pu->mvdL0SubPu, numDmvrMvd, dmvrL0Mvd[regularMerge->mergeIdx]);
@@ -2957,7 +2958,7 @@ void EncCu::addRegularCandsToPruningList(const MergeCtx& mergeCtx, const UnitAre
 
 template <size_t N>
 void EncCu::addCiipCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPassIntra,
-  const TempCtx& ctxStart, PelUnitBufVector<N>& mrgPredBufNoCiip, PelUnitBufVector<N>& mrgPredBufNoMvRefine, DistParam& distParam, PredictionUnit* pu)
+  const MergeFracBits& mergeBits, PelUnitBufVector<N>& mrgPredBufNoCiip, PelUnitBufVector<N>& mrgPredBufNoMvRefine, DistParam& distParam, PredictionUnit* pu)
 {
   // save the to-be-tested merge candidates
   static_vector<int, NUM_MRG_SATD_CAND> ciipMergeIdxList;
@@ -2999,19 +3000,19 @@ void EncCu::addCiipCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea&
       PelUnitBuf* tmp = m_pelUnitBufPool.getPelUnitBuf(localUnitArea);
       tmp->copyFrom(dstBuf, true, false);
       tmp->Y().rspSignal(m_pcReshape->getInvLUT());
-      ciipMerge->cost = calcLumaCost4MergePrediction(ctxStart, *tmp, sqrtLambdaForFirstPassIntra, *pu, distParam);
+      ciipMerge->cost = calcLumaCost4MergePrediction(mergeBits, *tmp, sqrtLambdaForFirstPassIntra, *pu, distParam);
       m_pelUnitBufPool.giveBack(tmp);
     }
     else
     {
-      ciipMerge->cost = calcLumaCost4MergePrediction(ctxStart, dstBuf, sqrtLambdaForFirstPassIntra, *pu, distParam);
+      ciipMerge->cost = calcLumaCost4MergePrediction(mergeBits, dstBuf, sqrtLambdaForFirstPassIntra, *pu, distParam);
     }
     m_mergeItemList.insertMergeItemToList(ciipMerge);
   }
 }
 
 void EncCu::addMmvdCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPassIntra,
-  const TempCtx& ctxStart, DistParam& distParam, PredictionUnit* pu)
+  const MergeFracBits& mergeBits, DistParam& distParam, PredictionUnit* pu)
 {
   pu->cu->mmvdSkip = true;
   pu->regularMergeFlag = true;
@@ -3027,13 +3028,13 @@ void EncCu::addMmvdCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea&
     mmvdMerge->importMergeInfo(mergeCtx, mmvdIdx.val, MergeItem::MergeItemType::MMVD, *pu);
     auto dstBuf = mmvdMerge->getPredBuf(localUnitArea);
     generateMergePrediction(localUnitArea, mmvdMerge, *pu, true, false, dstBuf, false, false, nullptr, nullptr);
-    mmvdMerge->cost = calcLumaCost4MergePrediction(ctxStart, dstBuf, sqrtLambdaForFirstPassIntra, *pu, distParam);
+    mmvdMerge->cost = calcLumaCost4MergePrediction(mergeBits, dstBuf, sqrtLambdaForFirstPassIntra, *pu, distParam);
     m_mergeItemList.insertMergeItemToList(mmvdMerge);
   }
 }
 
 void EncCu::addAffineCandsToPruningList(AffineMergeCtx& affineMergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPass,
-  const TempCtx& ctxStart, DistParam& distParam, PredictionUnit* pu)
+  const MergeFracBits& mergeBits, DistParam& distParam, PredictionUnit* pu)
 {
 #if GDR_ENABLED
   CodingStructure* cs = pu->cs;
@@ -3048,7 +3049,7 @@ void EncCu::addAffineCandsToPruningList(AffineMergeCtx& affineMergeCtx, const Un
       ? MergeItem::MergeItemType::SBTMVP : MergeItem::MergeItemType::AFFINE, localUnitArea);
     auto dstBuf = mergeItem->getPredBuf(localUnitArea);
     generateMergePrediction(localUnitArea, mergeItem, *pu, true, false, dstBuf, false, false, nullptr, nullptr);
-    mergeItem->cost = calcLumaCost4MergePrediction(ctxStart, dstBuf, sqrtLambdaForFirstPass, *pu, distParam);
+    mergeItem->cost = calcLumaCost4MergePrediction(mergeBits, dstBuf, sqrtLambdaForFirstPass, *pu, distParam);
 
 #if GDR_ENABLED
     if (isEncodeGdrClean)
@@ -3082,7 +3083,7 @@ void EncCu::addAffineCandsToPruningList(AffineMergeCtx& affineMergeCtx, const Un
 
 template <size_t N>
 void EncCu::addGpmCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPass,
-  const TempCtx& ctxStart, const GeoComboCostList& comboList, PelUnitBufVector<N>& geoBuffer, DistParam& distParamSAD2, PredictionUnit* pu)
+  const MergeFracBits& mergeBits, const GeoComboCostList& comboList, PelUnitBufVector<N>& geoBuffer, DistParam& distParamSAD2, PredictionUnit* pu)
 {
   const int geoNumMrgSadCand = std::min(GEO_MAX_TRY_WEIGHTED_SAD, (int)comboList.list.size());
   for (int candidateIdx = 0; candidateIdx < geoNumMrgSadCand; candidateIdx++)
@@ -3096,7 +3097,7 @@ void EncCu::addGpmCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& l
     auto dstBuf = mergeItem->getPredBuf(localUnitArea);
     generateMergePrediction(localUnitArea, mergeItem, *pu, true, false, dstBuf, false, false,
       geoBuffer[mergeIdxPair[0]], geoBuffer[mergeIdxPair[1]]);
-    mergeItem->cost = calcLumaCost4MergePrediction(ctxStart, dstBuf, sqrtLambdaForFirstPass, *pu, distParamSAD2);
+    mergeItem->cost = calcLumaCost4MergePrediction(mergeBits, dstBuf, sqrtLambdaForFirstPass, *pu, distParamSAD2);
     m_mergeItemList.insertMergeItemToList(mergeItem);
   }
 }
@@ -4790,4 +4791,136 @@ void MergeItemList::resetList(size_t maxTrackingNum)
   m_maxTrackingNum = maxTrackingNum;
 }
 
+static inline unsigned unaryMaxEqProbNumBins(unsigned symbol, unsigned maxSymbol)
+{
+  return maxSymbol == 0 ? 0 : symbol + (maxSymbol > symbol ? 1 : 0);
+}
+
+uint32_t MergeFracBits::truncUnaryBits(const BinFracBits& firstBin, int symbol, int numCandMinus1)
+{
+  if (numCandMinus1 <= 0)
+  {
+    return 0;
+  }
+  if (symbol == 0)
+  {
+    return firstBin.intBits[0];
+  }
+  return firstBin.intBits[1] + BinProbModelBase::estFracBitsEP(std::min(symbol, numCandMinus1 - 1));
+}
+
+void MergeFracBits::init(const PredictionUnit& pu, const Ctx& ctx)
+{
+  const FracBitsAccess& fracBits = ctx.getFracBitsAcess();
+
+  m_mergeFlag           = fracBits.getFracBitsArray(Ctx::MergeFlag());
+  m_subblockMergeFlag   = fracBits.getFracBitsArray(Ctx::SubblockMergeFlag(DeriveCtx::CtxAffineFlag(*pu.cu)));
+  m_regularMergeFlag[0] = fracBits.getFracBitsArray(Ctx::RegularMergeFlag(0));
+  m_regularMergeFlag[1] = fracBits.getFracBitsArray(Ctx::RegularMergeFlag(1));
+  m_mmvdFlag            = fracBits.getFracBitsArray(Ctx::MmvdFlag(0));
+  m_mmvdMergeIdx        = fracBits.getFracBitsArray(Ctx::MmvdMergeIdx());
+  m_mmvdStepMvpIdx      = fracBits.getFracBitsArray(Ctx::MmvdStepMvpIdx());
+  m_ciipFlag            = fracBits.getFracBitsArray(Ctx::CiipFlag());
+  m_mergeIdx            = fracBits.getFracBitsArray(Ctx::MergeIdx());
+  m_affMergeIdx         = fracBits.getFracBitsArray(Ctx::AffMergeIdx());
+
+  // the second GPM index is coded with the context state updated by the first one
+  for (unsigned bin0 = 0; bin0 < 2; bin0++)
+  {
+    for (unsigned bin1 = 0; bin1 < 2; bin1++)
+    {
+      BinProbModel_Std model = static_cast<const CtxStore<BinProbModel_Std>&>(ctx)[Ctx::MergeIdx()];
+      uint64_t         bits  = 0;
+      model.estFracBitsUpdate(bin0, bits);
+      model.estFracBitsUpdate(bin1, bits);
+      m_geoMergeIdx[bin0][bin1] = uint32_t(bits);
+    }
+  }
+}
+
+// mirrors CABACWriter::merge_flag() and CABACWriter::merge_data() for non-IBC merge modes
+uint64_t MergeFracBits::getFracBits(const PredictionUnit& pu) const
+{
+  CHECKD(!pu.mergeFlag || CU::isIBC(*pu.cu), "Only non-IBC merge modes are supported");
+
+  const CodingUnit& cu  = *pu.cu;
+  const SPS&        sps = *pu.cs->sps;
+
+  uint64_t fracBits = m_mergeFlag.intBits[1];
+
+  const int maxNumAffineMergeCand = cu.slice->getPicHeader()->getMaxNumAffineMergeCand();
+  if (!cu.cs->slice->isIntra() && maxNumAffineMergeCand > 0 && cu.lwidth() >= 8 && cu.lheight() >= 8)
+  {
+    fracBits += m_subblockMergeFlag.intBits[cu.affine ? 1 : 0];
+  }
+  if (cu.affine)
+  {
+    return fracBits + truncUnaryBits(m_affMergeIdx, pu.mergeIdx, maxNumAffineMergeCand - 1);
+  }
+
+  const bool ciipAvailable = sps.getUseCiip() && !cu.skip && cu.lwidth() < MAX_CU_SIZE && cu.lheight() < MAX_CU_SIZE
+                             && cu.lwidth() * cu.lheight() >= 64;
+  const bool geoAvailable = sps.getUseGeo() && cu.slice->isInterB() && sps.getMaxNumGeoCand() > 1
+                            && cu.lwidth() >= GEO_MIN_CU_SIZE && cu.lheight() >= GEO_MIN_CU_SIZE
+                            && cu.lwidth() <= GEO_MAX_CU_SIZE && cu.lheight() <= GEO_MAX_CU_SIZE
+                            && cu.lwidth() < 8 * cu.lheight() && cu.lheight() < 8 * cu.lwidth();
+  if (geoAvailable || ciipAvailable)
+  {
+    fracBits += m_regularMergeFlag[cu.skip ? 0 : 1].intBits[pu.regularMergeFlag ? 1 : 0];
+  }
+
+  if (pu.regularMergeFlag)
+  {
+    if (sps.getUseMMVD())
+    {
+      fracBits += m_mmvdFlag.intBits[pu.mmvdMergeFlag ? 1 : 0];
+    }
+    if (pu.mmvdMergeFlag || cu.mmvdSkip)
+    {
+      if (sps.getMaxNumMergeCand() > 1)
+      {
+        fracBits += m_mmvdMergeIdx.intBits[pu.mmvdMergeIdx.pos.baseIdx];
+      }
+      fracBits += truncUnaryBits(m_mmvdStepMvpIdx, pu.mmvdMergeIdx.pos.step, MmvdIdx::REFINE_STEP - 1);
+      return fracBits + BinProbModelBase::estFracBitsEP(2);
+    }
+    return fracBits + truncUnaryBits(m_mergeIdx, pu.mergeIdx, sps.getMaxNumMergeCand() - 1);
+  }
+
+  if (geoAvailable && ciipAvailable)
+  {
+    fracBits += m_ciipFlag.intBits[pu.ciipFlag ? 1 : 0];
+  }
+  if (!cu.geoFlag)
+  {
+    return fracBits + truncUnaryBits(m_mergeIdx, pu.mergeIdx, sps.getMaxNumMergeCand() - 1);
+  }
+
+  const int candIdx0 = pu.geoMergeIdx[0];
+  const int candIdx1 = pu.geoMergeIdx[1] - (pu.geoMergeIdx[1] < candIdx0 ? 0 : 1);
+
+  const int thresh   = floorLog2(GEO_NUM_PARTITION_MODE);
+  const int numShort = (1 << (thresh + 1)) - GEO_NUM_PARTITION_MODE;
+  unsigned  numBinsEP = pu.geoSplitDir < numShort ? thresh : thresh + 1;
+
+  const int numCandMinus2 = sps.getMaxNumGeoCand() - 2;
+  if (candIdx0 > 0)
+  {
+    numBinsEP += unaryMaxEqProbNumBins(candIdx0 - 1, numCandMinus2);
+  }
+  if (numCandMinus2 > 0)
+  {
+    fracBits += m_geoMergeIdx[candIdx0 > 0 ? 1 : 0][candIdx1 > 0 ? 1 : 0];
+    if (candIdx1 > 0)
+    {
+      numBinsEP += unaryMaxEqProbNumBins(candIdx1 - 1, numCandMinus2 - 1);
+    }
+  }
+  else
+  {
+    fracBits += m_mergeIdx.intBits[candIdx0 > 0 ? 1 : 0];
+  }
+  return fracBits + BinProbModelBase::estFracBitsEP(numBinsEP);
+}
+
 //! \}
@@ -221,6 +221,28 @@ public:
 
 };
 
+/// fractional bits of the merge_flag() and merge_data() bins of one CU, taken from a fixed context state
+class MergeFracBits
+{
+private:
+  BinFracBits m_mergeFlag;
+  BinFracBits m_subblockMergeFlag;
+  BinFracBits m_regularMergeFlag[2];
+  BinFracBits m_mmvdFlag;
+  BinFracBits m_mmvdMergeIdx;
+  BinFracBits m_mmvdStepMvpIdx;
+  BinFracBits m_ciipFlag;
+  BinFracBits m_mergeIdx;
+  BinFracBits m_affMergeIdx;
+  uint32_t    m_geoMergeIdx[2][2];   // first bins of both GPM indices, which share one adaptive context
+
+  static uint32_t truncUnaryBits(const BinFracBits& firstBin, int symbol, int numCandMinus1);
+
+public:
+  void          init(const PredictionUnit& pu, const Ctx& ctx);
+  uint64_t      getFracBits(const PredictionUnit& pu) const;
+};
+
 class EncCu
   : DecCu
 {
@@ -372,22 +394,22 @@ protected:
 
   void generateMergePrediction(const UnitArea& unitArea, MergeItem* mergeItem, PredictionUnit& pu, bool luma, bool chroma,
     PelUnitBuf& dstBuf, bool finalRd, bool forceNoResidual, PelUnitBuf* predBuf1, PelUnitBuf* predBuf2);
-  double calcLumaCost4MergePrediction(const TempCtx& ctxStart, const PelUnitBuf& predBuf, double lambda, PredictionUnit& pu, DistParam& distParam);
+  double calcLumaCost4MergePrediction(const MergeFracBits& mergeBits, const PelUnitBuf& predBuf, double lambda, PredictionUnit& pu, DistParam& distParam);
 
   template <size_t N>
   void addRegularCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPassIntra,
-    const TempCtx& ctxStart, int numDmvrMvd, Mv dmvrL0Mvd[MRG_MAX_NUM_CANDS][MAX_NUM_SUBCU_DMVR], bool dmvrImpreciseMv[MRG_MAX_NUM_CANDS],
+    const MergeFracBits& mergeBits, int numDmvrMvd, Mv dmvrL0Mvd[MRG_MAX_NUM_CANDS][MAX_NUM_SUBCU_DMVR], bool dmvrImpreciseMv[MRG_MAX_NUM_CANDS],
     PelUnitBufVector<N>& mrgPredBufNoCiip, PelUnitBufVector<N>& mrgPredBufNoMvRefine, DistParam& distParam, PredictionUnit* pu);
   template <size_t N>
   void addCiipCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPassIntra,
-    const TempCtx& ctxStart, PelUnitBufVector<N>& mrgPredBufNoCiip, PelUnitBufVector<N>& mrgPredBufNoMvRefine, DistParam& distParam, PredictionUnit* pu);
+    const MergeFracBits& mergeBits, PelUnitBufVector<N>& mrgPredBufNoCiip, PelUnitBufVector<N>& mrgPredBufNoMvRefine, DistParam& distParam, PredictionUnit* pu);
   void addMmvdCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPassIntra,
-    const TempCtx& ctxStart, DistParam& distParam, PredictionUnit* pu);
+    const MergeFracBits& mergeBits, DistParam& distParam, PredictionUnit* pu);
   void addAffineCandsToPruningList(AffineMergeCtx& affineMergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPass,
-    const TempCtx& ctxStart, DistParam& distParam, PredictionUnit* pu);
+    const MergeFracBits& mergeBits, DistParam& distParam, PredictionUnit* pu);
   template <size_t N>
   void addGpmCandsToPruningList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPass,
-    const TempCtx& ctxStart, const GeoComboCostList& comboList, PelUnitBufVector<N>& geoBuffer, DistParam& distParamSAD2, PredictionUnit* pu);
+    const MergeFracBits& mergeBits, const GeoComboCostList& comboList, PelUnitBufVector<N>& geoBuffer, DistParam& distParamSAD2, PredictionUnit* pu);
 
   template<size_t N>
   bool prepareGpmComboList(const MergeCtx& mergeCtx, const UnitArea& localUnitArea, double sqrtLambdaForFirstPass,
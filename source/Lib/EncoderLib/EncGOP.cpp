@@ -2358,8 +2358,6 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
   PicHeader *picHeader = nullptr;
 
   Slice*      pcSlice;
-  OutputBitstream  *pcBitstreamRedirect;
-  pcBitstreamRedirect = new OutputBitstream;
   AccessUnit::iterator  itLocationToPushSliceHeaderNALU; // used to store location where NALU containing slice header is to be inserted
   Picture* scaledRefPic[MAX_NUM_REF] = {};
 
@@ -4267,27 +4265,16 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
           m_preQP[0] = pcSlice->getSliceQp();
         }
         {
-          // Construct the final bitstream by concatenating substreams.
-          // The final bitstream is either nalu.m_bitstream or pcBitstreamRedirect;
           // Complete the slice header info.
           m_HLSWriter->setBitstream(&nalu.m_bitstream);
           m_HLSWriter->codeTilesWPPEntryPoint( pcSlice );
-
-          // Append substreams...
-          OutputBitstream *pcOut = pcBitstreamRedirect;
-          const int numSubstreamsToCode = pcSlice->getNumberOfSubstream() + 1;
-
-          for ( uint32_t ui = 0 ; ui < numSubstreamsToCode; ui++ )
-          {
-            pcOut->addSubstream(&(substreamsOut[ui]));
-          }
         }
 
         // If current NALU is the first NALU of slice (containing slice header) and more NALUs exist (due to multiple dependent slices) then buffer it.
         // If current NALU is the last NALU of slice and a NALU was buffered, then (a) Write current NALU (b) Update an write buffered NALU at approproate location in NALU list.
         bool naluAlignedWrittenToList =
           false;   // used to ensure current NALU is not written more than once to the NALU list.
-        xAttachSliceDataToNalUnit(nalu, pcBitstreamRedirect);
+        xAttachSliceDataToNalUnit(nalu, substreamsOut, pcSlice->getNumberOfSubstream() + 1);
         accessUnit.push_back(new NALUnitEBSP(nalu));
         actualTotalBits += uint32_t(accessUnit.back()->m_nalUnitData.str().size()) * 8;
         numBytesInVclNalUnits += (std::size_t)(accessUnit.back()->m_nalUnitData.str().size());
@@ -4389,6 +4376,8 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
 
       m_pcCfg->setEncodedFlag(gopId, true);
 
+      xFinishPictureMetrics();
+
       double PSNR_Y;
       xCalculateAddPSNRs(isField, isTff, gopId, pcPic, accessUnit, rcListPic, encTime, snr_conversion, printFrameMSE,
                          printMSSSIM, &PSNR_Y, isEncodeLtRef);
@@ -4469,13 +4458,14 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
       xWriteTrailingSEIMessages(trailingSeiMessages, accessUnit, pcSlice->getTLayer());
 
 #if GDR_ENABLED
-      if (!(m_pcCfg->getGdrNoHash() && pcSlice->getPic()->gdrParam.inGdrInterval))
-      {
-        printHash(m_pcCfg->getDecodedPictureHashSEIType(), digestStr);
-      }
+      const HashType printedHashType = m_pcCfg->getGdrNoHash() && pcSlice->getPic()->gdrParam.inGdrInterval
+                                         ? HashType::NONE
+                                         : m_pcCfg->getDecodedPictureHashSEIType();
 #else
-      printHash(m_pcCfg->getDecodedPictureHashSEIType(), digestStr);
+      const HashType printedHashType = m_pcCfg->getDecodedPictureHashSEIType();
 #endif
+      bool     printCpbState = false;
+      uint32_t cpbState      = 0;
 
       if ( m_pcCfg->getUseRateCtrl() )
       {
@@ -4501,7 +4491,8 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
         if (m_pcRateCtrl->getCpbSaturationEnabled())
         {
           m_pcRateCtrl->updateCpbState(actualTotalBits);
-          msg( NOTICE, " [CPB %6d bits]", m_pcRateCtrl->getCpbState() );
+          printCpbState = true;
+          cpbState      = m_pcRateCtrl->getCpbState();
         }
       }
       xCreateFrameFieldInfoSEI( leadingSeiMessages, pcSlice, isField );
@@ -4557,8 +4548,30 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
 
       m_AUWriterIf->outputAU( accessUnit );
 
-      msg( NOTICE, "\n" );
-      fflush( stdout );
+      auto printPictureTrailer = [printedHashType, digestStr, printCpbState, cpbState]()
+      {
+        printHash(printedHashType, digestStr);
+        if (printCpbState)
+        {
+          msg( NOTICE, " [CPB %6d bits]", cpbState );
+        }
+        msg( NOTICE, "\n" );
+        fflush( stdout );
+      };
+
+      if (m_metricsJob.valid())
+      {
+        // the line of the picture is completed after its metrics have been reported
+        m_metricsReport = [report = std::move(m_metricsReport), printPictureTrailer]()
+        {
+          report();
+          printPictureTrailer();
+        };
+      }
+      else
+      {
+        printPictureTrailer();
+      }
     }
 
     m_cntRightBottom = pcSlice->getCntRightBottom();
@@ -4586,11 +4599,24 @@ void EncGOP::compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::l
       gopId = effFieldIRAPMap.restoreGOPid(gopId);
     }
 
-    pcPic->destroyTempBuffers();
-    pcPic->cs->destroyTemporaryCsData();
+    if (m_metricsJob.valid())
+    {
+      // the metrics may still be computed against the true original, which is one of the temporary buffers
+      m_metricsReport = [report = std::move(m_metricsReport), pcPic]()
+      {
+        report();
+        pcPic->destroyTempBuffers();
+        pcPic->cs->destroyTemporaryCsData();
+      };
+    }
+    else
+    {
+      pcPic->destroyTempBuffers();
+      pcPic->cs->destroyTemporaryCsData();
+    }
   }   // gopId-loop
 
-  delete pcBitstreamRedirect;
+  xFinishPictureMetrics();
 
   CHECK(m_numPicsCoded > 1, "Unspecified error");
 }
@@ -4933,18 +4959,7 @@ uint64_t EncGOP::xFindDistortionPlane(const CPelBuf& pic0, const CPelBuf& pic1,
 
       if (B < 4) // image is too small to use WPSNR, resort to traditional PSNR
       {
-        totalDiff = 0;
-        for (y = 0; y < H; y++)
-        {
-          for (x = 0; x < W; x++)
-          {
-            const           int64_t iDiff = (int64_t)pSrc0[x] - (int64_t)pSrc1[x];
-            totalDiff += uint64_t(iDiff * iDiff);
-          }
-          pSrc0 += pic0.stride;
-          pSrc1 += pic1.stride;
-        }
-        return totalDiff;
+        return g_pelBufOP.calcSse(pSrc0, pic0.stride, pSrc1, pic1.stride, W, H);
       }
 
       double wmse = 0.0, sumAct = 0.0; // compute activity normalized SNR value
@@ -4981,24 +4996,14 @@ uint64_t EncGOP::xFindDistortionPlane(const CPelBuf& pic0, const CPelBuf& pic1,
   }
   else
   {
-    totalDiff = 0;
-    for (int y = 0; y < pic0.height; y++)
-    {
-      for (int x = 0; x < pic0.width; x++)
-      {
-        Intermediate_Int temp = pSrc0[x] - pSrc1[x];
-        totalDiff += uint64_t(temp * temp);
-      }
-      pSrc0 += pic0.stride;
-      pSrc1 += pic1.stride;
-    }
+    totalDiff = g_pelBufOP.calcSse(pSrc0, pic0.stride, pSrc1, pic1.stride, pic0.width, pic0.height);
   }
 
   return totalDiff;
 }
 #if WCG_WPSNR
 double EncGOP::xFindDistortionPlaneWPSNR(const CPelBuf& pic0, const CPelBuf& pic1, const uint32_t rshift, const CPelBuf& picLuma0,
-  ComponentID compID, const ChromaFormat chfmt    )
+  ComponentID compID, const ChromaFormat chfmt, const std::vector<double>& lumaLevelWeights )
 {
   const bool    useLumaWPSNR = m_pcEncLib->getPrintWPSNR();
   if (!useLumaWPSNR)
@@ -5006,44 +5011,29 @@ double EncGOP::xFindDistortionPlaneWPSNR(const CPelBuf& pic0, const CPelBuf& pic
     return 0;
   }
 
-  double       totalDiffWpsnr;
   const  Pel*  pSrc0 = pic0.bufAt(0, 0);
   const  Pel*  pSrc1 = pic1.bufAt(0, 0);
   const  Pel*  pSrcLuma = picLuma0.bufAt(0, 0);
   CHECK(pic0.width  != pic1.width , "Unspecified error");
   CHECK(pic0.height != pic1.height, "Unspecified error");
 
-  if( rshift > 0 )
-  {
-    totalDiffWpsnr = 0;
-    for (int y = 0; y < pic0.height; y++)
-    {
-      for (int x = 0; x < pic0.width; x++)
-      {
-        Intermediate_Int temp = pSrc0[x] - pSrc1[x];
-        double dW = m_pcEncLib->getRdCost()->getWPSNRLumaLevelWeight(pSrcLuma[(x << getComponentScaleX(compID, chfmt))]);
-        totalDiffWpsnr += ((dW * (double) temp * (double) temp)) * (double) (1 >> rshift);
-      }
-      pSrc0 += pic0.stride;
-      pSrc1 += pic1.stride;
-      pSrcLuma += picLuma0.stride << getComponentScaleY(compID, chfmt);
-    }
-  }
-  else
+  // the weighted squared errors are summed sample by sample in raster order, as the double sum depends on the order
+  const double shiftScale = (double) (1 >> rshift);
+
+  const int scaleX = getComponentScaleX(compID, chfmt);
+
+  double totalDiffWpsnr = 0;
+  for (int y = 0; y < pic0.height; y++)
   {
-    totalDiffWpsnr = 0;
-    for (int y = 0; y < pic0.height; y++)
+    for (int x = 0; x < pic0.width; x++)
     {
-      for (int x = 0; x < pic0.width; x++)
-      {
-        Intermediate_Int temp = pSrc0[x] - pSrc1[x];
-        double dW = m_pcEncLib->getRdCost()->getWPSNRLumaLevelWeight(pSrcLuma[x << getComponentScaleX(compID, chfmt)]);
-        totalDiffWpsnr += dW * (double) temp * (double) temp;
-      }
-      pSrc0 += pic0.stride;
-      pSrc1 += pic1.stride;
-      pSrcLuma += picLuma0.stride << getComponentScaleY(compID, chfmt);
+      Intermediate_Int temp = pSrc0[x] - pSrc1[x];
+      double dW = lumaLevelWeights[pSrcLuma[x << scaleX]];
+      totalDiffWpsnr += dW * (double) temp * (double) temp * shiftScale;
     }
+    pSrc0 += pic0.stride;
+    pSrc1 += pic1.stride;
+    pSrcLuma += picLuma0.stride << getComponentScaleY(compID, chfmt);
   }
 
   return totalDiffWpsnr;
@@ -5136,33 +5126,11 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
 #if ENABLE_QPA
   const bool    useWPSNR = m_pcEncLib->getUseWPSNR();
 #endif
-  double  dPSNR[MAX_NUM_COMPONENT];
-  double msssim[MAX_NUM_COMPONENT] = {0.0};
 #if WCG_WPSNR
   const bool    useLumaWPSNR = m_pcEncLib->getPrintWPSNR();
-  double  dPSNRWeighted[MAX_NUM_COMPONENT];
-  double  MSEyuvframeWeighted[MAX_NUM_COMPONENT];
-#endif
-  double  upscaledPSNR[MAX_NUM_COMPONENT];
-  double  upscaledMsssim[MAX_NUM_COMPONENT];
-  for(int i=0; i<MAX_NUM_COMPONENT; i++)
-  {
-    dPSNR[i]=0.0;
-#if WCG_WPSNR
-    dPSNRWeighted[i]=0.0;
-    MSEyuvframeWeighted[i] = 0.0;
-#endif
-    upscaledPSNR[i] = 0.0;
-  }
-#if JVET_O0756_CALCULATE_HDRMETRICS
-  double deltaE[hdrtoolslib::NB_REF_WHITE];
-  double psnrL[hdrtoolslib::NB_REF_WHITE];
-  for (int i=0; i<hdrtoolslib::NB_REF_WHITE; i++)
-  {
-    deltaE[i] = 0.0;
-    psnrL[i] = 0.0;
-  }
 #endif
+  // shared with the job computing the metrics when BackgroundMetrics is enabled
+  const std::shared_ptr<PictureMetrics> metrics = std::make_shared<PictureMetrics>();
 
   PelStorage interm;
 
@@ -5175,19 +5143,19 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
   const CPelUnitBuf& picC = (conversion == IPCOLOURSPACE_UNCHANGED) ? pic : interm;
 
   //===== calculate PSNR =====
-  double             mseYuvFrame[MAX_NUM_COMPONENT] = { 0, 0, 0 };
   const ChromaFormat formatD = pic.chromaFormat;
   const ChromaFormat format  = sps.getChromaFormatIdc();
+  const bool         useTrueOrg = sps.getUseLmcs() || m_pcCfg->getGopBasedTemporalFilterEnabled();
+  const BitDepths    bitDepths  = sps.getBitDepths();
 
   const bool bPicIsField     = pcPic->fieldPic;
-  const Slice*  pcSlice      = pcPic->slices[0];
 
-  PelStorage upscaledRec;
+  const std::shared_ptr<PelStorage> upscaledRec = std::make_shared<PelStorage>();
 
   if (m_pcEncLib->isResChangeInClvsEnabled())
   {
-    const CPelBuf& upscaledOrg = (sps.getUseLmcs() || m_pcCfg->getGopBasedTemporalFilterEnabled()) ? pcPic->M_BUFS( 0, PIC_TRUE_ORIGINAL_INPUT).get( COMPONENT_Y ) : pcPic->M_BUFS( 0, PIC_ORIGINAL_INPUT).get( COMPONENT_Y );
-    upscaledRec.create( pic.chromaFormat, Area( Position(), upscaledOrg ) );
+    const CPelBuf& upscaledOrg = useTrueOrg ? pcPic->M_BUFS( 0, PIC_TRUE_ORIGINAL_INPUT).get( COMPONENT_Y ) : pcPic->M_BUFS( 0, PIC_ORIGINAL_INPUT).get( COMPONENT_Y );
+    upscaledRec->create( pic.chromaFormat, Area( Position(), upscaledOrg ) );
 
     ScalingRatio scalingRatio;
     // it is assumed that full resolution picture PPS has ppsId 0
@@ -5196,7 +5164,7 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
     CU::getRprScaling(&sps, pps, pcPic, scalingRatio);
 
     bool rescaleForDisplay = true;
-    Picture::rescalePicture(scalingRatio, picC, pcPic->getScalingWindow(), upscaledRec, pps->getScalingWindow(), format, sps.getBitDepths(), false, false, sps.getHorCollocatedChromaFlag(), sps.getVerCollocatedChromaFlag(), rescaleForDisplay, m_pcCfg->getUpscaleFilerForDisplay());
+    Picture::rescalePicture(scalingRatio, picC, pcPic->getScalingWindow(), *upscaledRec, pps->getScalingWindow(), format, sps.getBitDepths(), false, false, sps.getHorCollocatedChromaFlag(), sps.getVerCollocatedChromaFlag(), rescaleForDisplay, m_pcCfg->getUpscaleFilerForDisplay());
   }
 
   Picture* picRefLayer = nullptr;
@@ -5216,7 +5184,7 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
           break;
         }
       }
-      if (picRefLayer) 
+      if (picRefLayer)
       {
         const CPelUnitBuf& pub1 = org;
         const CPelUnitBuf& pub0 = picRefLayer->getRecoBuf();
@@ -5228,8 +5196,8 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
         int h1 = pub1.get(COMPONENT_Y).height - SPS::getWinUnitY( sps.getChromaFormatIdc() ) * ( wScaling1.getWindowTopOffset()  + wScaling1.getWindowBottomOffset() );
         int xScale = ((w0 << ScalingRatio::BITS) + (w1 >> 1)) / w1;
         int yScale = ((h0 << ScalingRatio::BITS) + ( h1 >> 1 )) / h1;
-        ScalingRatio scalingRatio = { xScale, yScale };          
-      
+        ScalingRatio scalingRatio = { xScale, yScale };
+
         if (m_pcRefLayerRescaledPicYuv == nullptr)
         {
           m_pcRefLayerRescaledPicYuv = new PelStorage();
@@ -5242,103 +5210,111 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
     }
   }
 
-  for (int comp = 0; comp < ::getNumberValidComponents(formatD); comp++)
+#if WCG_WPSNR
+  // copied, as the table is updated by LMCS while the next picture is coded
+  const std::vector<double> lumaLevelWeights = m_pcEncLib->getRdCost()->getLumaLevelWeightTable();
+#endif
+
+  // only reads the picture buffers and members that stay unchanged until xFinishPictureMetrics() has been called
+  auto calculateMetrics = [=]()
   {
-    const ComponentID compID = ComponentID(comp);
-    const CPelBuf&    p = picC.get(compID);
-    const CPelBuf&    o = org.get(compID);
+    for (int comp = 0; comp < ::getNumberValidComponents(formatD); comp++)
+    {
+      const ComponentID compID = ComponentID(comp);
+      const CPelBuf&    p = picC.get(compID);
+      const CPelBuf&    o = org.get(compID);
 
-    CHECK(!( p.width  == o.width), "Unspecified error");
-    CHECK(!( p.height == o.height), "Unspecified error");
+      CHECK(!( p.width  == o.width), "Unspecified error");
+      CHECK(!( p.height == o.height), "Unspecified error");
 
-    int padX = m_pcEncLib->getSourcePadding( 0 );
-    int padY = m_pcEncLib->getSourcePadding( 1 );
+      int padX = m_pcEncLib->getSourcePadding( 0 );
+      int padY = m_pcEncLib->getSourcePadding( 1 );
 
-    // when RPR is enabled, picture padding is picture specific due to possible different picture resoluitons, however only full resolution padding is stored in EncLib
-    // get per picture padding from the conformance window, in this case if conformance window is set not equal to the padding then PSNR results may be inaccurate
-    if (m_pcEncLib->isResChangeInClvsEnabled())
-    {
-      const Window& conf = pcPic->getConformanceWindow();
-      padX = conf.getWindowRightOffset() * SPS::getWinUnitX( format );
-      padY = conf.getWindowBottomOffset() * SPS::getWinUnitY( format );
-    }
+      // when RPR is enabled, picture padding is picture specific due to possible different picture resoluitons, however only full resolution padding is stored in EncLib
+      // get per picture padding from the conformance window, in this case if conformance window is set not equal to the padding then PSNR results may be inaccurate
+      if (m_pcEncLib->isResChangeInClvsEnabled())
+      {
+        const Window& conf = pcPic->getConformanceWindow();
+        padX = conf.getWindowRightOffset() * SPS::getWinUnitX( format );
+        padY = conf.getWindowBottomOffset() * SPS::getWinUnitY( format );
+      }
 
-    const uint32_t width = p.width - ( padX >> ::getComponentScaleX( compID, format ) );
-    const uint32_t height = p.height - ( padY >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
+      const uint32_t width = p.width - ( padX >> ::getComponentScaleX( compID, format ) );
+      const uint32_t height = p.height - ( padY >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
 
-    // create new buffers with correct dimensions
-    const CPelBuf recPB(p.bufAt(0, 0), p.stride, width, height);
-    const CPelBuf orgPB(o.bufAt(0, 0), o.stride, width, height);
-    const uint32_t    bitDepth = sps.getBitDepth(toChannelType(compID));
+      // create new buffers with correct dimensions
+      const CPelBuf recPB(p.bufAt(0, 0), p.stride, width, height);
+      const CPelBuf orgPB(o.bufAt(0, 0), o.stride, width, height);
+      const uint32_t    bitDepth = bitDepths[toChannelType(compID)];
 #if ENABLE_QPA
-    const uint64_t ssdTemp =
-      xFindDistortionPlane(recPB, orgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format),
-                           ::getComponentScaleY(compID, format));
+      const uint64_t ssdTemp =
+        xFindDistortionPlane(recPB, orgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format),
+                             ::getComponentScaleY(compID, format));
 #else
-    const uint64_t ssdTemp = xFindDistortionPlane(recPB, orgPB, 0);
+      const uint64_t ssdTemp = xFindDistortionPlane(recPB, orgPB, 0);
 #endif
-    const uint32_t maxval = 255 << (bitDepth - 8);
-    const uint32_t size   = width * height;
-    const double fRefValue = (double)maxval * maxval * size;
-    dPSNR[comp]              = ssdTemp ? 10.0 * log10(fRefValue / (double) ssdTemp) : 999.99;
-    mseYuvFrame[comp]        = (double) ssdTemp / size;
-    if(printMSSSIM)
-    {
-      msssim[comp] = xCalculateMSSSIM (o.bufAt(0, 0), o.stride, p.bufAt(0, 0), p.stride, width, height, bitDepth);
-    }
+      const uint32_t maxval = 255 << (bitDepth - 8);
+      const uint32_t size   = width * height;
+      const double fRefValue = (double)maxval * maxval * size;
+      metrics->dPSNR[comp]       = ssdTemp ? 10.0 * log10(fRefValue / (double) ssdTemp) : 999.99;
+      metrics->mseYuvFrame[comp] = (double) ssdTemp / size;
+      if(printMSSSIM)
+      {
+        metrics->msssim[comp] = xCalculateMSSSIM (o.bufAt(0, 0), o.stride, p.bufAt(0, 0), p.stride, width, height, bitDepth);
+      }
 #if WCG_WPSNR
-    const double uiSSDtempWeighted = xFindDistortionPlaneWPSNR(recPB, orgPB, 0, org.get(COMPONENT_Y), compID, format);
-    if (useLumaWPSNR)
-    {
-      dPSNRWeighted[comp] = uiSSDtempWeighted ? 10.0 * log10(fRefValue / (double)uiSSDtempWeighted) : 999.99;
-      MSEyuvframeWeighted[comp] = (double)uiSSDtempWeighted / size;
-    }
+      const double uiSSDtempWeighted = xFindDistortionPlaneWPSNR(recPB, orgPB, 0, org.get(COMPONENT_Y), compID, format, lumaLevelWeights);
+      if (useLumaWPSNR)
+      {
+        metrics->dPSNRWeighted[comp] = uiSSDtempWeighted ? 10.0 * log10(fRefValue / (double)uiSSDtempWeighted) : 999.99;
+        metrics->MSEyuvframeWeighted[comp] = (double)uiSSDtempWeighted / size;
+      }
 #endif
 
 
-    if (m_pcEncLib->isResChangeInClvsEnabled())
-    {
-      const CPelBuf& upscaledOrg = (sps.getUseLmcs() || m_pcCfg->getGopBasedTemporalFilterEnabled()) ? pcPic->M_BUFS( 0, PIC_TRUE_ORIGINAL_INPUT).get( compID ) : pcPic->M_BUFS( 0, PIC_ORIGINAL_INPUT).get( compID );
+      if (m_pcEncLib->isResChangeInClvsEnabled())
+      {
+        const CPelBuf& upscaledOrg = useTrueOrg ? pcPic->M_BUFS( 0, PIC_TRUE_ORIGINAL_INPUT).get( compID ) : pcPic->M_BUFS( 0, PIC_ORIGINAL_INPUT).get( compID );
 
-      const uint32_t upscaledWidth = upscaledOrg.width - ( m_pcEncLib->getSourcePadding( 0 ) >> ::getComponentScaleX( compID, format ) );
-      const uint32_t upscaledHeight = upscaledOrg.height - ( m_pcEncLib->getSourcePadding( 1 ) >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
+        const uint32_t upscaledWidth = upscaledOrg.width - ( m_pcEncLib->getSourcePadding( 0 ) >> ::getComponentScaleX( compID, format ) );
+        const uint32_t upscaledHeight = upscaledOrg.height - ( m_pcEncLib->getSourcePadding( 1 ) >> ( !!bPicIsField + ::getComponentScaleY( compID, format ) ) );
 
-      // create new buffers with correct dimensions
-      const CPelBuf upscaledRecPB( upscaledRec.get( compID ).bufAt( 0, 0 ), upscaledRec.get( compID ).stride, upscaledWidth, upscaledHeight );
-      const CPelBuf upscaledOrgPB( upscaledOrg.bufAt( 0, 0 ), upscaledOrg.stride, upscaledWidth, upscaledHeight );
+        // create new buffers with correct dimensions
+        const CPelBuf upscaledRecPB( upscaledRec->get( compID ).bufAt( 0, 0 ), upscaledRec->get( compID ).stride, upscaledWidth, upscaledHeight );
+        const CPelBuf upscaledOrgPB( upscaledOrg.bufAt( 0, 0 ), upscaledOrg.stride, upscaledWidth, upscaledHeight );
 
 #if ENABLE_QPA
-      const uint64_t upscaledSSD = xFindDistortionPlane( upscaledRecPB, upscaledOrgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX( compID, format ) );
+        const uint64_t upscaledSSD = xFindDistortionPlane( upscaledRecPB, upscaledOrgPB, useWPSNR ? bitDepth : 0, ::getComponentScaleX( compID, format ) );
 #else
-      const uint64_t scaledSSD = xFindDistortionPlane( upsacledRecPB, upsacledOrgPB, 0 );
+        const uint64_t scaledSSD = xFindDistortionPlane( upsacledRecPB, upsacledOrgPB, 0 );
 #endif
 
-      upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10( (double)maxval * maxval * upscaledWidth * upscaledHeight / (double)upscaledSSD ) : 999.99;
-      upscaledMsssim[comp] = xCalculateMSSSIM (upscaledOrgPB.bufAt(0, 0), upscaledOrgPB.stride, upscaledRecPB.bufAt(0, 0), upscaledRecPB.stride, upscaledWidth, upscaledHeight, bitDepth);
-    }
-    else if (picRefLayer)
-    {
-      const CPelBuf& p = m_pcRefLayerRescaledPicYuv->get(compID);
-      const CPelBuf& o = org.get(compID);
+        metrics->upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10( (double)maxval * maxval * upscaledWidth * upscaledHeight / (double)upscaledSSD ) : 999.99;
+        metrics->upscaledMsssim[comp] = xCalculateMSSSIM (upscaledOrgPB.bufAt(0, 0), upscaledOrgPB.stride, upscaledRecPB.bufAt(0, 0), upscaledRecPB.stride, upscaledWidth, upscaledHeight, bitDepth);
+      }
+      else if (picRefLayer)
+      {
+        const CPelBuf& p = m_pcRefLayerRescaledPicYuv->get(compID);
+        const CPelBuf& o = org.get(compID);
 #if ENABLE_QPA
-      const uint64_t upscaledSSD = xFindDistortionPlane(p, o, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format), ::getComponentScaleY(compID, format));
+        const uint64_t upscaledSSD = xFindDistortionPlane(p, o, useWPSNR ? bitDepth : 0, ::getComponentScaleX(compID, format), ::getComponentScaleY(compID, format));
 #else
-      const uint64_t upscaledSSD = xFindDistortionPlane(p, o, 0);
+        const uint64_t upscaledSSD = xFindDistortionPlane(p, o, 0);
 #endif
-      upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10((double) fRefValue / (double) upscaledSSD) : 999.99;
-     }
-  }
+        metrics->upscaledPSNR[comp] = upscaledSSD ? 10.0 * log10((double) fRefValue / (double) upscaledSSD) : 999.99;
+       }
+    }
+  };
 
 #if EXTENSION_360_VIDEO
   m_ext360.calculatePSNRs(pcPic);
 #endif
 
 #if JVET_O0756_CALCULATE_HDRMETRICS
-  const bool calculateHdrMetrics = m_pcEncLib->getCalculateHdrMetrics();
-  if (calculateHdrMetrics)
+  if (m_pcEncLib->getCalculateHdrMetrics())
   {
     auto beforeTime = std::chrono::steady_clock::now();
-    xCalculateHDRMetrics(pcPic, deltaE, psnrL);
+    xCalculateHDRMetrics(pcPic, metrics->deltaE, metrics->psnrL);
     auto elapsed = std::chrono::steady_clock::now() - beforeTime;
     m_metricTime += elapsed;
   }
@@ -5373,63 +5349,98 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
   uint32_t uibits = numRBSPBytes * 8;
   m_rvm.push_back(uibits);
 
+  if (m_pcCfg->getBackgroundMetrics())
+  {
+    // the picture is reported by xFinishPictureMetrics() once the next picture has been coded
+    m_metricsJob    = std::async(std::launch::async, calculateMetrics);
+    m_metricsReport = [=]()
+    {
+      xReportPictureMetrics(pcPic, *metrics, uibits, dEncTime, printFrameMSE, printMSSSIM, isEncodeLtRef);
+    };
+  }
+  else
+  {
+    calculateMetrics();
+    xReportPictureMetrics(pcPic, *metrics, uibits, dEncTime, printFrameMSE, printMSSSIM, isEncodeLtRef);
+    *PSNR_Y = metrics->dPSNR[COMPONENT_Y];
+  }
+}
+
+void EncGOP::xFinishPictureMetrics()
+{
+  if (m_metricsJob.valid())
+  {
+    m_metricsJob.get();
+    m_metricsReport();
+    m_metricsReport = nullptr;
+  }
+}
+
+void EncGOP::xReportPictureMetrics(Picture *pcPic, const PictureMetrics &metrics, uint32_t uibits, double dEncTime,
+                                   const bool printFrameMSE, const bool printMSSSIM, bool isEncodeLtRef)
+{
+  const Slice* pcSlice = pcPic->slices[0];
+#if WCG_WPSNR
+  const bool   useLumaWPSNR = m_pcEncLib->getPrintWPSNR();
+#endif
+#if JVET_O0756_CALCULATE_HDRMETRICS
+  const bool   calculateHdrMetrics = m_pcEncLib->getCalculateHdrMetrics();
+#endif
+
   //===== add PSNR =====
-  m_gcAnalyzeAll.addResult(dPSNR, (double) uibits, mseYuvFrame, upscaledPSNR, msssim, upscaledMsssim, isEncodeLtRef);
+  m_gcAnalyzeAll.addResult(metrics.dPSNR, (double) uibits, metrics.mseYuvFrame, metrics.upscaledPSNR, metrics.msssim, metrics.upscaledMsssim, isEncodeLtRef);
 #if EXTENSION_360_VIDEO
   m_ext360.addResult(m_gcAnalyzeAll);
 #endif
 #if JVET_O0756_CALCULATE_HDRMETRICS
   if (calculateHdrMetrics)
   {
-    m_gcAnalyzeAll.addHDRMetricsResult(deltaE, psnrL);
+    m_gcAnalyzeAll.addHDRMetricsResult(metrics.deltaE, metrics.psnrL);
   }
 #endif
   if (pcSlice->isIntra())
   {
-    m_gcAnalyzeI.addResult(dPSNR, (double) uibits, mseYuvFrame, upscaledPSNR, msssim, upscaledMsssim, isEncodeLtRef);
-    *PSNR_Y = dPSNR[COMPONENT_Y];
+    m_gcAnalyzeI.addResult(metrics.dPSNR, (double) uibits, metrics.mseYuvFrame, metrics.upscaledPSNR, metrics.msssim, metrics.upscaledMsssim, isEncodeLtRef);
 #if EXTENSION_360_VIDEO
     m_ext360.addResult(m_gcAnalyzeI);
 #endif
 #if JVET_O0756_CALCULATE_HDRMETRICS
     if (calculateHdrMetrics)
     {
-      m_gcAnalyzeI.addHDRMetricsResult(deltaE, psnrL);
+      m_gcAnalyzeI.addHDRMetricsResult(metrics.deltaE, metrics.psnrL);
     }
 #endif
   }
   if (pcSlice->isInterP())
   {
-    m_gcAnalyzeP.addResult(dPSNR, (double) uibits, mseYuvFrame, upscaledPSNR, msssim, upscaledMsssim, isEncodeLtRef);
-    *PSNR_Y = dPSNR[COMPONENT_Y];
+    m_gcAnalyzeP.addResult(metrics.dPSNR, (double) uibits, metrics.mseYuvFrame, metrics.upscaledPSNR, metrics.msssim, metrics.upscaledMsssim, isEncodeLtRef);
 #if EXTENSION_360_VIDEO
     m_ext360.addResult(m_gcAnalyzeP);
 #endif
 #if JVET_O0756_CALCULATE_HDRMETRICS
     if (calculateHdrMetrics)
     {
-      m_gcAnalyzeP.addHDRMetricsResult(deltaE, psnrL);
+      m_gcAnalyzeP.addHDRMetricsResult(metrics.deltaE, metrics.psnrL);
     }
 #endif
   }
   if (pcSlice->isInterB())
   {
-    m_gcAnalyzeB.addResult(dPSNR, (double) uibits, mseYuvFrame, upscaledPSNR, msssim, upscaledMsssim, isEncodeLtRef);
-    *PSNR_Y = dPSNR[COMPONENT_Y];
+    m_gcAnalyzeB.addResult(metrics.dPSNR, (double) uibits, metrics.mseYuvFrame, metrics.upscaledPSNR, metrics.msssim, metrics.upscaledMsssim, isEncodeLtRef);
 #if EXTENSION_360_VIDEO
     m_ext360.addResult(m_gcAnalyzeB);
 #endif
 #if JVET_O0756_CALCULATE_HDRMETRICS
     if (calculateHdrMetrics)
     {
-      m_gcAnalyzeB.addHDRMetricsResult(deltaE, psnrL);
+      m_gcAnalyzeB.addHDRMetricsResult(metrics.deltaE, metrics.psnrL);
     }
 #endif
   }
 #if WCG_WPSNR
   if (useLumaWPSNR)
   {
-    m_gcAnalyzeWPSNR.addResult( dPSNRWeighted, (double)uibits, MSEyuvframeWeighted, upscaledPSNR, msssim, upscaledMsssim, isEncodeLtRef );
+    m_gcAnalyzeWPSNR.addResult( metrics.dPSNRWeighted, (double)uibits, metrics.MSEyuvframeWeighted, metrics.upscaledPSNR, metrics.msssim, metrics.upscaledMsssim, isEncodeLtRef );
   }
 #endif
 
@@ -5458,7 +5469,7 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
          pcSlice->getSliceQp(),
          uibits );
 
-    msg( NOTICE, " [Y %6.4lf dB    U %6.4lf dB    V %6.4lf dB]", dPSNR[COMPONENT_Y], dPSNR[COMPONENT_Cb], dPSNR[COMPONENT_Cr] );
+    msg( NOTICE, " [Y %6.4lf dB    U %6.4lf dB    V %6.4lf dB]", metrics.dPSNR[COMPONENT_Y], metrics.dPSNR[COMPONENT_Cb], metrics.dPSNR[COMPONENT_Cr] );
 
 #if EXTENSION_360_VIDEO
     m_ext360.printPerPOCInfo(NOTICE);
@@ -5469,7 +5480,7 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
       uint64_t xPsnr[MAX_NUM_COMPONENT];
       for (int i = 0; i < MAX_NUM_COMPONENT; i++)
       {
-        std::copy(reinterpret_cast<uint8_t *>(&dPSNR[i]), reinterpret_cast<uint8_t *>(&dPSNR[i]) + sizeof(dPSNR[i]),
+        std::copy(reinterpret_cast<const uint8_t *>(&metrics.dPSNR[i]), reinterpret_cast<const uint8_t *>(&metrics.dPSNR[i]) + sizeof(metrics.dPSNR[i]),
                   reinterpret_cast<uint8_t *>(&xPsnr[i]));
       }
       msg(NOTICE, " [xY %16" PRIx64 " xU %16" PRIx64 " xV %16" PRIx64 "]", xPsnr[COMPONENT_Y], xPsnr[COMPONENT_Cb], xPsnr[COMPONENT_Cr]);
@@ -5480,26 +5491,26 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
     }
     if (printMSSSIM)
     {
-      msg( NOTICE, " [MS-SSIM Y %1.6lf    U %1.6lf    V %1.6lf]", msssim[COMPONENT_Y], msssim[COMPONENT_Cb], msssim[COMPONENT_Cr] );
+      msg( NOTICE, " [MS-SSIM Y %1.6lf    U %1.6lf    V %1.6lf]", metrics.msssim[COMPONENT_Y], metrics.msssim[COMPONENT_Cb], metrics.msssim[COMPONENT_Cr] );
     }
 
     if( printFrameMSE )
     {
-      msg(NOTICE, " [Y MSE %6.4lf  U MSE %6.4lf  V MSE %6.4lf]", mseYuvFrame[COMPONENT_Y], mseYuvFrame[COMPONENT_Cb],
-          mseYuvFrame[COMPONENT_Cr]);
+      msg(NOTICE, " [Y MSE %6.4lf  U MSE %6.4lf  V MSE %6.4lf]", metrics.mseYuvFrame[COMPONENT_Y], metrics.mseYuvFrame[COMPONENT_Cb],
+          metrics.mseYuvFrame[COMPONENT_Cr]);
     }
 #if WCG_WPSNR
     if (useLumaWPSNR)
     {
-      msg(NOTICE, " [WY %6.4lf dB    WU %6.4lf dB    WV %6.4lf dB]", dPSNRWeighted[COMPONENT_Y], dPSNRWeighted[COMPONENT_Cb], dPSNRWeighted[COMPONENT_Cr]);
+      msg(NOTICE, " [WY %6.4lf dB    WU %6.4lf dB    WV %6.4lf dB]", metrics.dPSNRWeighted[COMPONENT_Y], metrics.dPSNRWeighted[COMPONENT_Cb], metrics.dPSNRWeighted[COMPONENT_Cr]);
 
       if (m_pcEncLib->getPrintHexPsnr())
       {
         uint64_t xPsnrWeighted[MAX_NUM_COMPONENT];
         for (int i = 0; i < MAX_NUM_COMPONENT; i++)
         {
-          std::copy(reinterpret_cast<uint8_t *>(&dPSNRWeighted[i]),
-                    reinterpret_cast<uint8_t *>(&dPSNRWeighted[i]) + sizeof(dPSNRWeighted[i]),
+          std::copy(reinterpret_cast<const uint8_t *>(&metrics.dPSNRWeighted[i]),
+                    reinterpret_cast<const uint8_t *>(&metrics.dPSNRWeighted[i]) + sizeof(metrics.dPSNRWeighted[i]),
                     reinterpret_cast<uint8_t *>(&xPsnrWeighted[i]));
         }
         msg(NOTICE, " [xWY %16" PRIx64 " xWU %16" PRIx64 " xWV %16" PRIx64 "]", xPsnrWeighted[COMPONENT_Y], xPsnrWeighted[COMPONENT_Cb], xPsnrWeighted[COMPONENT_Cr]);
@@ -5511,13 +5522,13 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
     {
       for (int i=0; i<1; i++)
       {
-        msg(NOTICE, " [DeltaE%d %6.4lf dB]", (int)m_pcCfg->getWhitePointDeltaE(i), deltaE[i]);
+        msg(NOTICE, " [DeltaE%d %6.4lf dB]", (int)m_pcCfg->getWhitePointDeltaE(i), metrics.deltaE[i]);
         if (m_pcEncLib->getPrintHexPsnr())
         {
           int64_t xdeltaE[MAX_NUM_COMPONENT];
           for (int i = 0; i < 1; i++)
           {
-            std::copy_n(reinterpret_cast<uint8_t*>(&deltaE[i]), sizeof(deltaE[i]),
+            std::copy_n(reinterpret_cast<const uint8_t*>(&metrics.deltaE[i]), sizeof(metrics.deltaE[i]),
                         reinterpret_cast<uint8_t*>(&xdeltaE[i]));
           }
           msg(NOTICE, " [xDeltaE%d %16" PRIx64 "]", (int)m_pcCfg->getWhitePointDeltaE(i), xdeltaE[0]);
@@ -5525,14 +5536,14 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
       }
       for (int i=0; i<1; i++)
       {
-        msg(NOTICE, " [PSNRL%d %6.4lf dB]", (int)m_pcCfg->getWhitePointDeltaE(i), psnrL[i]);
+        msg(NOTICE, " [PSNRL%d %6.4lf dB]", (int)m_pcCfg->getWhitePointDeltaE(i), metrics.psnrL[i]);
 
         if (m_pcEncLib->getPrintHexPsnr())
         {
           int64_t xpsnrL[MAX_NUM_COMPONENT];
           for (int i = 0; i < 1; i++)
           {
-            std::copy_n(reinterpret_cast<uint8_t*>(&psnrL[i]), sizeof(psnrL[i]),
+            std::copy_n(reinterpret_cast<const uint8_t*>(&metrics.psnrL[i]), sizeof(metrics.psnrL[i]),
                         reinterpret_cast<uint8_t*>(&xpsnrL[i]));
           }
 
@@ -5587,12 +5598,12 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
     }
     if (m_pcEncLib->isResChangeInClvsEnabled())
     {
-      msg( NOTICE, " [Y2 %6.4lf dB  U2 %6.4lf dB  V2 %6.4lf dB]", upscaledPSNR[COMPONENT_Y], upscaledPSNR[COMPONENT_Cb], upscaledPSNR[COMPONENT_Cr] );
-      msg( NOTICE, " MS-SSIM2: [Y %6.4lf  U %6.4lf  V %6.4lf ]", upscaledMsssim[COMPONENT_Y], upscaledMsssim[COMPONENT_Cb], upscaledMsssim[COMPONENT_Cr] );
+      msg( NOTICE, " [Y2 %6.4lf dB  U2 %6.4lf dB  V2 %6.4lf dB]", metrics.upscaledPSNR[COMPONENT_Y], metrics.upscaledPSNR[COMPONENT_Cb], metrics.upscaledPSNR[COMPONENT_Cr] );
+      msg( NOTICE, " MS-SSIM2: [Y %6.4lf  U %6.4lf  V %6.4lf ]", metrics.upscaledMsssim[COMPONENT_Y], metrics.upscaledMsssim[COMPONENT_Cb], metrics.upscaledMsssim[COMPONENT_Cr] );
     }
     else if (m_pcEncLib->isRefLayerRescaledAvailable())
     {
-      msg(NOTICE, " [Y2 %6.4lf dB  U2 %6.4lf dB  V2 %6.4lf dB]", upscaledPSNR[COMPONENT_Y], upscaledPSNR[COMPONENT_Cb], upscaledPSNR[COMPONENT_Cr]);
+      msg(NOTICE, " [Y2 %6.4lf dB  U2 %6.4lf dB  V2 %6.4lf dB]", metrics.upscaledPSNR[COMPONENT_Y], metrics.upscaledPSNR[COMPONENT_Cb], metrics.upscaledPSNR[COMPONENT_Cr]);
     } 
 
   }
@@ -5602,8 +5613,8 @@ void EncGOP::xCalculateAddPSNR(Picture* pcPic, PelUnitBuf cPicD, const AccessUni
     std::cout.flush();
   }
 #if GREEN_METADATA_SEI_ENABLED
-  m_SEIGreenQualityMetrics.ssim = msssim[0];
-  m_SEIGreenQualityMetrics.wpsnr = dPSNR[0];
+  m_SEIGreenQualityMetrics.ssim = metrics.msssim[0];
+  m_SEIGreenQualityMetrics.wpsnr = metrics.dPSNR[0];
 #endif
 }
 
@@ -5778,27 +5789,28 @@ double EncGOP::xCalculateMSSSIM(const Pel *org, const ptrdiff_t orgStride, const
 
   assert(maxScale>0 && maxScale<=MAX_MSSSIM_SCALE);
 
-  //Normalized Gaussian mask design, 11*11, s.d. 1.5
-  double weights[WEIGHTING_SIZE][WEIGHTING_SIZE];
-  double coeffSum=0.0;
-  for(int y=0; y<WEIGHTING_SIZE; y++)
+  // Normalized Gaussian mask design, 11*11, s.d. 1.5. The mask is separable, so it is applied as two 1-D passes with
+  // fixed-point taps; all window moments are then exact integers.
+  // Second-order moments need up to 2 * (bitDepth + FRAC_BITS + WEIGHT_BITS) bits and are kept in 64 bits.
+  const int FRAC_BITS   = 2;   // fractional bits of the downsampled samples
+  const int WEIGHT_BITS = bitDepth > 12 ? 12 : 16;
+
+  int    weights[WEIGHTING_SIZE];
+  double gaussian[WEIGHTING_SIZE];
+  double coeffSum = 0.0;
+  for (int i = 0; i < WEIGHTING_SIZE; i++)
   {
-    for(int x=0; x<WEIGHTING_SIZE; x++)
-    {
-      weights[y][x] =
-        exp(-((y - WEIGHTING_MID_TAP) * (y - WEIGHTING_MID_TAP) + (x - WEIGHTING_MID_TAP) * (x - WEIGHTING_MID_TAP))
-            / (WEIGHTING_MID_TAP - 0.5));
-      coeffSum += weights[y][x];
-    }
+    gaussian[i] = exp(-(i - WEIGHTING_MID_TAP) * (i - WEIGHTING_MID_TAP) / (WEIGHTING_MID_TAP - 0.5));
+    coeffSum += gaussian[i];
   }
 
-  for(int y=0; y<WEIGHTING_SIZE; y++)
+  int weightSum = 0;
+  for (int i = 0; i < WEIGHTING_SIZE; i++)
   {
-    for(int x=0; x<WEIGHTING_SIZE; x++)
-    {
-      weights[y][x] /=coeffSum;
-    }
+    weights[i] = int(gaussian[i] / coeffSum * (1 << WEIGHT_BITS) + 0.5);
+    weightSum += weights[i];
   }
+  weights[WEIGHTING_MID_TAP] += (1 << WEIGHT_BITS) - weightSum;
 
   //Resolution based weights
   const double exponentWeights[MAX_MSSSIM_SCALE][MAX_MSSSIM_SCALE] = {{1.0,    0,      0,      0,      0     },
@@ -5807,19 +5819,19 @@ double EncGOP::xCalculateMSSSIM(const Pel *org, const ptrdiff_t orgStride, const
                                                                       {0.0517, 0.3295, 0.3462, 0.2726, 0     },
                                                                       {0.0448, 0.2856, 0.3001, 0.2363, 0.1333}};
 
-  //Downsampling of data:
-  std::vector<double> original[MAX_MSSSIM_SCALE];
-  std::vector<double> recon[MAX_MSSSIM_SCALE];
+  // Downsampling of data: scale 0 holds the source samples, the other scales the average of each 2x2 sample with
+  // FRAC_BITS fractional bits
+  std::vector<int> original[MAX_MSSSIM_SCALE];
+  std::vector<int> recon[MAX_MSSSIM_SCALE];
 
   for(uint32_t scale=0; scale<maxScale; scale++)
   {
     const int scaledHeight = height >> scale;
     const int scaledWidth  = width  >> scale;
-    original[scale].resize(scaledHeight*scaledWidth, double(0));
-    recon[scale].resize(scaledHeight*scaledWidth, double(0));
+    original[scale].resize(scaledHeight*scaledWidth, 0);
+    recon[scale].resize(scaledHeight*scaledWidth, 0);
   }
 
-  // Initial [0] arrays to be a copy of the source data (but stored in array "double", not Pel array).
   for(int y=0; y<height; y++)
   {
     for(int x=0; x<width; x++)
@@ -5829,23 +5841,25 @@ double EncGOP::xCalculateMSSSIM(const Pel *org, const ptrdiff_t orgStride, const
     }
   }
 
-  // Set up other arrays to be average value of each 2x2 sample.
   for(uint32_t scale=1; scale<maxScale; scale++)
   {
     const int scaledHeight = height >> scale;
     const int scaledWidth  = width  >> scale;
+    const int srcWidth     = width  >> (scale - 1);
+    const int shift        = scale == 1 ? 0 : 2;
+    const int offset       = (1 << shift) >> 1;
     for(int y=0; y<scaledHeight; y++)
     {
+      const int *srcOrg = &original[scale - 1][2 * y * srcWidth];
+      const int *srcRec = &recon[scale - 1][2 * y * srcWidth];
       for(int x=0; x<scaledWidth; x++)
       {
-        original[scale][y*scaledWidth+x]= (original[scale-1][ 2*y   *(2*scaledWidth)+2*x  ] +
-                                           original[scale-1][ 2*y   *(2*scaledWidth)+2*x+1] +
-                                           original[scale-1][(2*y+1)*(2*scaledWidth)+2*x  ] +
-                                           original[scale-1][(2*y+1)*(2*scaledWidth)+2*x+1]) / 4.0;
-        recon[scale][y*scaledWidth+x]=    (   recon[scale-1][ 2*y   *(2*scaledWidth)+2*x  ] +
-                                              recon[scale-1][ 2*y   *(2*scaledWidth)+2*x+1] +
-                                              recon[scale-1][(2*y+1)*(2*scaledWidth)+2*x  ] +
-                                              recon[scale-1][(2*y+1)*(2*scaledWidth)+2*x+1]) / 4.0;
+        original[scale][y*scaledWidth+x] =
+          (srcOrg[2 * x] + srcOrg[2 * x + 1] + srcOrg[srcWidth + 2 * x] + srcOrg[srcWidth + 2 * x + 1] + offset)
+          >> shift;
+        recon[scale][y*scaledWidth+x] =
+          (srcRec[2 * x] + srcRec[2 * x + 1] + srcRec[srcWidth + 2 * x] + srcRec[srcWidth + 2 * x + 1] + offset)
+          >> shift;
       }
     }
   }
@@ -5855,6 +5869,9 @@ double EncGOP::xCalculateMSSSIM(const Pel *org, const ptrdiff_t orgStride, const
   const double c1        = (0.01*maxValue)*(0.01*maxValue);
   const double c2        = (0.03*maxValue)*(0.03*maxValue);
 
+  // window moments: org, rec, org^2, rec^2 and org*rec
+  const int NUM_MOMENTS = 5;
+
   double finalMSSSIM = 1.0;
 
   for(uint32_t scale=0; scale<maxScale; scale++)
@@ -5865,35 +5882,66 @@ double EncGOP::xCalculateMSSSIM(const Pel *org, const ptrdiff_t orgStride, const
     const int blocksPerColumn = scaledHeight-WEIGHTING_SIZE+1;
     const int totalBlocks     = blocksPerRow*blocksPerColumn;
 
+    const int    fracBits  = scale == 0 ? 0 : FRAC_BITS;
+    const double muScale   = 1.0 / double(int64_t(1) << (2 * WEIGHT_BITS + fracBits));
+    const double sqrScale  = 1.0 / double(int64_t(1) << (2 * WEIGHT_BITS + 2 * fracBits));
+
+    // horizontally filtered moments of the last WEIGHTING_SIZE rows
+    std::vector<int64_t> rowMoments(WEIGHTING_SIZE * NUM_MOMENTS * std::max(blocksPerRow, 0));
+
     double meanSSIM= 0.0;
 
-    for(int blockIndexY=0; blockIndexY<blocksPerColumn; blockIndexY++)
+    for (int y = 0; y < scaledHeight && blocksPerRow > 0; y++)
     {
-      for(int blockIndexX=0; blockIndexX<blocksPerRow; blockIndexX++)
+      const int *orgRow = &original[scale][y * scaledWidth];
+      const int *recRow = &recon[scale][y * scaledWidth];
+      int64_t   *hor    = &rowMoments[(y % WEIGHTING_SIZE) * NUM_MOMENTS * blocksPerRow];
+
+      for (int x = 0; x < blocksPerRow; x++)
       {
-        double muOrg          =0.0;
-        double muRec          =0.0;
-        double muOrigSqr      =0.0;
-        double muRecSqr       =0.0;
-        double muOrigMultRec  =0.0;
+        int64_t sumOrg = 0, sumRec = 0, sumOrgSqr = 0, sumRecSqr = 0, sumOrgRec = 0;
+        for (int i = 0; i < WEIGHTING_SIZE; i++)
+        {
+          const int64_t orgPel = orgRow[x + i];
+          const int64_t recPel = recRow[x + i];
+          sumOrg += weights[i] * orgPel;
+          sumRec += weights[i] * recPel;
+          sumOrgSqr += weights[i] * orgPel * orgPel;
+          sumRecSqr += weights[i] * recPel * recPel;
+          sumOrgRec += weights[i] * orgPel * recPel;
+        }
+        hor[0 * blocksPerRow + x] = sumOrg;
+        hor[1 * blocksPerRow + x] = sumRec;
+        hor[2 * blocksPerRow + x] = sumOrgSqr;
+        hor[3 * blocksPerRow + x] = sumRecSqr;
+        hor[4 * blocksPerRow + x] = sumOrgRec;
+      }
 
-        for(int y=0; y<WEIGHTING_SIZE; y++)
+      if (y < WEIGHTING_SIZE - 1)
+      {
+        continue;
+      }
+
+      const int blockIndexY = y - (WEIGHTING_SIZE - 1);
+
+      for(int blockIndexX=0; blockIndexX<blocksPerRow; blockIndexX++)
+      {
+        int64_t moments[NUM_MOMENTS] = { 0 };
+        for (int j = 0; j < WEIGHTING_SIZE; j++)
         {
-          for(int x=0;x<WEIGHTING_SIZE; x++)
+          const int64_t *ver = &rowMoments[((blockIndexY + j) % WEIGHTING_SIZE) * NUM_MOMENTS * blocksPerRow];
+          for (int m = 0; m < NUM_MOMENTS; m++)
           {
-            const double gaussianWeight=weights[y][x];
-            const int    sampleOffset=(blockIndexY+y)*scaledWidth+(blockIndexX+x);
-            const double orgPel=original[scale][sampleOffset];
-            const double recPel=   recon[scale][sampleOffset];
-
-            muOrg        +=orgPel*       gaussianWeight;
-            muRec        +=recPel*       gaussianWeight;
-            muOrigSqr    +=orgPel*orgPel*gaussianWeight;
-            muRecSqr     +=recPel*recPel*gaussianWeight;
-            muOrigMultRec+=orgPel*recPel*gaussianWeight;
+            moments[m] += weights[j] * ver[m * blocksPerRow + blockIndexX];
           }
         }
 
+        const double muOrg         = moments[0] * muScale;
+        const double muRec         = moments[1] * muScale;
+        const double muOrigSqr     = moments[2] * sqrScale;
+        const double muRecSqr      = moments[3] * sqrScale;
+        const double muOrigMultRec = moments[4] * sqrScale;
+
         const double sigmaSqrOrig = muOrigSqr    -(muOrg*muOrg);
         const double sigmaSqrRec  = muRecSqr     -(muRec*muRec);
         const double sigmaOrigRec = muOrigMultRec-(muOrg*muRec);
@@ -6330,22 +6378,26 @@ double EncGOP::xCalculateRVM()
   return( dRVM );
 }
 
-/** Attaches the input bitstream to the stream in the output NAL unit
-    Updates rNalu to contain concatenated bitstream. rpcBitstreamRedirect is cleared at the end of this function call.
- *  \param codedSliceData contains the coded slice data (bitstream) to be concatenated to rNalu
+/** Attaches the coded substreams of a slice to the stream in the output NAL unit
+    Updates rNalu to contain the slice header followed by the concatenated substreams, which are cleared.
  *  \param rNalu          target NAL unit
+ *  \param substreams     coded substreams of the slice, each ending byte aligned
+ *  \param numSubstreams  number of substreams to be attached
  */
-void EncGOP::xAttachSliceDataToNalUnit (OutputNALUnit& rNalu, OutputBitstream* codedSliceData)
+void EncGOP::xAttachSliceDataToNalUnit (OutputNALUnit& rNalu, std::vector<OutputBitstream>& substreams, int numSubstreams)
 {
   // Byte-align
   rNalu.m_bitstream.writeByteAlignment();   // Slice header byte-alignment
 
-  // Perform bitstream concatenation
-  if (codedSliceData->getNumberOfWrittenBits() > 0)
+  // Perform bitstream concatenation directly, the entry points have been written already
+  for (int idx = 0; idx < numSubstreams; idx++)
   {
-    rNalu.m_bitstream.addSubstream(codedSliceData);
+    if (substreams[idx].getNumberOfWrittenBits() > 0)
+    {
+      rNalu.m_bitstream.addSubstream(&substreams[idx]);
+    }
+    substreams[idx].clear();
   }
-  codedSliceData->clear();
 }
 
 
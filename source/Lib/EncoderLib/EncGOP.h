@@ -39,6 +39,8 @@
 #define __ENCGOP__
 
 #include <list>
+#include <functional>
+#include <future>
 
 #include <stdlib.h>
 
@@ -193,6 +195,25 @@ private:
   } m_deblockParam[MAX_ENCODER_DEBLOCKING_QUALITY_LAYERS];
   PelStorage*             m_pcRefLayerRescaledPicYuv;
 
+  struct PictureMetrics
+  {
+    double dPSNR[MAX_NUM_COMPONENT];
+    double mseYuvFrame[MAX_NUM_COMPONENT];
+    double msssim[MAX_NUM_COMPONENT];
+    double upscaledPSNR[MAX_NUM_COMPONENT];
+    double upscaledMsssim[MAX_NUM_COMPONENT];
+#if WCG_WPSNR
+    double dPSNRWeighted[MAX_NUM_COMPONENT];
+    double MSEyuvframeWeighted[MAX_NUM_COMPONENT];
+#endif
+#if JVET_O0756_CALCULATE_HDRMETRICS
+    double deltaE[hdrtoolslib::NB_REF_WHITE];
+    double psnrL[hdrtoolslib::NB_REF_WHITE];
+#endif
+  };
+  std::future<void>       m_metricsJob;       ///< computes the metrics of the last coded picture with BackgroundMetrics
+  std::function<void()>   m_metricsReport;    ///< accumulates and prints the metrics of the last coded picture once m_metricsJob has finished
+
   // members needed for adaptive max BT size
   struct BlkStat
   {
@@ -244,7 +265,7 @@ public:
   void  compressGOP(int pocLast, int numPicRcvd, PicList &rcListPic, std::list<PelUnitBuf *> &rcListPicYuvRec,
                     bool isField, bool isTff, const InputColourSpaceConversion snr_conversion, const bool printFrameMSE,
                     bool printMSSSIM, bool isEncodeLtRef, const int picIdInGOP);
-  void  xAttachSliceDataToNalUnit (OutputNALUnit& rNalu, OutputBitstream* pcBitstreamRedirect);
+  void  xAttachSliceDataToNalUnit (OutputNALUnit& rNalu, std::vector<OutputBitstream>& substreams, int numSubstreams);
 
 
   int   getGOPSize()          { return  m_iGopSize;  }
@@ -320,6 +341,9 @@ protected:
   void     xCalculateAddPSNR(Picture *pcPic, PelUnitBuf cPicD, const AccessUnit &, double dEncTime,
                              const InputColourSpaceConversion snr_conversion, const bool printFrameMSE,
                              const bool printMSSSIM, double *PSNR_Y, bool isEncodeLtRef);
+  void     xReportPictureMetrics(Picture *pcPic, const PictureMetrics &metrics, uint32_t uibits, double dEncTime,
+                                 const bool printFrameMSE, const bool printMSSSIM, bool isEncodeLtRef);
+  void     xFinishPictureMetrics();
   void     xCalculateInterlacedAddPSNR(Picture *pcPicOrgFirstField, Picture *pcPicOrgSecondField,
                                        PelUnitBuf cPicRecFirstField, PelUnitBuf cPicRecSecondField,
                                        const InputColourSpaceConversion snr_conversion, const bool printFrameMSE,
@@ -332,7 +356,8 @@ protected:
 #endif
                              );
 #if WCG_WPSNR
-  double xFindDistortionPlaneWPSNR(const CPelBuf& pic0, const CPelBuf& pic1, const uint32_t rshift, const CPelBuf& picLuma0, ComponentID compID, const ChromaFormat chfmt );
+  double xFindDistortionPlaneWPSNR(const CPelBuf& pic0, const CPelBuf& pic1, const uint32_t rshift, const CPelBuf& picLuma0, ComponentID compID, const ChromaFormat chfmt,
+                                   const std::vector<double>& lumaLevelWeights );
 #endif
   double xCalculateRVM();
 
@@ -77,6 +77,9 @@ EncLib::EncLib(EncLibCommon *encLibCommon)
 #if ENABLE_SIMD_OPT_BUFFER
   g_pelBufOP.initPelBufOpsX86();
 #endif
+#if ENABLE_SIMD_OPT_HASH
+  g_hashOps.initHashOpsX86();
+#endif
 
 #if JVET_O0756_CALCULATE_HDRMETRICS
   m_metricTime = std::chrono::milliseconds(0);
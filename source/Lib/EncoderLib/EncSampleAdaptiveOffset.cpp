@@ -1165,26 +1165,35 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
       endX   = !isCalculatePreDeblockSamples ? (isRightAvail ? (width - skipLinesR[typeIdx]) : (width - 1))
                                              : (isRightAvail ? width : (width - 1));
 
-      for (y = 0; y < endY; y++)
+      if (!isCtuCrossedByVirtualBoundaries)
       {
-        signLeft = (int8_t) sgn(srcLine[startX] - srcLine[startX - 1]);
-        for (x = startX; x < endX; x++)
+        m_calcEdgeStats(srcLine + startX, srcStride, orgLine + startX, orgStride, endX - startX, endY, -1, 1, diff,
+                        count);
+        srcLine += std::max(endY, 0) * srcStride;
+        orgLine += std::max(endY, 0) * orgStride;
+      }
+      else
+      {
+        for (y = 0; y < endY; y++)
         {
-          signRight = (int8_t) sgn(srcLine[x] - srcLine[x + 1]);
-          if (isCtuCrossedByVirtualBoundaries
-              && isProcessDisabled(x, y, numVerVirBndry, 0, verVirBndryPos, horVirBndryPos))
+          signLeft = (int8_t) sgn(srcLine[startX] - srcLine[startX - 1]);
+          for (x = startX; x < endX; x++)
           {
+            signRight = (int8_t) sgn(srcLine[x] - srcLine[x + 1]);
+            if (isProcessDisabled(x, y, numVerVirBndry, 0, verVirBndryPos, horVirBndryPos))
+            {
+              signLeft = -signRight;
+              continue;
+            }
+            edgeType = signRight + signLeft;
             signLeft = -signRight;
-            continue;
-          }
-          edgeType = signRight + signLeft;
-          signLeft = -signRight;
 
-          diff[edgeType] += (orgLine[x] - srcLine[x]);
-          count[edgeType]++;
+            diff[edgeType] += (orgLine[x] - srcLine[x]);
+            count[edgeType]++;
+          }
+          srcLine += srcStride;
+          orgLine += orgStride;
         }
-        srcLine += srcStride;
-        orgLine += orgStride;
       }
       if (isCalculatePreDeblockSamples)
       {
@@ -1234,34 +1243,44 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
         orgLine += orgStride;
       }
 
-      Pel *srcLineAbove = srcLine - srcStride;
-      for (x = startX; x < endX; x++)
+      Pel *srcLineAbove;
+      Pel *srcLineBelow;
+      if (!isCtuCrossedByVirtualBoundaries)
       {
-        signUpLine[x] = (int8_t) sgn(srcLine[x] - srcLineAbove[x]);
+        m_calcEdgeStats(srcLine + startX, srcStride, orgLine + startX, orgStride, endX - startX, endY - startY,
+                        -srcStride, srcStride, diff, count);
+        srcLine += std::max(endY - startY, 0) * srcStride;
+        orgLine += std::max(endY - startY, 0) * orgStride;
       }
-
-      Pel *srcLineBelow;
-      for (y = startY; y < endY; y++)
+      else
       {
-        srcLineBelow = srcLine + srcStride;
-
+        srcLineAbove = srcLine - srcStride;
         for (x = startX; x < endX; x++)
         {
-          signDown = (int8_t) sgn(srcLine[x] - srcLineBelow[x]);
-          if (isCtuCrossedByVirtualBoundaries
-              && isProcessDisabled(x, y, 0, numHorVirBndry, verVirBndryPos, horVirBndryPos))
+          signUpLine[x] = (int8_t) sgn(srcLine[x] - srcLineAbove[x]);
+        }
+
+        for (y = startY; y < endY; y++)
+        {
+          srcLineBelow = srcLine + srcStride;
+
+          for (x = startX; x < endX; x++)
           {
+            signDown = (int8_t) sgn(srcLine[x] - srcLineBelow[x]);
+            if (isProcessDisabled(x, y, 0, numHorVirBndry, verVirBndryPos, horVirBndryPos))
+            {
+              signUpLine[x] = -signDown;
+              continue;
+            }
+            edgeType      = signDown + signUpLine[x];
             signUpLine[x] = -signDown;
-            continue;
-          }
-          edgeType      = signDown + signUpLine[x];
-          signUpLine[x] = -signDown;
 
-          diff[edgeType] += (orgLine[x] - srcLine[x]);
-          count[edgeType]++;
+            diff[edgeType] += (orgLine[x] - srcLine[x]);
+            count[edgeType]++;
+          }
+          srcLine += srcStride;
+          orgLine += orgStride;
         }
-        srcLine += srcStride;
-        orgLine += orgStride;
       }
       if (isCalculatePreDeblockSamples)
       {
@@ -1309,59 +1328,76 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
                                              : (isRightAvail ? width : (width - 1));
       endY = isBelowAvail ? (height - skipLinesB[typeIdx]) : (height - 1);
 
-      // prepare 2nd line's upper sign
-      Pel *srcLineBelow = srcLine + srcStride;
-      for (x = startX; x < endX + 1; x++)
+      Pel *srcLineAbove;
+      Pel *srcLineBelow;
+      firstLineStartX = (!isCalculatePreDeblockSamples) ? (isAboveLeftAvail ? 0 : 1) : startX;
+      firstLineEndX   = (!isCalculatePreDeblockSamples) ? (isAboveAvail ? endX : 1) : endX;
+      if (!isCtuCrossedByVirtualBoundaries)
       {
-        signUpLine[x] = (int8_t) sgn(srcLineBelow[x] - srcLine[x - 1]);
-      }
+        // 1st line
+        m_calcEdgeStats(srcLine + firstLineStartX, srcStride, orgLine + firstLineStartX, orgStride,
+                        firstLineEndX - firstLineStartX, 1, -srcStride - 1, srcStride + 1, diff, count);
+        srcLine += srcStride;
+        orgLine += orgStride;
 
-      // 1st line
-      Pel *srcLineAbove = srcLine - srcStride;
-      firstLineStartX   = (!isCalculatePreDeblockSamples) ? (isAboveLeftAvail ? 0 : 1) : startX;
-      firstLineEndX     = (!isCalculatePreDeblockSamples) ? (isAboveAvail ? endX : 1) : endX;
-      for (x = firstLineStartX; x < firstLineEndX; x++)
-      {
-        if (isCtuCrossedByVirtualBoundaries
-            && isProcessDisabled(x, 0, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
-        {
-          continue;
-        }
-        edgeType = sgn(srcLine[x] - srcLineAbove[x - 1]) - signUpLine[x + 1];
-        diff[edgeType] += (orgLine[x] - srcLine[x]);
-        count[edgeType]++;
+        // middle lines
+        m_calcEdgeStats(srcLine + startX, srcStride, orgLine + startX, orgStride, endX - startX, endY - 1,
+                        -srcStride - 1, srcStride + 1, diff, count);
+        srcLine += std::max(endY - 1, 0) * srcStride;
+        orgLine += std::max(endY - 1, 0) * orgStride;
       }
-      srcLine += srcStride;
-      orgLine += orgStride;
-
-      // middle lines
-      for (y = 1; y < endY; y++)
+      else
       {
+        // prepare 2nd line's upper sign
         srcLineBelow = srcLine + srcStride;
+        for (x = startX; x < endX + 1; x++)
+        {
+          signUpLine[x] = (int8_t) sgn(srcLineBelow[x] - srcLine[x - 1]);
+        }
 
-        for (x = startX; x < endX; x++)
+        // 1st line
+        srcLineAbove = srcLine - srcStride;
+        for (x = firstLineStartX; x < firstLineEndX; x++)
         {
-          signDown = (int8_t) sgn(srcLine[x] - srcLineBelow[x + 1]);
-          if (isCtuCrossedByVirtualBoundaries
-              && isProcessDisabled(x, y, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
+          if (isProcessDisabled(x, 0, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
           {
-            signDownLine[x + 1] = -signDown;
             continue;
           }
-          edgeType = signDown + signUpLine[x];
-          diff [edgeType] += (orgLine[x] - srcLine[x]);
-          count[edgeType] ++;
-
-          signDownLine[x + 1] = -signDown;
+          edgeType = sgn(srcLine[x] - srcLineAbove[x - 1]) - signUpLine[x + 1];
+          diff[edgeType] += (orgLine[x] - srcLine[x]);
+          count[edgeType]++;
         }
-        signDownLine[startX] = (int8_t) sgn(srcLineBelow[startX] - srcLine[startX - 1]);
-
-        signTmpLine  = signUpLine;
-        signUpLine   = signDownLine;
-        signDownLine = signTmpLine;
-
         srcLine += srcStride;
         orgLine += orgStride;
+
+        // middle lines
+        for (y = 1; y < endY; y++)
+        {
+          srcLineBelow = srcLine + srcStride;
+
+          for (x = startX; x < endX; x++)
+          {
+            signDown = (int8_t) sgn(srcLine[x] - srcLineBelow[x + 1]);
+            if (isProcessDisabled(x, y, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
+            {
+              signDownLine[x + 1] = -signDown;
+              continue;
+            }
+            edgeType = signDown + signUpLine[x];
+            diff [edgeType] += (orgLine[x] - srcLine[x]);
+            count[edgeType] ++;
+
+            signDownLine[x + 1] = -signDown;
+          }
+          signDownLine[startX] = (int8_t) sgn(srcLineBelow[startX] - srcLine[startX - 1]);
+
+          signTmpLine  = signUpLine;
+          signUpLine   = signDownLine;
+          signDownLine = signTmpLine;
+
+          srcLine += srcStride;
+          orgLine += orgStride;
+        }
       }
       if (isCalculatePreDeblockSamples)
       {
@@ -1405,58 +1441,74 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
                                                : (isRightAvail ? width : (width - 1));
       endY   = isBelowAvail ? (height - skipLinesB[typeIdx]) : (height - 1);
 
-      // prepare 2nd line upper sign
-      Pel *srcLineBelow = srcLine + srcStride;
-      for (x = startX - 1; x < endX; x++)
-      {
-        signUpLine[x + 1] = (int8_t) sgn(srcLineBelow[x] - srcLine[x + 1]);
-      }
-
-      // first line
-      Pel *srcLineAbove = srcLine - srcStride;
-
+      Pel *srcLineAbove;
+      Pel *srcLineBelow;
       firstLineStartX = !isCalculatePreDeblockSamples ? (isAboveAvail ? startX : endX) : startX;
       firstLineEndX   = !isCalculatePreDeblockSamples ? (!isRightAvail && isAboveRightAvail ? width : endX) : endX;
+      if (!isCtuCrossedByVirtualBoundaries)
+      {
+        // 1st line
+        m_calcEdgeStats(srcLine + firstLineStartX, srcStride, orgLine + firstLineStartX, orgStride,
+                        firstLineEndX - firstLineStartX, 1, -(srcStride - 1), srcStride - 1, diff, count);
+        srcLine += srcStride;
+        orgLine += orgStride;
 
-      for (x = firstLineStartX; x < firstLineEndX; x++)
+        // middle lines
+        m_calcEdgeStats(srcLine + startX, srcStride, orgLine + startX, orgStride, endX - startX, endY - 1,
+                        -(srcStride - 1), srcStride - 1, diff, count);
+        srcLine += std::max(endY - 1, 0) * srcStride;
+        orgLine += std::max(endY - 1, 0) * orgStride;
+      }
+      else
       {
-        if (isCtuCrossedByVirtualBoundaries
-            && isProcessDisabled(x, 0, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
+        // prepare 2nd line upper sign
+        srcLineBelow = srcLine + srcStride;
+        for (x = startX - 1; x < endX; x++)
         {
-          continue;
+          signUpLine[x + 1] = (int8_t) sgn(srcLineBelow[x] - srcLine[x + 1]);
         }
-        edgeType = sgn(srcLine[x] - srcLineAbove[x + 1]) - signUpLine[x];
-        diff[edgeType] += (orgLine[x] - srcLine[x]);
-        count[edgeType]++;
-      }
 
-      srcLine += srcStride;
-      orgLine += orgStride;
+        // first line
+        srcLineAbove = srcLine - srcStride;
 
-      // middle lines
-      for (y = 1; y < endY; y++)
-      {
-        srcLineBelow = srcLine + srcStride;
-
-        for (x = startX; x < endX; x++)
+        for (x = firstLineStartX; x < firstLineEndX; x++)
         {
-          signDown = (int8_t) sgn(srcLine[x] - srcLineBelow[x - 1]);
-          if (isCtuCrossedByVirtualBoundaries
-              && isProcessDisabled(x, y, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
+          if (isProcessDisabled(x, 0, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
           {
-            signUpLine[x] = -signDown;
             continue;
           }
-          edgeType = signDown + signUpLine[x + 1];
-
-          diff [edgeType] += (orgLine[x] - srcLine[x]);
+          edgeType = sgn(srcLine[x] - srcLineAbove[x + 1]) - signUpLine[x];
+          diff[edgeType] += (orgLine[x] - srcLine[x]);
           count[edgeType]++;
-
-          signUpLine[x] = -signDown;
         }
-        signUpLine[endX] = (int8_t) sgn(srcLineBelow[endX - 1] - srcLine[endX]);
+
         srcLine += srcStride;
         orgLine += orgStride;
+
+        // middle lines
+        for (y = 1; y < endY; y++)
+        {
+          srcLineBelow = srcLine + srcStride;
+
+          for (x = startX; x < endX; x++)
+          {
+            signDown = (int8_t) sgn(srcLine[x] - srcLineBelow[x - 1]);
+            if (isProcessDisabled(x, y, numVerVirBndry, numHorVirBndry, verVirBndryPos, horVirBndryPos))
+            {
+              signUpLine[x] = -signDown;
+              continue;
+            }
+            edgeType = signDown + signUpLine[x + 1];
+
+            diff [edgeType] += (orgLine[x] - srcLine[x]);
+            count[edgeType]++;
+
+            signUpLine[x] = -signDown;
+          }
+          signUpLine[endX] = (int8_t) sgn(srcLineBelow[endX - 1] - srcLine[endX]);
+          srcLine += srcStride;
+          orgLine += orgStride;
+        }
       }
       if (isCalculatePreDeblockSamples)
       {
@@ -1495,17 +1547,10 @@ void EncSampleAdaptiveOffset::getBlkStats(const ComponentID compIdx, const int c
       endY   = isBelowAvail ? (height - skipLinesB[typeIdx]) : height;
 
       const int shiftBits = channelBitDepth - NUM_SAO_BO_CLASSES_LOG2;
-      for (y = 0; y < endY; y++)
-      {
-        for (x = startX; x < endX; x++)
-        {
-          const int bandIdx = srcLine[x] >> shiftBits;
-          diff[bandIdx] += (orgLine[x] - srcLine[x]);
-          count[bandIdx]++;
-        }
-        srcLine += srcStride;
-        orgLine += orgStride;
-      }
+      m_calcBandStats(srcLine + startX, srcStride, orgLine + startX, orgStride, endX - startX, endY, shiftBits, diff,
+                      count);
+      srcLine += std::max(endY, 0) * srcStride;
+      orgLine += std::max(endY, 0) * orgStride;
       if (isCalculatePreDeblockSamples)
       {
         if (isBelowAvail)
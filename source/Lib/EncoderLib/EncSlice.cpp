@@ -46,6 +46,10 @@
 
 
 #include <math.h>
+#if ENABLE_PARALLEL_TILE_WRITING
+#include <atomic>
+#include <future>
+#endif
 
 //! \ingroup EncoderLib
 //! \{
@@ -2005,7 +2009,6 @@ void EncSlice::encodeSlice   ( Picture* pcPic, OutputBitstream* pcSubstreams, ui
   Slice *const pcSlice                 = pcPic->slices[getSliceSegmentIdx()];
   const bool wavefrontsEnabled         = pcSlice->getSPS()->getEntropyCodingSyncEnabledFlag();
   const bool entryPointsPresentFlag    = pcSlice->getSPS()->getEntryPointsPresentFlag();
-  uint32_t substreamSize               = 0;
   pcSlice->resetNumberOfSubstream();
 
 
@@ -2023,90 +2026,109 @@ void EncSlice::encodeSlice   ( Picture* pcPic, OutputBitstream* pcSubstreams, ui
   const uint32_t widthInCtus   = pcv.widthInCtus;
   uint32_t uiSubStrm = 0;
 
-  // for every CTU in the slice...
-  for( uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++ )
+#if ENABLE_PARALLEL_TILE_WRITING
+  // without WPP, each tile is a substream that starts from the initial contexts, the slice QP and an empty palette
+  // predictor, so the tiles of the slice can be written concurrently
+  if (m_pcCfg->getNumTileWriterThreads() > 1 && !wavefrontsEnabled && pcSlice->getNumTilesInSlice() > 1)
+  {
+    uiSubStrm = xEncodeTileSubstreams(pcPic, pcSubstreams, numBinsCoded);
+  }
+  else
+#endif
   {
-    const uint32_t ctuRsAddr = pcSlice->getCtuAddrInSlice( ctuIdx );
-    const uint32_t ctuXPosInCtus        = ctuRsAddr % widthInCtus;
-    const uint32_t ctuYPosInCtus        = ctuRsAddr / widthInCtus;
-
-    DTRACE_UPDATE( g_trace_ctx, std::make_pair( "ctu", ctuRsAddr ) );
-
-    const Position pos (ctuXPosInCtus * pcv.maxCUWidth, ctuYPosInCtus * pcv.maxCUHeight);
-    const UnitArea ctuArea (cs.area.chromaFormat, Area(pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight));
     m_CABACWriter->initBitstream( &pcSubstreams[uiSubStrm] );
 
-    // set up CABAC contexts' state for this CTU
-    if ( cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && cs.pps->ctuIsTileRowBd( ctuYPosInCtus ) )
+    // for every CTU in the slice...
+    for( uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++ )
     {
-      if (ctuIdx != 0) // if it is the first CTU, then the entropy coder has already been reset
+      const uint32_t ctuRsAddr = pcSlice->getCtuAddrInSlice( ctuIdx );
+      const uint32_t ctuXPosInCtus        = ctuRsAddr % widthInCtus;
+      const uint32_t ctuYPosInCtus        = ctuRsAddr / widthInCtus;
+
+      DTRACE_UPDATE( g_trace_ctx, std::make_pair( "ctu", ctuRsAddr ) );
+
+      const Position pos (ctuXPosInCtus * pcv.maxCUWidth, ctuYPosInCtus * pcv.maxCUHeight);
+      const UnitArea ctuArea (cs.area.chromaFormat, Area(pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight));
+
+      // set up CABAC contexts' state for this CTU
+      if ( cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && cs.pps->ctuIsTileRowBd( ctuYPosInCtus ) )
       {
-        numBinsCoded += m_CABACWriter->getNumBins();
-        m_CABACWriter->initCtxModels( *pcSlice );
-        cs.resetPrevPLT(cs.prevPLT);
+        if (ctuIdx != 0) // if it is the first CTU, then the entropy coder has already been reset
+        {
+          numBinsCoded += m_CABACWriter->getNumBins();
+          m_CABACWriter->initCtxModels( *pcSlice );
+          cs.resetPrevPLT(cs.prevPLT);
+        }
+        pcPic->m_prevQP.fill(pcSlice->getSliceQp());
       }
-    }
-    else if (cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && wavefrontsEnabled)
-    {
-      // Synchronize cabac probabilities with upper CTU if it's available and at the start of a line.
-      if (ctuIdx != 0) // if it is the first CTU, then the entropy coder has already been reset
+      else if (cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && wavefrontsEnabled)
       {
-        numBinsCoded += m_CABACWriter->getNumBins();
-        m_CABACWriter->initCtxModels( *pcSlice );
-        cs.resetPrevPLT(cs.prevPLT);
+        // Synchronize cabac probabilities with upper CTU if it's available and at the start of a line.
+        if (ctuIdx != 0) // if it is the first CTU, then the entropy coder has already been reset
+        {
+          numBinsCoded += m_CABACWriter->getNumBins();
+          m_CABACWriter->initCtxModels( *pcSlice );
+          cs.resetPrevPLT(cs.prevPLT);
+        }
+        if (cs.getCURestricted(pos.offset(0, -1), pos, pcSlice->getIndependentSliceIdx(), cs.pps->getTileIdx(pos),
+                               ChannelType::LUMA))
+        {
+          // Top is available, so use it.
+          m_CABACWriter->getCtx() = m_entropyCodingSyncContextState;
+          m_CABACWriter->getCtx().riceStatReset(
+            pcSlice->getSPS()->getBitDepth(ChannelType::LUMA),
+            pcSlice->getSPS()->getSpsRangeExtension().getPersistentRiceAdaptationEnabledFlag());
+          cs.setPrevPLT(m_palettePredictorSyncState);
+        }
+        pcPic->m_prevQP.fill(pcSlice->getSliceQp());
       }
-      if (cs.getCURestricted(pos.offset(0, -1), pos, pcSlice->getIndependentSliceIdx(), cs.pps->getTileIdx(pos),
-                             ChannelType::LUMA))
+
+      bool updateBcwCodingOrder = cs.slice->getSliceType() == B_SLICE && ctuIdx == 0;
+      if( updateBcwCodingOrder )
       {
-        // Top is available, so use it.
-        m_CABACWriter->getCtx() = m_entropyCodingSyncContextState;
-        m_CABACWriter->getCtx().riceStatReset(
-          pcSlice->getSPS()->getBitDepth(ChannelType::LUMA),
-          pcSlice->getSPS()->getSpsRangeExtension().getPersistentRiceAdaptationEnabledFlag());
-        cs.setPrevPLT(m_palettePredictorSyncState);
+        resetBcwCodingOrder(false, cs);
       }
-    }
-
-    bool updateBcwCodingOrder = cs.slice->getSliceType() == B_SLICE && ctuIdx == 0;
-    if( updateBcwCodingOrder )
-    {
-      resetBcwCodingOrder(false, cs);
-    }
 
-    m_CABACWriter->coding_tree_unit( cs, ctuArea, pcPic->m_prevQP, ctuRsAddr );
+      m_CABACWriter->coding_tree_unit( cs, ctuArea, pcPic->m_prevQP, ctuRsAddr );
 
-    // store probabilities of first CTU in line into buffer
-    if( cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && wavefrontsEnabled )
-    {
-      m_entropyCodingSyncContextState = m_CABACWriter->getCtx();
-      cs.storePrevPLT(m_palettePredictorSyncState);
-    }
+      // store probabilities of first CTU in line into buffer
+      if( cs.pps->ctuIsTileColBd( ctuXPosInCtus ) && wavefrontsEnabled )
+      {
+        m_entropyCodingSyncContextState = m_CABACWriter->getCtx();
+        cs.storePrevPLT(m_palettePredictorSyncState);
+      }
 
-    // terminate the sub-stream, if required (end of slice-segment, end of tile, end of wavefront-CTU-row):
-    bool isLastCTUsinSlice = ctuIdx == pcSlice->getNumCtuInSlice()-1;
-    bool isLastCTUinTile  = !isLastCTUsinSlice && cs.pps->getTileIdx( ctuRsAddr ) != cs.pps->getTileIdx( pcSlice->getCtuAddrInSlice( ctuIdx + 1 ) );
-    bool isLastCTUinWPP    = !isLastCTUsinSlice && !isLastCTUinTile && wavefrontsEnabled && cs.pps->ctuIsTileColBd( pcSlice->getCtuAddrInSlice( ctuIdx + 1 ) % cs.pps->getPicWidthInCtu() );
-    if (isLastCTUsinSlice || isLastCTUinTile || isLastCTUinWPP )         // this the the last CTU of the slice, tile, or WPP
-    {
-      m_CABACWriter->end_of_slice();  // end_of_slice_one_bit, end_of_tile_one_bit, or end_of_subset_one_bit
+      // terminate the sub-stream, if required (end of slice-segment, end of tile, end of wavefront-CTU-row):
+      bool isLastCTUsinSlice = ctuIdx == pcSlice->getNumCtuInSlice()-1;
+      bool isLastCTUinTile  = !isLastCTUsinSlice && cs.pps->getTileIdx( ctuRsAddr ) != cs.pps->getTileIdx( pcSlice->getCtuAddrInSlice( ctuIdx + 1 ) );
+      bool isLastCTUinWPP    = !isLastCTUsinSlice && !isLastCTUinTile && wavefrontsEnabled && cs.pps->ctuIsTileColBd( pcSlice->getCtuAddrInSlice( ctuIdx + 1 ) % cs.pps->getPicWidthInCtu() );
+      if (isLastCTUsinSlice || isLastCTUinTile || isLastCTUinWPP )         // this the the last CTU of the slice, tile, or WPP
+      {
+        m_CABACWriter->end_of_slice();  // end_of_slice_one_bit, end_of_tile_one_bit, or end_of_subset_one_bit
 
-      // Byte-alignment in slice_data() when new tile
-      pcSubstreams[uiSubStrm].writeByteAlignment();
+        // Byte-alignment in slice_data() when new tile
+        pcSubstreams[uiSubStrm].writeByteAlignment();
 
-      if (!isLastCTUsinSlice) //Byte alignment only when it is not the last substream in the slice
-      {
-        // write sub-stream size
-        substreamSize += (pcSubstreams[uiSubStrm].getNumberOfWrittenBits() >> 3) + pcSubstreams[uiSubStrm].countStartCodeEmulations();
-        pcSlice->increaseNumberOfSubstream();
-        if( entryPointsPresentFlag )
+        // the substream is complete, the next one gets its own bitstream
+        uiSubStrm++;
+        if (!isLastCTUsinSlice)
         {
-          pcSlice->addSubstreamSize(substreamSize);
-          substreamSize = 0;
+          m_CABACWriter->initBitstream( &pcSubstreams[uiSubStrm] );
         }
       }
-      uiSubStrm++;
+    } // CTU-loop
+    numBinsCoded += m_CABACWriter->getNumBins();
+  }
+
+  // entry points: sizes of all but the last substream, including emulation prevention bytes
+  for (uint32_t idx = 0; idx + 1 < uiSubStrm; idx++)
+  {
+    pcSlice->increaseNumberOfSubstream();
+    if( entryPointsPresentFlag )
+    {
+      pcSlice->addSubstreamSize((pcSubstreams[idx].getNumberOfWrittenBits() >> 3) + pcSubstreams[idx].countStartCodeEmulations());
     }
-  } // CTU-loop
+  }
 
 
   if(pcSlice->getPPS()->getCabacInitPresentFlag())
@@ -2117,9 +2139,107 @@ void EncSlice::encodeSlice   ( Picture* pcPic, OutputBitstream* pcSubstreams, ui
   {
     m_encCABACTableIdx = pcSlice->getSliceType();
   }
-  numBinsCoded += m_CABACWriter->getNumBins();
 }
 
+#if ENABLE_PARALLEL_TILE_WRITING
+static void encodeTileSubstream(CABACWriter &writer, CodingStructure &cs, const uint32_t ctuIdxBegin,
+                                const uint32_t ctuIdxEnd, OutputBitstream &substream)
+{
+  const Slice         &slice = *cs.slice;
+  const PreCalcValues &pcv   = *cs.pcv;
+
+  writer.initCtxModels(slice);
+  writer.initBitstream(&substream);
+
+  // the QP prediction starts from the slice QP in every tile
+  EnumArray<int, ChannelType> prevQP;
+  prevQP.fill(slice.getSliceQp());
+
+  for (uint32_t ctuIdx = ctuIdxBegin; ctuIdx < ctuIdxEnd; ctuIdx++)
+  {
+    const uint32_t ctuRsAddr = slice.getCtuAddrInSlice(ctuIdx);
+    const Position pos((ctuRsAddr % pcv.widthInCtus) * pcv.maxCUWidth, (ctuRsAddr / pcv.widthInCtus) * pcv.maxCUHeight);
+    const UnitArea ctuArea(cs.area.chromaFormat, Area(pos.x, pos.y, pcv.maxCUWidth, pcv.maxCUHeight));
+
+    writer.coding_tree_unit(cs, ctuArea, prevQP, ctuRsAddr);
+  }
+
+  writer.end_of_slice();   // end_of_slice_one_bit or end_of_tile_one_bit
+  substream.writeByteAlignment();
+}
+
+uint32_t EncSlice::xEncodeTileSubstreams(Picture *pcPic, OutputBitstream *pcSubstreams, uint32_t &numBinsCoded)
+{
+  Slice *const     pcSlice = pcPic->slices[getSliceSegmentIdx()];
+  CodingStructure &cs      = *pcPic->cs;
+  const PPS       &pps     = *pcSlice->getPPS();
+
+  // first CTU of every tile in the slice, followed by the end of the slice
+  std::vector<uint32_t> tileStart;
+  for (uint32_t ctuIdx = 0; ctuIdx < pcSlice->getNumCtuInSlice(); ctuIdx++)
+  {
+    if (ctuIdx == 0
+        || pps.getTileIdx(pcSlice->getCtuAddrInSlice(ctuIdx)) != pps.getTileIdx(pcSlice->getCtuAddrInSlice(ctuIdx - 1)))
+    {
+      tileStart.push_back(ctuIdx);
+    }
+  }
+  const uint32_t numTiles = uint32_t(tileStart.size());
+  tileStart.push_back(pcSlice->getNumCtuInSlice());
+
+  // the state shared by all tiles is set up before the threads are started
+  if (pcSlice->getSliceType() == B_SLICE)
+  {
+    resetBcwCodingOrder(false, cs);
+  }
+  cs.resetPrevPLT(cs.prevPLT);
+
+  const uint32_t numThreads = std::min(numTiles, uint32_t(m_pcCfg->getNumTileWriterThreads()));
+  while (m_tileCABACEncoders.size() + 1 < numThreads)
+  {
+    m_tileCABACEncoders.push_back(std::make_unique<CABACEncoder>());
+  }
+
+  // every thread takes the next tile that has not been written yet
+  std::atomic<uint32_t> nextTile(0);
+  CABACWriter          *lastTileWriter = nullptr;
+
+  auto writeTiles = [&](CABACWriter *writer)
+  {
+    uint32_t numBins = 0;
+    for (uint32_t tileIdx = nextTile++; tileIdx < numTiles; tileIdx = nextTile++)
+    {
+      encodeTileSubstream(*writer, cs, tileStart[tileIdx], tileStart[tileIdx + 1], pcSubstreams[tileIdx]);
+      numBins += writer->getNumBins();
+      if (tileIdx == numTiles - 1)
+      {
+        lastTileWriter = writer;
+      }
+    }
+    return numBins;
+  };
+
+  std::vector<std::future<uint32_t>> threads;
+  for (uint32_t i = 1; i < numThreads; i++)
+  {
+    threads.push_back(std::async(std::launch::async, writeTiles, m_tileCABACEncoders[i - 1]->getCABACWriter(pcSlice->getSPS())));
+  }
+  numBinsCoded += writeTiles(m_CABACWriter);
+  for (auto &thread: threads)
+  {
+    numBinsCoded += thread.get();
+  }
+
+  // the CABAC init table of the following slices is chosen from the contexts at the end of the slice
+  if (lastTileWriter != m_CABACWriter)
+  {
+    m_CABACWriter->getCtx() = lastTileWriter->getCtx();
+  }
+
+  return numTiles;
+}
+#endif
+
 
 double EncSlice::xGetQPValueAccordingToLambda ( double lambda )
 {
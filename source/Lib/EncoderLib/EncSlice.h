@@ -46,6 +46,8 @@
 #include "CommonLib/CommonDef.h"
 #include "CommonLib/Picture.h"
 
+#include <memory>
+
 //! \ingroup EncoderLib
 //! \{
 
@@ -93,6 +95,9 @@ private:
   Ctx                     m_entropyCodingSyncContextState;      ///< context storage for state of contexts at the wavefront/WPP/entropy-coding-sync second CTU of tile-row
   SliceType               m_encCABACTableIdx;
   PLTBuf                  m_palettePredictorSyncState;
+#if ENABLE_PARALLEL_TILE_WRITING
+  std::vector<std::unique_ptr<CABACEncoder>> m_tileCABACEncoders;   ///< entropy coders of the additional threads writing tile substreams
+#endif
 #if SHARP_LUMA_DELTA_QP || ENABLE_QPA_SUB_CTU
   int                     m_gopID;
 #endif
@@ -146,6 +151,9 @@ public:
   void    setEncCABACTableIdx (SliceType b)         { m_encCABACTableIdx = b; }
 private:
   double  xGetQPValueAccordingToLambda ( double lambda );
+#if ENABLE_PARALLEL_TILE_WRITING
+  uint32_t xEncodeTileSubstreams      ( Picture* pcPic, OutputBitstream* pcSubstreams, uint32_t &numBinsCoded );
+#endif
 };
 
 //! \}
@@ -343,87 +343,27 @@ int EncTemporalFilter::motionErrorLuma(const PelStorage &orig,
   const int bs,
   const int besterror = 8 * 8 * 1024 * 1024) const
 {
-  const Pel* origOrigin = orig.Y().buf;
+  const Pel *origPtr    = orig.Y().bufAt(x, y);
   const ptrdiff_t origStride = orig.Y().stride;
-  const Pel* buffOrigin = buffer.Y().buf;
   const ptrdiff_t buffStride = buffer.Y().stride;
 
-  int error = 0;
   if (((dx | dy) & 0xF) == 0)
   {
-    dx /= m_motionVectorFactor;
-    dy /= m_motionVectorFactor;
-    for (int y1 = 0; y1 < bs; y1++)
-    {
-      const Pel* origRowStart   = origOrigin + (y + y1) * origStride + x;
-      const Pel* bufferRowStart = buffOrigin + (y + y1 + dy) * buffStride + (x + dx);
-      for (int x1 = 0; x1 < bs; x1 += 2)
-      {
-        int diff = origRowStart[x1] - bufferRowStart[x1];
-        error += diff * diff;
-        diff = origRowStart[x1 + 1] - bufferRowStart[x1 + 1];
-        error += diff * diff;
-      }
-      if (error > besterror)
-      {
-        return error;
-      }
-    }
+    const Pel *buffPtr = buffer.Y().bufAt(x + dx / m_motionVectorFactor, y + dy / m_motionVectorFactor);
+    return m_motionError(origPtr, origStride, buffPtr, buffStride, bs, bs, besterror);
   }
-  else
-  {
-    const int *xFilter = m_interpolationFilter[dx & 0xF];
-    const int *yFilter = m_interpolationFilter[dy & 0xF];
-    int tempArray[64 + 8][64];
 
-    int sum, base;
-    for (int y1 = 1; y1 < bs + 7; y1++)
-    {
-      const int yOffset = y + y1 + (dy >> 4) - 3;
-      const Pel *sourceRow = buffOrigin + yOffset * buffStride + 0;
-      for (int x1 = 0; x1 < bs; x1++)
-      {
-        sum = 0;
-        base = x + x1 + (dx >> 4) - 3;
-        const Pel *rowStart = sourceRow + base;
-
-        sum += xFilter[1] * rowStart[1];
-        sum += xFilter[2] * rowStart[2];
-        sum += xFilter[3] * rowStart[3];
-        sum += xFilter[4] * rowStart[4];
-        sum += xFilter[5] * rowStart[5];
-        sum += xFilter[6] * rowStart[6];
-
-        tempArray[y1][x1] = sum;
-      }
-    }
+  Pel predBlock[64 * 64];
+  CHECK(bs > 64, "block size not supported");
 
-    const Pel maxSampleValue = (1 << m_internalBitDepth[ChannelType::LUMA]) - 1;
-    for (int y1 = 0; y1 < bs; y1++)
-    {
-      const Pel *origRow = origOrigin + (y + y1) * origStride;
-      for (int x1 = 0; x1 < bs; x1++)
-      {
-        sum = 0;
-        sum += yFilter[1] * tempArray[y1 + 1][x1];
-        sum += yFilter[2] * tempArray[y1 + 2][x1];
-        sum += yFilter[3] * tempArray[y1 + 3][x1];
-        sum += yFilter[4] * tempArray[y1 + 4][x1];
-        sum += yFilter[5] * tempArray[y1 + 5][x1];
-        sum += yFilter[6] * tempArray[y1 + 6][x1];
-
-        sum = (sum + (1 << 11)) >> 12;
-        sum = sum < 0 ? 0 : (sum > maxSampleValue ? maxSampleValue : sum);
-
-        error += (sum - origRow[x + x1]) * (sum - origRow[x + x1]);
-      }
-      if (error > besterror)
-      {
-        return error;
-      }
-    }
-  }
-  return error;
+  // the SIMD kernels cover blocks of up to 16x16, larger blocks use the generic implementation
+  const auto blockMotion = bs > 16 ? MCTF::xApplyMotion : m_applyMotion;
+
+  const Pel maxSampleValue = (1 << m_internalBitDepth[ChannelType::LUMA]) - 1;
+  blockMotion(buffer.Y().bufAt(x + (dx >> 4), y + (dy >> 4)), buffStride, predBlock, bs, bs, bs,
+              m_interpolationFilter[dx & 0xF], m_interpolationFilter[dy & 0xF], maxSampleValue);
+
+  return m_motionError(origPtr, origStride, predBlock, bs, bs, bs, besterror);
 }
 
 void EncTemporalFilter::motionEstimationLuma(Array2D<MotionVector> &mvs, const PelStorage &orig, const PelStorage &buffer, const int blockSize,
@@ -580,89 +520,26 @@ void EncTemporalFilter::motionEstimation(Array2D<MotionVector> &mv, const PelSto
   motionEstimationLuma(mv, orgPic, buffer, 8, &mv_2, 1, true);
 }
 
-void EncTemporalFilter::applyMotion(const Array2D<MotionVector> &mvs, const PelStorage &input, PelStorage &output) const
+void EncTemporalFilter::applyMotion(const MotionVector &mv, const PelStorage &input, const ComponentID compID,
+                                    const int x, const int y, Pel *dst, const ptrdiff_t dstStride) const
 {
   static const int lumaBlockSize = 8;
 
-  for (int c = 0; c < getNumberValidComponents(m_chromaFormatIdc); c++)
-  {
-    const auto compID     = ComponentID(c);
-    const int  csx        = getComponentScaleX(compID, m_chromaFormatIdc);
-    const int  csy        = getComponentScaleY(compID, m_chromaFormatIdc);
-    const int blockSizeX = lumaBlockSize >> csx;
-    const int blockSizeY = lumaBlockSize >> csy;
-    const int height = input.bufs[c].height;
-    const int width  = input.bufs[c].width;
-
-    const Pel maxValue = (1 << m_internalBitDepth[toChannelType(compID)]) - 1;
-
-    const Pel *srcImage = input.bufs[c].buf;
-    const ptrdiff_t srcStride = input.bufs[c].stride;
-
-    Pel *dstImage = output.bufs[c].buf;
-    ptrdiff_t dstStride = output.bufs[c].stride;
-
-    for (int y = 0, blockNumY = 0; y + blockSizeY <= height; y += blockSizeY, blockNumY++)
-    {
-      for (int x = 0, blockNumX = 0; x + blockSizeX <= width; x += blockSizeX, blockNumX++)
-      {
-        const MotionVector &mv = mvs.get(blockNumX,blockNumY);
-        const int dx = mv.x >> csx ;
-        const int dy = mv.y >> csy ;
-        const int xInt = mv.x >> (4 + csx) ;
-        const int yInt = mv.y >> (4 + csy) ;
-
-        const int *xFilter = m_interpolationFilter[dx & 0xf];
-        const int *yFilter = m_interpolationFilter[dy & 0xf]; // will add 6 bit.
-        const int numFilterTaps   = 7;
-        const int centerTapOffset = 3;
+  const int csx        = getComponentScaleX(compID, m_chromaFormatIdc);
+  const int csy        = getComponentScaleY(compID, m_chromaFormatIdc);
+  const int blockSizeX = lumaBlockSize >> csx;
+  const int blockSizeY = lumaBlockSize >> csy;
 
-        int tempArray[lumaBlockSize + numFilterTaps][lumaBlockSize];
+  const int dx   = mv.x >> csx;
+  const int dy   = mv.y >> csy;
+  const int xInt = mv.x >> (4 + csx);
+  const int yInt = mv.y >> (4 + csy);
 
-        for (int by = 1; by < blockSizeY + numFilterTaps; by++)
-        {
-          const int yOffset = y + by + yInt - centerTapOffset;
-          const Pel *sourceRow = srcImage + yOffset * srcStride;
-          for (int bx = 0; bx < blockSizeX; bx++)
-          {
-            int base = x + bx + xInt - centerTapOffset;
-            const Pel *rowStart = sourceRow + base;
-
-            int sum = 0;
-            sum += xFilter[1] * rowStart[1];
-            sum += xFilter[2] * rowStart[2];
-            sum += xFilter[3] * rowStart[3];
-            sum += xFilter[4] * rowStart[4];
-            sum += xFilter[5] * rowStart[5];
-            sum += xFilter[6] * rowStart[6];
-
-            tempArray[by][bx] = sum;
-          }
-        }
+  const CPelBuf src      = input.get(compID);
+  const Pel     maxValue = (1 << m_internalBitDepth[toChannelType(compID)]) - 1;
 
-        Pel *dstRow = dstImage + y * dstStride;
-        for (int by = 0; by < blockSizeY; by++, dstRow += dstStride)
-        {
-          Pel *dstPel = dstRow + x;
-          for (int bx = 0; bx < blockSizeX; bx++, dstPel++)
-          {
-            int sum = 0;
-
-            sum += yFilter[1] * tempArray[by + 1][bx];
-            sum += yFilter[2] * tempArray[by + 2][bx];
-            sum += yFilter[3] * tempArray[by + 3][bx];
-            sum += yFilter[4] * tempArray[by + 4][bx];
-            sum += yFilter[5] * tempArray[by + 5][bx];
-            sum += yFilter[6] * tempArray[by + 6][bx];
-
-            sum = (sum + (1 << 11)) >> 12;
-            sum = sum < 0 ? 0 : (sum > maxValue ? maxValue : sum);
-            *dstPel = sum;
-          }
-        }
-      }
-    }
-  }
+  m_applyMotion(src.bufAt(x + xInt, y + yInt), src.stride, dst, dstStride, blockSizeX, blockSizeY,
+                m_interpolationFilter[dx & 0xf], m_interpolationFilter[dy & 0xf], maxValue);
 }
 
 void EncTemporalFilter::bilateralFilter(const PelStorage &orgPic,
@@ -670,19 +547,24 @@ void EncTemporalFilter::bilateralFilter(const PelStorage &orgPic,
   PelStorage &newOrgPic,
   double overallStrength) const
 {
+  static const int lumaBlockSize = 8;
+
   const int numRefs = int(srcFrameInfo.size());
-  std::vector<PelStorage> correctedPics(numRefs);
-  for (int i = 0; i < numRefs; i++)
-  {
-    correctedPics[i].create(m_chromaFormatIdc, m_area, 0, m_padding);
-    applyMotion(srcFrameInfo[i].mvs, srcFrameInfo[i].picBuffer, correctedPics[i]);
-  }
 
   const int refStrengthRow = m_futureRefs > 0 ? 0 : 1;
 
   const double lumaSigmaSq = (m_QP - m_sigmaZeroPoint) * (m_QP - m_sigmaZeroPoint) * m_sigmaMultiplier;
   const double chromaSigmaSq = 30 * 30;
 
+  // motion compensated reference blocks, these are only formed for the block being filtered
+  std::vector<Pel> correctedBlocks(numRefs * lumaBlockSize * lumaBlockSize);
+  std::vector<double> blockWeights(numRefs);
+  std::vector<int>    blockSigmaIdx(numRefs);
+
+  // the sample weights only depend on the absolute sample difference and on the sigma scaling 1, 0.8 or 0.8 * 0.8
+  static const int numSigmaScales = 3;
+  std::vector<double> expLut;
+
   for (int c = 0; c < getNumberValidComponents(m_chromaFormatIdc); c++)
   {
     const ComponentID compID = (ComponentID)c;
@@ -697,87 +579,112 @@ void EncTemporalFilter::bilateralFilter(const PelStorage &orgPic,
     const Pel         maxSampleValue        = (1 << m_internalBitDepth[toChannelType(compID)]) - 1;
     const double bitDepthDiffWeighting = 1024.0 / (maxSampleValue + 1);
 
-    const int lumaBlockSize = 8;
     const int csx           = getComponentScaleX(compID, m_chromaFormatIdc);
     const int csy           = getComponentScaleY(compID, m_chromaFormatIdc);
     const int blockSizeX = lumaBlockSize >> csx;
     const int blockSizeY = lumaBlockSize >> csy;
 
-    for (int y = 0; y < height; y++, srcPelRow += srcStride, dstPelRow += dstStride)
+    CHECK(width % blockSizeX != 0 || height % blockSizeY != 0, "picture size must be a multiple of the block size");
+
+    const int lutSize = maxSampleValue + 1;
+    expLut.resize(numSigmaScales * lutSize);
+    for (int idx = 0; idx < numSigmaScales; idx++)
     {
-      const Pel *srcPel = srcPelRow;
-      Pel *dstPel = dstPelRow;
-      for (int x = 0; x < width; x++, srcPel++, dstPel++)
+      double sw = 1;
+      sw *= idx > 0 ? 0.8 : 1.0;
+      sw *= idx > 1 ? 0.8 : 1.0;
+      for (int d = 0; d < lutSize; d++)
       {
-        const int orgVal = (int) *srcPel;
-        double temporalWeightSum = 1.0;
-        double newVal = (double) orgVal;
-        if ((y % blockSizeY == 0) && (x % blockSizeX == 0))
-        {
-          for (int i = 0; i < numRefs; i++)
-          {
-            double variance = 0, diffsum = 0;
-            const ptrdiff_t refStride = correctedPics[i].bufs[c].stride;
-            const Pel *     refPel    = correctedPics[i].bufs[c].buf + y * refStride + x;
-            for (int y1 = 0; y1 < blockSizeY; y1++)
-            {
-              for (int x1 = 0; x1 < blockSizeX; x1++)
-              {
-                const Pel pix  = *(srcPel + srcStride * y1 + x1);
-                const Pel ref  = *(refPel + refStride * y1 + x1);
-                const int diff = pix - ref;
-                variance += diff * diff;
-                if (x1 != blockSizeX - 1)
-                {
-                  const Pel pixR  = *(srcPel + srcStride * y1 + x1 + 1);
-                  const Pel refR  = *(refPel + refStride * y1 + x1 + 1);
-                  const int diffR = pixR - refR;
-                  diffsum += (diffR - diff) * (diffR - diff);
-                }
-                if (y1 != blockSizeY - 1)
-                {
-                  const Pel pixD  = *(srcPel + srcStride * y1 + x1 + srcStride);
-                  const Pel refD  = *(refPel + refStride * y1 + x1 + refStride);
-                  const int diffD = pixD - refD;
-                  diffsum += (diffD - diff) * (diffD - diff);
-                }
-              }
-            }
-            const int cntV = blockSizeX * blockSizeY;
-            const int cntD = 2 * cntV - blockSizeX - blockSizeY;
-            srcFrameInfo[i].mvs.get(x / blockSizeX, y / blockSizeY).noise =
-              (int) round((15.0 * cntD / cntV * variance + 5.0) / (diffsum + 5.0));
-          }
-        }
+        double diff = (double) d;
+        diff *= bitDepthDiffWeighting;
+        double diffSq = diff * diff;
+        expLut[idx * lutSize + d] = exp(-diffSq / (2 * sw * sigmaSq));
+      }
+    }
+
+    for (int y = 0; y < height; y += blockSizeY, srcPelRow += blockSizeY * srcStride, dstPelRow += blockSizeY * dstStride)
+    {
+      for (int x = 0; x < width; x += blockSizeX)
+      {
+        const Pel *srcPel = srcPelRow + x;
+
         double minError = 9999999;
         for (int i = 0; i < numRefs; i++)
         {
           minError = std::min(minError, (double) srcFrameInfo[i].mvs.get(x / blockSizeX, y / blockSizeY).error);
         }
+
         for (int i = 0; i < numRefs; i++)
         {
-          const int error = srcFrameInfo[i].mvs.get(x / blockSizeX, y / blockSizeY).error;
-          const int noise = srcFrameInfo[i].mvs.get(x / blockSizeX, y / blockSizeY).noise;
-          const Pel *pCorrectedPelPtr = correctedPics[i].bufs[c].buf + (y * correctedPics[i].bufs[c].stride + x);
-          const int refVal = (int) *pCorrectedPelPtr;
-          double diff = (double)(refVal - orgVal);
-          diff *= bitDepthDiffWeighting;
-          double diffSq = diff * diff;
+          MotionVector &mv     = srcFrameInfo[i].mvs.get(x / blockSizeX, y / blockSizeY);
+          Pel          *refPel = &correctedBlocks[i * lumaBlockSize * lumaBlockSize];
+
+          applyMotion(mv, srcFrameInfo[i].picBuffer, compID, x, y, refPel, blockSizeX);
+
+          // the sums are integer valued and therefore accumulated exactly, in 64 bits as they exceed the int range
+          // for high bit depths
+          int64_t variance = 0, diffsum = 0;
+          for (int y1 = 0; y1 < blockSizeY; y1++)
+          {
+            for (int x1 = 0; x1 < blockSizeX; x1++)
+            {
+              const Pel pix  = *(srcPel + srcStride * y1 + x1);
+              const Pel ref  = *(refPel + blockSizeX * y1 + x1);
+              const int64_t diff = pix - ref;
+              variance += diff * diff;
+              if (x1 != blockSizeX - 1)
+              {
+                const Pel pixR  = *(srcPel + srcStride * y1 + x1 + 1);
+                const Pel refR  = *(refPel + blockSizeX * y1 + x1 + 1);
+                const int64_t diffR = pixR - refR;
+                diffsum += (diffR - diff) * (diffR - diff);
+              }
+              if (y1 != blockSizeY - 1)
+              {
+                const Pel pixD  = *(srcPel + srcStride * y1 + x1 + srcStride);
+                const Pel refD  = *(refPel + blockSizeX * y1 + x1 + blockSizeX);
+                const int64_t diffD = pixD - refD;
+                diffsum += (diffD - diff) * (diffD - diff);
+              }
+            }
+          }
+          const int cntV = blockSizeX * blockSizeY;
+          const int cntD = 2 * cntV - blockSizeX - blockSizeY;
+          mv.noise = (int) round((15.0 * cntD / cntV * variance + 5.0) / (diffsum + 5.0));
+
+          const int error = mv.error;
+          const int noise = mv.noise;
           const int index = std::min(3, std::abs(srcFrameInfo[i].origOffset) - 1);
-          double ww = 1, sw = 1;
+          double ww = 1;
           ww *= (noise < 25) ? 1.0 : 0.6;
-          sw *= (noise < 25) ? 1.0 : 0.8;
           ww *= (error < 50) ? 1.2 : ((error > 100) ? 0.6 : 1.0);
-          sw *= (error < 50) ? 1.0 : 0.8;
           ww *= ((minError + 1) / (error + 1));
-          double weight = weightScaling * m_refStrengths[refStrengthRow][index] * ww * exp(-diffSq / (2 * sw * sigmaSq));
-          newVal += weight * refVal;
-          temporalWeightSum += weight;
+          blockWeights[i]  = weightScaling * m_refStrengths[refStrengthRow][index] * ww;
+          blockSigmaIdx[i] = ((noise < 25) ? 0 : 1) + ((error < 50) ? 0 : 1);
+        }
+
+        for (int y1 = 0; y1 < blockSizeY; y1++)
+        {
+          const Pel *srcRow = srcPel + y1 * srcStride;
+          Pel       *dstRow = dstPelRow + y1 * dstStride + x;
+          for (int x1 = 0; x1 < blockSizeX; x1++)
+          {
+            const int orgVal = (int) srcRow[x1];
+            double temporalWeightSum = 1.0;
+            double newVal = (double) orgVal;
+            for (int i = 0; i < numRefs; i++)
+            {
+              const int refVal = (int) correctedBlocks[i * lumaBlockSize * lumaBlockSize + y1 * blockSizeX + x1];
+              const double weight = blockWeights[i] * expLut[blockSigmaIdx[i] * lutSize + std::abs(refVal - orgVal)];
+              newVal += weight * refVal;
+              temporalWeightSum += weight;
+            }
+            newVal /= temporalWeightSum;
+            Pel sampleVal = (Pel)round(newVal);
+            sampleVal = (sampleVal < 0 ? 0 : (sampleVal > maxSampleValue ? maxSampleValue : sampleVal));
+            dstRow[x1] = sampleVal;
+          }
         }
-        newVal /= temporalWeightSum;
-        Pel sampleVal = (Pel)round(newVal);
-        sampleVal = (sampleVal < 0 ? 0 : (sampleVal > maxSampleValue ? maxSampleValue : sampleVal));
-        *dstPel = sampleVal;
       }
     }
   }
@@ -39,6 +39,7 @@
 #define __TEMPORAL_FILTER__
 #include "CommonLib/Unit.h"
 #include "CommonLib/Buffer.h"
+#include "CommonLib/MCTF.h"
 #include <sstream>
 #include <map>
 #include <deque>
@@ -101,7 +102,7 @@ struct TemporalFilterSourcePicInfo
 // Class definition
 // ====================================================================================================================
 
-class EncTemporalFilter
+class EncTemporalFilter : public MCTF
 {
 public:
   EncTemporalFilter();
@@ -165,7 +166,8 @@ private:
   void motionEstimation(Array2D<MotionVector> &mvs, const PelStorage &orgPic, const PelStorage &buffer, const PelStorage &origSubsampled2, const PelStorage &origSubsampled4) const;
 
   void bilateralFilter(const PelStorage &orgPic, std::deque<TemporalFilterSourcePicInfo> &srcFrameInfo, PelStorage &newOrgPic, double overallStrength) const;
-  void applyMotion(const Array2D<MotionVector> &mvs, const PelStorage &input, PelStorage &output) const;
+  void applyMotion(const MotionVector &mv, const PelStorage &input, const ComponentID compID, const int x, const int y,
+                   Pel *dst, const ptrdiff_t dstStride) const;
 }; // END CLASS DEFINITION EncTemporalFilter
 
    //! \}
@@ -11370,19 +11370,6 @@ void InterSearch::symmvdCheckBestMvp(PredictionUnit &pu, PelUnitBuf &origBuf, Mv
   }
 }
 
-uint64_t InterSearch::xCalcPuMeBits(PredictionUnit& pu)
-{
-  assert(pu.mergeFlag);
-  assert(!CU::isIBC(*pu.cu));
-  m_CABACEstimator->resetBits();
-  m_CABACEstimator->merge_flag(pu);
-  if (pu.mergeFlag)
-  {
-    m_CABACEstimator->merge_data(pu);
-  }
-  return m_CABACEstimator->getEstFracBits();
-}
-
 bool InterSearch::isValidBv(PredictionUnit& pu, int xPos, int yPos, int width, int height, int picWidth, int picHeight,
                             int xBv, int yBv, int ctuSize)
 {
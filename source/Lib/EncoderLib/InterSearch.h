@@ -622,7 +622,6 @@ public:
   void     xEstimateInterResidualQT(CodingStructure &cs, Partitioner &partitioner, Distortion *puiZeroDist = nullptr,
                                     const bool luma = true, const bool chroma = true, PelUnitBuf *orgResi = nullptr);
   uint64_t xGetSymbolFracBitsInter  (CodingStructure &cs, Partitioner &partitioner);
-  uint64_t xCalcPuMeBits            (PredictionUnit& pu);
 
 };// END CLASS DEFINITION EncSearch
 
@@ -34,6 +34,7 @@
 #include <vector>
 #include <algorithm>
 #include <ostream>
+#include <cstring>
 
 #include "CommonLib/NAL.h"
 #include "CommonLib/BitStream.h"
@@ -85,42 +86,50 @@ void writeNaluContent(std::ostream &out, OutputNALUnit &nalu)
    *  - 0x00000302
    *  - 0x00000303
    */
-  std::vector<uint8_t> &rbsp = nalu.m_bitstream.getFifo();
+  const std::vector<uint8_t> &fifo = nalu.m_bitstream.getFifo();
+  const uint8_t              *rbsp = fifo.data();
+  const size_t                size = fifo.size();
 
-  std::vector<uint8_t> outputBuffer;
-  outputBuffer.resize(rbsp.size()*2+1); //there can never be enough emulation_prevention_three_bytes to require this much space
-  std::size_t outputAmount = 0;
-  int         zeroCount    = 0;
-  for (std::vector<uint8_t>::iterator it = rbsp.begin(); it != rbsp.end(); it++)
+  /* the zero bytes are located with memchr(), which is vectorised by the C
+   * library, and the bytes between two emulation_prevention_three_byte's are
+   * written as a block */
+  size_t written = 0;
+  size_t pos     = 0;
+  while (pos + 2 < size)
   {
-    const uint8_t v=(*it);
-    if (zeroCount==2 && v<=3)
+    const uint8_t *zero = (const uint8_t *) memchr(rbsp + pos, 0, size - 2 - pos);
+    if (zero == nullptr)
     {
-      outputBuffer[outputAmount++]=emulation_prevention_three_byte;
-      zeroCount=0;
+      break;
     }
-
-    if (v==0)
+    pos = zero - rbsp;
+    if (rbsp[pos + 1] != 0)
+    {
+      pos += 2;
+    }
+    else if (rbsp[pos + 2] <= 3)
     {
-      zeroCount++;
+      pos += 2;
+      out.write(reinterpret_cast<const char *>(rbsp + written), pos - written);
+      out.put(emulation_prevention_three_byte);
+      written = pos;
     }
     else
     {
-      zeroCount=0;
+      pos += 3;
     }
-    outputBuffer[outputAmount++]=v;
   }
+  out.write(reinterpret_cast<const char *>(rbsp + written), size - written);
 
   /* 7.4.1.1
    * ... when the last byte of the RBSP data is equal to 0x00 (which can
    * only occur when the RBSP ends in a cabac_zero_word), a final byte equal
    * to 0x03 is appended to the end of the data.
    */
-  if (zeroCount>0)
+  if (size > 0 && rbsp[size - 1] == 0)
   {
-    outputBuffer[outputAmount++]=emulation_prevention_three_byte;
+    out.put(emulation_prevention_three_byte);
   }
-  out.write(reinterpret_cast<const char*>(&(*outputBuffer.begin())), outputAmount);
 }
 
 void writeNaluWithHeader(std::ostream &out, OutputNALUnit &nalu)
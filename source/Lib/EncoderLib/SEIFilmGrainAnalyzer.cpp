@@ -42,9 +42,6 @@ constexpr double FGAnalyser::m_tapFilter[3];
 // ====================================================================================================================
 // Edge detection - Canny
 // ====================================================================================================================
-const int Canny::m_gx[3][3]{ { -1, 0, 1 }, { -2, 0, 2 }, { -1, 0, 1 } };
-const int Canny::m_gy[3][3]{ { -1, -2, -1 }, { 0, 0, 0 }, { 1, 2, 1 } };
-
 const int Canny::m_gauss5x5[5][5]{ { 2, 4, 5, 4, 2 },
                                  { 4, 9, 12, 9, 4 },
                                  { 5, 12, 15, 12, 5 },
@@ -67,143 +64,38 @@ void Canny::gradient(PelStorage *buff1, PelStorage *buff2, unsigned int width, u
   /*
   buff1 - magnitude; buff2 - orientation (Only luma in buff2)
   */
-
-  // 360 degrees are split into the 8 equal parts; edge direction is quantized
-  const double edge_threshold_22_5  = 22.5;
-  const double edge_threshold_67_5  = 67.5;
-  const double edge_threshold_112_5 = 112.5;
-  const double edge_threshold_157_5 = 157.5;
+  CHECK(convWidthS != 3 || convHeightS != 3, "Only 3x3 Sobel kernels are supported");
 
   const int maxClpRange = (1 << bitDepth) - 1;
   const int padding     = convWidthS / 2;
 
-  // tmp buffs
-  PelStorage tmpBuf1, tmpBuf2;
-  tmpBuf1.create(ChromaFormat::_400, Area(0, 0, width, height));
-  tmpBuf2.create(ChromaFormat::_400, Area(0, 0, width, height));
-
-  buff1->get(compID).extendBorderPel(padding, padding);
-
-  // Gx
-  for (int i = 0; i < width; i++)
-  {
-    for (int j = 0; j < height; j++)
-    {
-      int acc = 0;
-      for (int x = 0; x < convWidthS; x++)
-      {
-        for (int y = 0; y < convHeightS; y++)
-        {
-          acc += (buff1->get(compID).at(x - convWidthS / 2 + i, y - convHeightS / 2 + j) * m_gx[x][y]);
-        }
-      }
-      tmpBuf1.Y().at(i, j) = acc;
-    }
-  }
-
-  // Gy
-  for (int i = 0; i < width; i++)
-  {
-    for (int j = 0; j < height; j++)
-    {
-      int acc = 0;
-      for (int x = 0; x < convWidthS; x++)
-      {
-        for (int y = 0; y < convHeightS; y++)
-        {
-          acc += (buff1->get(compID).at(x - convWidthS / 2 + i, y - convHeightS / 2 + j) * m_gy[x][y]);
-        }
-      }
-      tmpBuf2.Y().at(i, j) = acc;
-    }
-  }
+  // tmp buff
+  PelStorage tmpBuf;
+  tmpBuf.create(ChromaFormat::_400, Area(0, 0, width, height));
 
-  // magnitude
-  for (int i = 0; i < width; i++)
-  {
-    for (int j = 0; j < height; j++)
-    {
-      Pel tmp                     = (Pel)((abs(tmpBuf1.Y().at(i, j)) + abs(tmpBuf2.Y().at(i, j))) / 2);
-      buff1->get(compID).at(i, j) = (Pel) Clip3((Pel) 0, (Pel) maxClpRange, tmp);
-    }
-  }
+  PelBuf src = buff1->get(compID);
+  PelBuf mag = tmpBuf.Y();
+  PelBuf dir = buff2->get(ComponentID(0));
 
-  // edge direction - quantized edge directions
-  for (int i = 0; i < width; i++)
-  {
-    for (int j = 0; j < height; j++)
-    {
-      double theta = (atan2(tmpBuf1.Y().at(i, j), tmpBuf2.Y().at(i, j)) * 180) / PI;
+  src.extendBorderPel(padding, padding);
 
-      /* Convert actual edge direction to approximate value - quantize directions */
-      if (((-edge_threshold_22_5 < theta) && (theta <= edge_threshold_22_5)) || ((edge_threshold_157_5 < theta) || (theta <= -edge_threshold_157_5)))
-      {
-        buff2->get(ComponentID(0)).at(i, j) = 0;
-      }
-      if (((-edge_threshold_157_5 < theta) && (theta <= -edge_threshold_112_5)) || ((edge_threshold_22_5 < theta) && (theta <= edge_threshold_67_5)))
-      {
-        buff2->get(ComponentID(0)).at(i, j) = 45;
-      }
-      if (((-edge_threshold_112_5 < theta) && (theta <= -edge_threshold_67_5)) || ((edge_threshold_67_5 < theta) && (theta <= edge_threshold_112_5)))
-      {
-        buff2->get(ComponentID(0)).at(i, j) = 90;
-      }
-      if (((-edge_threshold_67_5 < theta) && (theta <= -edge_threshold_22_5)) || ((edge_threshold_112_5 < theta) && (theta <= edge_threshold_157_5)))
-      {
-        buff2->get(ComponentID(0)).at(i, j) = 135;
-      }
-    }
-  }
+  // magnitude and quantized edge directions (0, 45, 90 and 135 degrees)
+  m_sobel(src.buf, src.stride, mag.buf, mag.stride, dir.buf, dir.stride, width, height, maxClpRange);
 
-  buff1->get(compID).extendBorderPel(padding, padding);   // extend border for the next steps
-  tmpBuf1.destroy();
-  tmpBuf2.destroy();
+  src.copyFrom(mag);
+  src.extendBorderPel(padding, padding);   // extend border for the next steps
+  tmpBuf.destroy();
 }
 
 void Canny::suppressNonMax(PelStorage *buff1, PelStorage *buff2, unsigned int width, unsigned int height,
                            ComponentID compID)
 {
-  for (int i = 0; i < width; i++)
-  {
-    for (int j = 0; j < height; j++)
-    {
-      int rowShift = 0, colShift = 0;
+  PelBuf mag = buff1->get(compID);
+  PelBuf dir = buff2->get(ComponentID(0));
 
-      switch (buff2->get(ComponentID(0)).at(i, j))
-      {
-      case 0:
-        rowShift = 1;
-        colShift = 0;
-        break;
-      case 45:
-        rowShift = 1;
-        colShift = 1;
-        break;
-      case 90:
-        rowShift = 0;
-        colShift = 1;
-        break;
-      case 135:
-        rowShift = -1;
-        colShift = 1;
-        break;
-      default: THROW("Unsupported gradient direction."); break;
-      }
-
-      Pel pelCurrent             = buff1->get(compID).at(i, j);
-      Pel pelEdgeDirectionTop    = buff1->get(compID).at(i + rowShift, j + colShift);
-      Pel pelEdgeDirectionBottom = buff1->get(compID).at(i - rowShift, j - colShift);
-      if ((pelCurrent < pelEdgeDirectionTop) || (pelCurrent < pelEdgeDirectionBottom))
-      {
-        buff2->get(ComponentID(0)).at(i, j) = 0;   // supress
-      }
-      else
-      {
-        buff2->get(ComponentID(0)).at(i, j) = buff1->get(compID).at(i, j);   // keep
-      }
-    }
-  }
-  buff1->get(compID).copyFrom(buff2->get(ComponentID(0)));
+  // the result overwrites the directions before being copied back
+  m_suppressNonMax(mag.buf, mag.stride, dir.buf, dir.stride, dir.buf, dir.stride, width, height);
+  mag.copyFrom(dir);
 }
 
 void Canny::doubleThreshold(PelStorage *buff, unsigned int width, unsigned int height,
@@ -354,29 +246,38 @@ int Morph::dilation(PelStorage *buff, unsigned int bitDepth, ComponentID compID,
 
   PelStorage tmpBuf;
   tmpBuf.create(ChromaFormat::_400, Area(0, 0, width, height));
-  tmpBuf.bufs[0].copyFrom(buff->get(compID));
 
   buff->get(compID).extendBorderPel(padding, padding);
 
-  for (int i = 0; i < width; i++)
+  if (windowSize == 3)
   {
-    for (int j = 0; j < height; j++)
+    const CPelBuf src = buff->get(compID);
+    m_morph3x3(src.buf, src.stride, tmpBuf.bufs[0].buf, tmpBuf.bufs[0].stride, width, height, strongPel);
+  }
+  else
+  {
+    tmpBuf.bufs[0].copyFrom(buff->get(compID));
+
+    for (int i = 0; i < width; i++)
     {
-      bool strong = false;
-      for (int x = 0; x < windowSize; x++)
+      for (int j = 0; j < height; j++)
       {
-        for (int y = 0; y < windowSize; y++)
+        bool strong = false;
+        for (int x = 0; x < windowSize; x++)
         {
-          if (buff->get(compID).at(x - windowSize / 2 + i, y - windowSize / 2 + j) == strongPel)
+          for (int y = 0; y < windowSize; y++)
           {
-            strong = true;
-            break;
+            if (buff->get(compID).at(x - windowSize / 2 + i, y - windowSize / 2 + j) == strongPel)
+            {
+              strong = true;
+              break;
+            }
           }
         }
-      }
-      if (strong)
-      {
-        tmpBuf.get(ComponentID(0)).at(i, j) = strongPel;
+        if (strong)
+        {
+          tmpBuf.get(ComponentID(0)).at(i, j) = strongPel;
+        }
       }
     }
   }
@@ -405,29 +306,38 @@ int Morph::erosion(PelStorage *buff, unsigned int bitDepth, ComponentID compID,
 
   PelStorage tmpBuf;
   tmpBuf.create(ChromaFormat::_400, Area(0, 0, width, height));
-  tmpBuf.bufs[0].copyFrom(buff->get(compID));
 
   buff->get(compID).extendBorderPel(padding, padding);
 
-  for (int i = 0; i < width; i++)
+  if (windowSize == 3)
   {
-    for (int j = 0; j < height; j++)
+    const CPelBuf src = buff->get(compID);
+    m_morph3x3(src.buf, src.stride, tmpBuf.bufs[0].buf, tmpBuf.bufs[0].stride, width, height, 0);
+  }
+  else
+  {
+    tmpBuf.bufs[0].copyFrom(buff->get(compID));
+
+    for (int i = 0; i < width; i++)
     {
-      bool week = false;
-      for (int x = 0; x < windowSize; x++)
+      for (int j = 0; j < height; j++)
       {
-        for (int y = 0; y < windowSize; y++)
+        bool week = false;
+        for (int x = 0; x < windowSize; x++)
         {
-          if (buff->get(compID).at(x - windowSize / 2 + i, y - windowSize / 2 + j) == 0)
+          for (int y = 0; y < windowSize; y++)
           {
-            week = true;
-            break;
+            if (buff->get(compID).at(x - windowSize / 2 + i, y - windowSize / 2 + j) == 0)
+            {
+              week = true;
+              break;
+            }
           }
         }
-      }
-      if (week)
-      {
-        tmpBuf.get(ComponentID(0)).at(i, j) = 0;
+        if (week)
+        {
+          tmpBuf.get(ComponentID(0)).at(i, j) = 0;
+        }
       }
     }
   }
@@ -683,14 +593,17 @@ void FGAnalyser::suppressLowIntensity(const PelStorage &buff1, PelStorage &buff2
   Pel maxIntensity          = ((Pel) 1 << bitDepth) - 1;
   Pel lowIntensityThreshold = (Pel)(m_lowIntensityRatio * maxIntensity);
 
+  const CPelBuf src  = buff1.get(compID);
+  PelBuf        mask = buff2.get(compID);
+
   // strong, week, supressed
-  for (int i = 0; i < width; i++)
+  for (int y = 0; y < height; y++)
   {
-    for (int j = 0; j < height; j++)
+    for (int x = 0; x < width; x++)
     {
-      if (buff1.get(compID).at(i, j) < lowIntensityThreshold)
+      if (src.at(x, y) < lowIntensityThreshold)
       {
-        buff2.get(compID).at(i, j) = maxIntensity;
+        mask.at(x, y) = maxIntensity;
       }
     }
   }
@@ -701,24 +614,9 @@ void FGAnalyser::subsample(const PelStorage &input, PelStorage &output, Componen
   const int newWidth  = input.get(compID).width / factor;
   const int newHeight = input.get(compID).height / factor;
 
-  const Pel *srcRow    = input.get(compID).buf;
-  const ptrdiff_t srcStride = input.get(compID).stride;
-  Pel *      dstRow    = output.get(compID).buf;   // output is tmp buffer with only one component for binary mask
-  const ptrdiff_t dstStride = output.get(compID).stride;
-
-  for (int y = 0; y < newHeight; y++, srcRow += factor * srcStride, dstRow += dstStride)
-  {
-    const Pel *inRow      = srcRow;
-    const Pel *inRowBelow = srcRow + srcStride;
-    Pel *      target     = dstRow;
-
-    for (int x = 0; x < newWidth; x++)
-    {
-      target[x] = (inRow[0] + inRowBelow[0] + inRow[1] + inRowBelow[1] + 2) >> 2;
-      inRow += factor;
-      inRowBelow += factor;
-    }
-  }
+  // output is tmp buffer with only one component for binary mask
+  m_subsample(input.get(compID).buf, input.get(compID).stride, output.get(compID).buf, output.get(compID).stride,
+              newWidth, newHeight, factor);
 
   if (padding)
   {
@@ -735,19 +633,20 @@ void FGAnalyser::upsample(const PelStorage &input, PelStorage &output, Component
   const int width  = input.get(compID).width;
   const int height = input.get(compID).height;
 
-  for (int i = 0; i < width; i++)
+  const CPelBuf src = input.get(compID);
+  PelBuf        dst = output.get(compID);
+
+  for (int y = 0; y < height; y++)
   {
-    for (int j = 0; j < height; j++)
-    {
-      Pel currentPel = input.get(compID).at(i, j);
+    Pel *dstRow = dst.bufAt(0, y * factor);
 
-      for (int x = 0; x < factor; x++)
-      {
-        for (int y = 0; y < factor; y++)
-        {
-          output.get(compID).at(i * factor + x, j * factor + y) = currentPel;
-        }
-      }
+    for (int x = 0; x < width; x++)
+    {
+      std::fill_n(dstRow + x * factor, factor, src.at(x, y));
+    }
+    for (int k = 1; k < factor; k++)
+    {
+      std::copy_n(dstRow, width * factor, dst.bufAt(0, y * factor + k));
     }
   }
 
@@ -762,11 +661,14 @@ void FGAnalyser::combineMasks(PelStorage &buff1, PelStorage &buff2, ComponentID
   const int width  = buff1.get(compID).width;
   const int height = buff1.get(compID).height;
 
-  for (int i = 0; i < width; i++)
+  PelBuf        dst = buff1.get(compID);
+  const CPelBuf src = buff2.get(compID);
+
+  for (int y = 0; y < height; y++)
   {
-    for (int j = 0; j < height; j++)
+    for (int x = 0; x < width; x++)
     {
-      buff1.get(compID).at(i, j) = (buff1.get(compID).at(i, j) | buff2.get(compID).at(i, j));
+      dst.at(x, y) |= src.at(x, y);
     }
   }
 }
@@ -1034,76 +936,39 @@ int FGAnalyser::cutoff_frequency(std::vector<double> &mean)
 void FGAnalyser::block_transform(const PelStorage &buff, std::vector<PelMatrix> &squared_dct_grain_block_list,
                                  int offsetX, int offsetY, unsigned int bitDepth, ComponentID compID)
 {
-  unsigned int     windowSize       = DATA_BASE_SIZE;               // Size for Film Grain block
-  Intermediate_Int max_dynamic_range = (1 << (bitDepth + 6)) - 1;   // Dynamic range after DCT transform for 64x64 block
-  Intermediate_Int min_dynamic_range = -((1 << (bitDepth + 6)) - 1);
-  Intermediate_Int sum;
+  static_assert(DATA_BASE_SIZE == DCT_SIZE, "The film grain blocks must match the size of the DCT kernel");
 
-  const TMatrixCoeff *tmp            = g_trCoreDCT2P64[TRANSFORM_FORWARD][0];
-  const int           transform_scale = 9;   // upscaling of original transform as specified in VVC (for 64x64 block)
-  const int add_1st = 1 << (transform_scale - 1);
+  Intermediate_Int squared[DCT_SIZE * DCT_SIZE];
 
-  TMatrixCoeff tr[DATA_BASE_SIZE][DATA_BASE_SIZE];    // Original
-  TMatrixCoeff trt[DATA_BASE_SIZE][DATA_BASE_SIZE];   // Transpose
-  for (int x = 0; x < DATA_BASE_SIZE; x++)
-  {
-    for (int y = 0; y < DATA_BASE_SIZE; y++)
-    {
-      tr[x][y]  = tmp[x * 64 + y]; /* Matrix Original */
-      trt[y][x] = tmp[x * 64 + y]; /* Matrix Transpose */
-    }
-  }
+  const CPelBuf src = buff.get(compID);
+  m_squaredDct(src.bufAt(offsetX, offsetY), src.stride, squared, bitDepth);
 
-  // DCT transform
-  PelMatrix blockDCT(windowSize, std::vector<Intermediate_Int>(windowSize));
-  PelMatrix blockTmp(windowSize, std::vector<Intermediate_Int>(windowSize));
+  PelMatrix blockDCT(DCT_SIZE, std::vector<Intermediate_Int>(DCT_SIZE));
 
-  for (int x = 0; x < windowSize; x++)
+  for (int x = 0; x < DCT_SIZE; x++)
   {
-    for (int y = 0; y < windowSize; y++)
+    for (int y = 0; y < DCT_SIZE; y++)
     {
-      sum = 0;
-      for (int k = 0; k < windowSize; k++)
-      {
-        sum += tr[x][k] * buff.get(compID).at(offsetX + k, offsetY + y);
-      }
-      blockTmp[x][y] = (sum + add_1st) >> transform_scale;
-    }
-  }
-
-  for (int x = 0; x < windowSize; x++)
-  {
-    for (int y = 0; y < windowSize; y++)
-    {
-      sum = 0;
-      for (int k = 0; k < windowSize; k++)
-      {
-        sum += blockTmp[x][k] * trt[k][y];
-      }
-      blockDCT[x][y] = Clip3(min_dynamic_range, max_dynamic_range, (sum + add_1st) >> transform_scale);
-    }
-  }
-
-  for (int x = 0; x < windowSize; x++)
-  {
-    for (int y = 0; y < windowSize; y++)
-    {
-      blockDCT[x][y] = blockDCT[x][y] * blockDCT[x][y];
+      blockDCT[x][y] = squared[y * DCT_SIZE + x];
     }
   }
 
   // store squared transformed block for further analysis
-  squared_dct_grain_block_list.push_back(blockDCT);
+  squared_dct_grain_block_list.push_back(std::move(blockDCT));
 }
 
 // check edges
 int FGAnalyser::count_edges(PelStorage &buffer, int windowSize, ComponentID compID, int offsetX, int offsetY)
 {
-  for (int x = 0; x < windowSize; x++)
+  const CPelBuf src = buffer.get(compID);
+
+  for (int y = 0; y < windowSize; y++)
   {
-    for (int y = 0; y < windowSize; y++)
+    const Pel *row = src.bufAt(offsetX, offsetY + y);
+
+    for (int x = 0; x < windowSize; x++)
     {
-      if (buffer.get(compID).at(offsetX + x, offsetY + y))
+      if (row[x])
       {
         return 0;
       }
@@ -1116,17 +981,24 @@ int FGAnalyser::count_edges(PelStorage &buffer, int windowSize, ComponentID comp
 // calulate mean and variance for windowSize x windowSize block
 int FGAnalyser::meanVar(PelStorage &buffer, int windowSize, ComponentID compID, int offsetX, int offsetY, bool getVar)
 {
-  double m = 0, v = 0;
+  const CPelBuf src = buffer.get(compID);
+
+  // the sums are exact in integer arithmetic, which keeps the result of the original floating point accumulation
+  int64_t sum = 0, sumSq = 0;
 
-  for (int x = 0; x < windowSize; x++)
+  for (int y = 0; y < windowSize; y++)
   {
-    for (int y = 0; y < windowSize; y++)
+    const Pel *row = src.bufAt(offsetX, offsetY + y);
+
+    for (int x = 0; x < windowSize; x++)
     {
-      m += buffer.get(compID).at(offsetX + x, offsetY + y);
-      v += (buffer.get(compID).at(offsetX + x, offsetY + y) * buffer.get(compID).at(offsetX + x, offsetY + y));
+      sum += row[x];
+      sumSq += row[x] * row[x];
     }
   }
 
+  double m = (double) sum, v = (double) sumSq;
+
   m = m / (windowSize * windowSize);
   if (getVar)
   {
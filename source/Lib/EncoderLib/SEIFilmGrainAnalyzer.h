@@ -44,6 +44,7 @@
 #include "CommonLib/SEI.h"
 #include "Utilities/VideoIOYuv.h"
 #include "CommonLib/CommonDef.h"
+#include "CommonLib/FilmGrainAnalysis.h"
 
 #include <numeric>
 #include <cmath>
@@ -88,7 +89,7 @@ typedef std::vector<std::vector<double>>           PelMatrixDouble;
 typedef std::vector<std::vector<long double>>      PelMatrixLongDouble;
 typedef std::vector<long double>                   PelVectorLongDouble;
 
-class Canny
+class Canny : public FilmGrainAnalysis
 {
 public:
   Canny();
@@ -99,8 +100,6 @@ public:
   void detect_edges(const PelStorage* orig, PelStorage* dest, unsigned int uiBitDepth, ComponentID compID);
 
 private:
-  static const int  m_gx[3][3];                               // Sobel kernel x
-  static const int  m_gy[3][3];                               // Sobel kernel y
   static const int  m_gauss5x5[5][5];                         // Gauss 5x5 kernel, integer approximation
 
   unsigned int      m_convWidthS = 3, m_convHeightS = 3;		  // Pixel's row and col positions for Sobel filtering
@@ -119,7 +118,7 @@ private:
 };
 
 
-class Morph
+class Morph : public FilmGrainAnalysis
 {
 public:
   Morph();
@@ -133,7 +132,7 @@ private:
 };
 
 
-class FGAnalyser
+class FGAnalyser : public FilmGrainAnalysis
 {
 public:
   FGAnalyser();
@@ -105,39 +105,12 @@ constexpr int MAX_FILE_BIT_DEPTH = 16;
  */
 static void scalePlane( PelBuf& areaBuf, const int shiftbits, const Pel minval, const Pel maxval)
 {
-  const unsigned width  = areaBuf.width;
-  const unsigned height = areaBuf.height;
-  const ptrdiff_t stride = areaBuf.stride;
-  Pel            *img    = areaBuf.bufAt(0, 0);
-
   if( 0 == shiftbits )
   {
     return;
   }
 
-  if( shiftbits > 0)
-  {
-    for( unsigned y = 0; y < height; y++, img+=stride)
-    {
-      for( unsigned x = 0; x < width; x++)
-      {
-        img[x] <<= shiftbits;
-      }
-    }
-  }
-  else if (shiftbits < 0)
-  {
-    const int shiftbitsr =- shiftbits;
-    const Pel rounding = 1 << (shiftbitsr-1);
-
-    for( unsigned y = 0; y < height; y++, img+=stride)
-    {
-      for( unsigned x = 0; x < width; x++)
-      {
-        img[x] = Clip3(minval, maxval, Pel((img[x] + rounding) >> shiftbitsr));
-      }
-    }
-  }
+  g_pelBufOP.scaleSamples(areaBuf.buf, areaBuf.stride, areaBuf.width, areaBuf.height, shiftbits, minval, maxval);
 }
 
 
@@ -479,51 +452,11 @@ static bool readPlane(Pel *dst, std::istream &fd, bool is16bit, ptrdiff_t stride
 
       if ((y444 & maskDestY) == 0)
       {
-        // process current destination line
-        if (csxFile < csxDest)
-        {
-          // eg file is 444, dest is 422.
-          const uint32_t sx = csxDest - csxFile;
-          if (!is16bit)
-          {
-            for (uint32_t x = 0; x < widthDest; x++)
-            {
-              pDstBuf[x] = buf[x<<sx];
-            }
-          }
-          else
-          {
-            for (uint32_t x = 0; x < widthDest; x++)
-            {
-              pDstBuf[x] = Pel(buf[(x<<sx)*2+0]) | (Pel(buf[(x<<sx)*2+1])<<8);
-            }
-          }
-        }
-        else
-        {
-          // eg file is 422, dest is 444.
-          const uint32_t sx = csxFile - csxDest;
-          if (!is16bit)
-          {
-            for (uint32_t x = 0; x < widthDest; x++)
-            {
-              pDstBuf[x] = buf[x>>sx];
-            }
-          }
-          else
-          {
-            for (uint32_t x = 0; x < widthDest; x++)
-            {
-              pDstBuf[x] = Pel(buf[(x>>sx)*2+0]) | (Pel(buf[(x>>sx)*2+1])<<8);
-            }
-          }
-        }
+        // process current destination line, eg file is 444 and dest is 422 or file is 422 and dest is 444
+        g_pelBufOP.unpackSamples(buf, is16bit, pDstBuf, widthDest, int(csxDest) - int(csxFile));
 
         // process right hand side padding
-        for (uint32_t x = widthDest; x < fullWidthDest; x++)
-        {
-          pDstBuf[x] = pDstBuf[widthDest-1];
-        }
+        std::fill(pDstBuf + widthDest, pDstBuf + fullWidthDest, pDstBuf[widthDest - 1]);
 
         pDstBuf += dstBufStride;
       }
@@ -532,10 +465,7 @@ static bool readPlane(Pel *dst, std::istream &fd, bool is16bit, ptrdiff_t stride
     // process lower padding
     for (uint32_t y = heightDest; y < fullHeightDest; y++, pDstPad += strideDest)
     {
-      for (uint32_t x = 0; x < fullWidthDest; x++)
-      {
-        pDstPad[x] = (pDstPad - strideDest)[x];
-      }
+      memcpy(pDstPad, pDstPad - strideDest, fullWidthDest * sizeof(Pel));
     }
   }
   return true;
@@ -561,12 +491,15 @@ static bool verifyPlane(Pel *dst, ptrdiff_t stride444, uint32_t width444, uint32
 
   for (uint32_t y = 0; y < fullHeight; y++, dstBuf+= stride)
   {
+    // accumulate the whole line so that the loop can be vectorised
+    Pel bits = 0;
     for (uint32_t x = 0; x < fullWidth; x++)
     {
-      if ( (dstBuf[x] & mask) != 0)
-      {
-        return false;
-      }
+      bits |= dstBuf[x];
+    }
+    if ((bits & mask) != 0)
+    {
+      return false;
     }
   }
 
@@ -773,47 +706,8 @@ static bool writePlane(uint32_t orgWidth, uint32_t orgHeight, std::ostream& fd,
     {
       if ((y444 & maskFileY) == 0)
       {
-        // write a new line
-        if (csxFile < csxSrc)
-        {
-          // eg file is 444, source is 422.
-          const uint32_t sx = csxSrc - csxFile;
-          if (!is16bit)
-          {
-            for (uint32_t x = 0; x < widthFile; x++)
-            {
-              buf[x] = (uint8_t)(pSrcBuf[x>>sx]);
-            }
-          }
-          else
-          {
-            for (uint32_t x = 0; x < widthFile; x++)
-            {
-              buf[2*x  ] = (pSrcBuf[x>>sx]>>0) & 0xff;
-              buf[2*x+1] = (pSrcBuf[x>>sx]>>8) & 0xff;
-            }
-          }
-        }
-        else
-        {
-          // eg file is 422, source is 444.
-          const uint32_t sx = csxFile - csxSrc;
-          if (!is16bit)
-          {
-            for (uint32_t x = 0; x < widthFile; x++)
-            {
-              buf[x] = (uint8_t)(pSrcBuf[x<<sx]);
-            }
-          }
-          else
-          {
-            for (uint32_t x = 0; x < widthFile; x++)
-            {
-              buf[2*x  ] = (pSrcBuf[x<<sx]>>0) & 0xff;
-              buf[2*x+1] = (pSrcBuf[x<<sx]>>8) & 0xff;
-            }
-          }
-        }
+        // write a new line, file and source have the same horizontal subsampling
+        g_pelBufOP.packSamples(pSrcBuf, buf, is16bit, widthFile);
 
         fd.write(reinterpret_cast<const char*>(buf), strideFile);
         if (fd.eof() || fd.fail())
@@ -1116,7 +1010,11 @@ bool VideoIOYuv::read(PelUnitBuf& pic, PelUnitBuf& picOrg, const InputColourSpac
     colourSpaceConvert(picOrg, pic, ipcsc, true);
   }
 
-  picOrg.copyFrom(pic);
+  if (ipcsc != IPCOLOURSPACE_UNCHANGED)
+  {
+    // pic already holds a plain copy of picOrg otherwise
+    picOrg.copyFrom(pic);
+  }
 
   return true;
 }